@@ -42,6 +42,7 @@ int ChCollisionModelChrono::ClearModel() {
     }
 
     local_convex_data.clear();
+    local_meshes.clear();
     m_shapes.clear();
     aabb_min = ChVector<>(C_REAL_MAX);
     aabb_max = ChVector<>(-C_REAL_MAX);
@@ -348,6 +349,10 @@ bool ChCollisionModelChrono::AddTriangleMesh(std::shared_ptr<ChMaterialSurface>
     const ChVector<>& position = frame.GetPos();
     const ChQuaternion<>& rotation = frame.GetRot();
 
+    // Record the range of triangle shapes of a static mesh
+    if (is_static && trimesh->getNumTriangles() > 0)
+        local_meshes.push_back(vec2((int)m_shapes.size(), trimesh->getNumTriangles()));
+
     for (int i = 0; i < trimesh->getNumTriangles(); i++) {
         auto shape = new ChCollisionShapeChrono(ChCollisionShape::Type::TRIANGLE, material);
         geometry::ChTriangle temptri = trimesh->getTriangle(i);
@@ -186,6 +186,9 @@ class ChApi ChCollisionModelChrono : public ChCollisionModel {
     /// Add a triangle mesh to this collision model.
     /// Note: if possible, for better performance, avoid triangle meshes and prefer simplified
     /// representations as compounds of primitive convex shapes (boxes, sphers, etc).
+    /// The mesh is added as a collection of TRIANGLE shapes. If `is_static` is true, the collision system also builds
+    /// a BVH of the mesh triangles and only the mesh bounding box is processed in the broadphase (see
+    /// ChCollisionSystemChrono::EnableMeshBVH).
     virtual bool AddTriangleMesh(                           //
         std::shared_ptr<ChMaterialSurface> material,        ///< surface contact material
         std::shared_ptr<geometry::ChTriangleMesh> trimesh,  ///< the triangle mesh
@@ -245,6 +248,7 @@ class ChApi ChCollisionModelChrono : public ChCollisionModel {
     void SetBody(ChBody* body) { mbody = body; }
 
     std::vector<real3> local_convex_data;
+    std::vector<vec2> local_meshes;  ///< index of first triangle shape and number of triangles of static meshes
 
     ChVector<> aabb_min;
     ChVector<> aabb_max;
@@ -0,0 +1,42 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <cassert>
+
+#include "chrono/collision/ChCollisionSystem.h"
+#include "chrono/utils/ChTracer.h"
+
+namespace chrono {
+namespace collision {
+
+void ChCollisionSystem::RayHitBatch(const std::vector<ChVector<>>& from,
+                                    const std::vector<ChVector<>>& to,
+                                    std::vector<ChRayhitResult>& results,
+                                    int nthreads) const {
+    assert(from.size() == to.size());
+    const int num_rays = (int)from.size();
+    results.resize(num_rays);
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        CH_TRACE_ZONE("ChCollisionSystem::RayHitBatch");
+#pragma omp for
+        for (int i = 0; i < num_rays; i++) {
+            RayHit(from[i], to[i], results[i]);
+        }
+    }
+}
+
+}  // end namespace collision
+}  // end namespace chrono
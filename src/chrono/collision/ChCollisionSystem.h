@@ -15,6 +15,8 @@
 #ifndef CH_COLLISIONSYSTEM_H
 #define CH_COLLISIONSYSTEM_H
 
+#include <vector>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/core/ChApiCE.h"
@@ -169,6 +171,15 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Perform a batch of ray-hit tests with the collision models.
+    /// The i-th ray goes from from[i] to to[i] and its result is returned in results[i] (resized as needed). Rays are
+    /// processed in parallel with the specified number of OpenMP threads; since each ray writes only its own result,
+    /// no synchronization is required. The default implementation calls RayHit() concurrently for all rays.
+    virtual void RayHitBatch(const std::vector<ChVector<>>& from,
+                             const std::vector<ChVector<>>& to,
+                             std::vector<ChRayhitResult>& results,
+                             int nthreads) const;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -20,11 +20,12 @@
 #include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystemChrono.h"
 #include "chrono/collision/chrono/ChRayTest.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 namespace collision {
 
-ChCollisionSystemChrono::ChCollisionSystemChrono() : use_aabb_active(false) {
+ChCollisionSystemChrono::ChCollisionSystemChrono() : use_mesh_bvh(true), use_aabb_active(false) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -56,10 +57,23 @@ void ChCollisionSystemChrono::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemChrono::SetBroadphaseAlgorithm(ChBroadphase::Algorithm algorithm, double margin) {
+    broadphase.algorithm = algorithm;
+    broadphase.tree_margin = real(margin);
+}
+
 void ChCollisionSystemChrono::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemChrono::EnableNarrowphaseBatching(bool val) {
+    narrowphase.batched = val;
+}
+
+void ChCollisionSystemChrono::EnableMeshBVH(bool val) {
+    use_mesh_bvh = val;
+}
+
 void ChCollisionSystemChrono::EnableActiveBoundingBox(const ChVector<>& aabb_min, const ChVector<>& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -120,6 +134,9 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
     // Shape index in the collision model
     int local_shape_index = 0;
 
+    // Global index of the first shape of this model
+    int first_shape = (int)cd_data->num_rigid_shapes;
+
     for (auto s : pmodel->GetShapes()) {
         auto shape = std::static_pointer_cast<ChCollisionShapeChrono>(s);
         real3 obA = shape->A;
@@ -195,15 +212,47 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
         shape_data.typ_rigid.push_back(shape->GetType());
         shape_data.id_rigid.push_back(body_id);
         shape_data.local_rigid.push_back(local_shape_index);
+        shape_data.mesh_rigid.push_back(-1);
         cd_data->num_rigid_shapes++;
         local_shape_index++;
     }
+
+    // Notify the broadphase of the change in the set of collision shapes
+    cd_data->shape_generation++;
+
+    if (!use_mesh_bvh)
+        return;
+
+    // For each static mesh, build the BVH of its triangles (in the body frame) and add a mesh shape bounding them.
+    for (const auto& mesh : pmodel->local_meshes) {
+        int mesh_index = (int)shape_data.mesh_bvh.size();
+        shape_data.mesh_bvh.push_back(ChAABBTree());
+        auto& bvh = shape_data.mesh_bvh.back();
+        for (int i = first_shape + mesh.x; i < first_shape + mesh.x + mesh.y; i++) {
+            const real3* tri = &shape_data.triangle_rigid[shape_data.start_rigid[i]];
+            bvh.Insert(Min(tri[0], Min(tri[1], tri[2])), Max(tri[0], Max(tri[1], tri[2])), i);
+            shape_data.mesh_rigid[i] = mesh_index;
+        }
+
+        shape_data.ObA_rigid.push_back(real3(0));
+        shape_data.ObR_rigid.push_back(quaternion(1, 0, 0, 0));
+        shape_data.start_rigid.push_back(mesh_index);
+        shape_data.length_rigid.push_back(mesh.y);
+
+        shape_data.fam_rigid.push_back(fam);
+        shape_data.typ_rigid.push_back(ChCollisionShape::Type::TRIANGLEMESH);
+        shape_data.id_rigid.push_back(body_id);
+        shape_data.local_rigid.push_back(mesh.x);
+        shape_data.mesh_rigid.push_back(-1);
+        cd_data->num_rigid_shapes++;
+    }
 }
 
 #define ERASE_MACRO(x, y) x.erase(x.begin() + y);
 #define ERASE_MACRO_LEN(x, y, z) x.erase(x.begin() + y, x.begin() + y + z);
 
 void ChCollisionSystemChrono::Remove(ChCollisionModel* model) {
+    cd_data->shape_generation++;
     /*
     ChCollisionModelChrono* pmodel = static_cast<ChCollisionModelChrono*>(model);
     int body_id = pmodel->GetBody()->GetId();
@@ -367,15 +416,21 @@ void ChCollisionSystemChrono::Run() {
     }
 
     // Broadphase
-    m_timer_broad.start();
-    GenerateAABB();
-    broadphase.Process();
-    m_timer_broad.stop();
+    {
+        CH_TRACE_ZONE("ChCollisionSystemChrono::Broadphase");
+        m_timer_broad.start();
+        GenerateAABB();
+        broadphase.Process();
+        m_timer_broad.stop();
+    }
 
     // Narrowphase
-    m_timer_narrow.start();
-    narrowphase.Process();
-    m_timer_narrow.stop();
+    {
+        CH_TRACE_ZONE("ChCollisionSystemChrono::Narrowphase");
+        m_timer_narrow.start();
+        narrowphase.Process();
+        m_timer_narrow.stop();
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -543,6 +598,13 @@ void ChCollisionSystemChrono::GenerateAABB() {
             if (id == UINT_MAX)
                 continue;
 
+            // Triangles of mesh shapes are excluded from the broadphase (inverted AABB)
+            if (cd_data->shape_data.IsMeshTriangle(index)) {
+                aabb_min[index] = real3(+C_REAL_MAX);
+                aabb_max[index] = real3(-C_REAL_MAX);
+                continue;
+            }
+
             real3 position = pos_rigid[id];
             quaternion rotation = Mult(body_rot[id], local_rot);
             real3 temp_min;
@@ -589,6 +651,13 @@ void ChCollisionSystemChrono::GenerateAABB() {
 
                 ComputeAABBTriangle(A, B, C, temp_min, temp_max);
 
+            } else if (type == ChCollisionShape::Type::TRIANGLEMESH) {
+                const auto& bvh = cd_data->shape_data.mesh_bvh[start];
+                real3 bmin = bvh.GetMin(bvh.GetRoot());
+                real3 bmax = bvh.GetMax(bvh.GetRoot());
+                ComputeAABBBox(0.5 * (bmax - bmin), 0.5 * (bmax + bmin), position, body_rot[id], body_rot[id],
+                               temp_min, temp_max);
+
             } else {
                 continue;
             }
@@ -627,15 +696,19 @@ std::vector<vec2> ChCollisionSystemChrono::GetOverlappingPairs() {
 
 // -----------------------------------------------------------------------------
 
-bool ChCollisionSystemChrono::RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& result) const {
-    if (cd_data->num_active_bins == 0) {
-        result.hit = false;
-        return false;
-    }
-
-    ChRayTest tester(cd_data);
+// Perform a ray-hit test using the given tester and load the result.
+// If an AABB tree is provided, the candidate shapes are obtained by traversing it; otherwise, the broadphase grid is used.
+static bool RayHitTest(ChRayTest& tester,
+                       const ChAABBTree* tree,
+                       const ChCollisionData& cd_data,
+                       const ChSystem& sys,
+                       const ChVector<>& from,
+                       const ChVector<>& to,
+                       ChCollisionSystem::ChRayhitResult& result) {
     ChRayTest::RayHitInfo info;
-    if (tester.Check(FromChVector(from), FromChVector(to), info)) {
+    bool hit = tree ? tester.Check(FromChVector(from), FromChVector(to), *tree, info)
+                    : tester.Check(FromChVector(from), FromChVector(to), info);
+    if (hit) {
         // Hit point
         result.hit = true;
         result.abs_hitNormal = ToChVector(info.normal);
@@ -643,10 +716,10 @@ bool ChCollisionSystemChrono::RayHit(const ChVector<>& from, const ChVector<>& t
         result.dist_factor = info.t;
 
         // ID of the body carring the closest hit shape
-        uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+        uint bid = cd_data.shape_data.id_rigid[info.shapeID];
 
         // Collision model of hit body
-        result.hitModel = m_system->Get_bodylist()[bid]->GetCollisionModel().get();
+        result.hitModel = sys.Get_bodylist()[bid]->GetCollisionModel().get();
 
         return true;
     }
@@ -655,6 +728,44 @@ bool ChCollisionSystemChrono::RayHit(const ChVector<>& from, const ChVector<>& t
     return false;
 }
 
+bool ChCollisionSystemChrono::RayHit(const ChVector<>& from, const ChVector<>& to, ChRayhitResult& result) const {
+    const ChAABBTree* tree = (broadphase.algorithm == ChBroadphase::Algorithm::AABB_TREE) ? &broadphase.tree : nullptr;
+
+    if (!tree && cd_data->num_active_bins == 0) {
+        result.hit = false;
+        return false;
+    }
+
+    ChRayTest tester(cd_data);
+    return RayHitTest(tester, tree, *cd_data, *m_system, from, to, result);
+}
+
+void ChCollisionSystemChrono::RayHitBatch(const std::vector<ChVector<>>& from,
+                                          const std::vector<ChVector<>>& to,
+                                          std::vector<ChRayhitResult>& results,
+                                          int nthreads) const {
+    assert(from.size() == to.size());
+    const int num_rays = (int)from.size();
+    results.resize(num_rays);
+
+    const ChAABBTree* tree = (broadphase.algorithm == ChBroadphase::Algorithm::AABB_TREE) ? &broadphase.tree : nullptr;
+
+    if (!tree && cd_data->num_active_bins == 0) {
+        for (auto& result : results)
+            result.hit = false;
+        return;
+    }
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        ChRayTest tester(cd_data);
+#pragma omp for
+        for (int i = 0; i < num_rays; i++) {
+            RayHitTest(tester, tree, *cd_data, *m_system, from[i], to[i], results[i]);
+        }
+    }
+}
+
 bool ChCollisionSystemChrono::RayHit(const ChVector<>& from,
                                      const ChVector<>& to,
                                      ChCollisionModel* model,
@@ -893,6 +1004,8 @@ void ChCollisionSystemChrono::VisualizeAABB() {
     std::vector<real3>& aabb_max = cd_data->aabb_max;
 
     for (uint index = 0; index < num_rigid_shapes; index++) {
+        if (cd_data->shape_data.IsMeshTriangle(index))
+            continue;
         real3 center = cd_data->global_origin + 0.5 * (aabb_max[index] + aabb_min[index]);
         real3 hdim = 0.5 * (aabb_max[index] - aabb_min[index]);
         DrawBox(vis_callback.get(), ChCoordsys<>(ToChVector(center), QUNIT), ToChVector(hdim), ChColor(0, 0, 1));
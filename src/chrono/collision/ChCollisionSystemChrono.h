@@ -67,12 +67,35 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Set the broadphase algorithm (default: ChBroadphase::Algorithm::GRID).
+    /// With ChBroadphase::Algorithm::AABB_TREE, shape AABBs enlarged by the specified margin are stored in a persistent
+    /// dynamic tree, and only shapes that move outside their enlarged AABB are updated. This is faster for scenes where
+    /// most shapes are at rest or move slowly (e.g., settled granular material, vehicle on static terrain). If the
+    /// margin is not positive, the collision envelope is used. With this algorithm, ray intersection tests (see RayHit)
+    /// traverse the tree instead of the broadphase grid.
+    void SetBroadphaseAlgorithm(ChBroadphase::Algorithm algorithm, double margin = 0);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable batched processing of candidate pairs in the narrowphase (default: true).
+    /// If enabled, the analytical algorithms (ChNarrowphase::Algorithm::PRIMS and HYBRID) first bin the candidate pairs
+    /// by the types of their shapes. Sphere-sphere and box-sphere pairs are then processed with vectorized kernels, while
+    /// box-box and capsule pairs use direct calls to the corresponding analytical functions.
+    void EnableNarrowphaseBatching(bool val);
+
+    /// Enable the use of a BVH for static triangle meshes (default: true).
+    /// If enabled, a mesh added with `is_static = true` (see ChCollisionModelChrono::AddTriangleMesh) is represented in
+    /// the broadphase by a single TRIANGLEMESH shape, bounding all mesh triangles. A BVH of the triangles is built once,
+    /// in the body frame, when the collision model is added to the system. The candidate pairs with the mesh shape are
+    /// then replaced by pairs with the mesh triangles overlapping the other shape, found by traversing the BVH. The
+    /// narrowphase and the ray intersection tests only process these triangles. This must be set before adding
+    /// collision models to the system. Note that mesh shapes do not interact with 3-DOF particles.
+    void EnableMeshBVH(bool val);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -136,6 +159,13 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform a batch of ray-hit tests with all collision models.
+    /// Each thread traverses the broadphase grid (or the AABB tree) with its own ray tester.
+    virtual void RayHitBatch(const std::vector<ChVector<>>& from,
+                             const std::vector<ChVector<>>& to,
+                             std::vector<ChRayhitResult>& results,
+                             int nthreads) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -168,6 +198,8 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
 
     std::vector<char> body_active;
 
+    bool use_mesh_bvh;  ///< use a BVH for static triangle meshes
+
     bool use_aabb_active;   ///< enable freezing of objects outside the active bounding box
     real3 active_aabb_min;  ///< lower corner of active bounding box
     real3 active_aabb_max;  ///< upper corner of active bounding box
@@ -0,0 +1,379 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+
+#include "chrono/collision/chrono/ChAABBTree.h"
+
+namespace chrono {
+namespace collision {
+
+// Half surface area of an AABB (used as cost in the surface area heuristic).
+static inline real Perimeter(const real3& aabb_min, const real3& aabb_max) {
+    real3 d = aabb_max - aabb_min;
+    return d.x * d.y + d.y * d.z + d.z * d.x;
+}
+
+static inline bool Overlap(const real3& Amin, const real3& Amax, const real3& Bmin, const real3& Bmax) {
+    return (Amin.x <= Bmax.x && Bmin.x <= Amax.x) && (Amin.y <= Bmax.y && Bmin.y <= Amax.y) &&
+           (Amin.z <= Bmax.z && Bmin.z <= Amax.z);
+}
+
+ChAABBTree::ChAABBTree() : m_root(NULL_NODE), m_free_list(NULL_NODE) {}
+
+void ChAABBTree::Clear() {
+    m_nodes.clear();
+    m_root = NULL_NODE;
+    m_free_list = NULL_NODE;
+}
+
+int ChAABBTree::AllocateNode() {
+    int node;
+    if (m_free_list != NULL_NODE) {
+        node = m_free_list;
+        m_free_list = m_nodes[node].parent;
+    } else {
+        node = (int)m_nodes.size();
+        m_nodes.push_back(Node());
+    }
+    m_nodes[node].parent = NULL_NODE;
+    m_nodes[node].child1 = NULL_NODE;
+    m_nodes[node].child2 = NULL_NODE;
+    m_nodes[node].height = 0;
+    m_nodes[node].user_index = -1;
+    return node;
+}
+
+void ChAABBTree::FreeNode(int node) {
+    m_nodes[node].parent = m_free_list;
+    m_nodes[node].height = -1;
+    m_free_list = node;
+}
+
+int ChAABBTree::Insert(const real3& aabb_min, const real3& aabb_max, int user_index) {
+    int leaf = AllocateNode();
+    m_nodes[leaf].aabb_min = aabb_min;
+    m_nodes[leaf].aabb_max = aabb_max;
+    m_nodes[leaf].user_index = user_index;
+    InsertLeaf(leaf);
+    return leaf;
+}
+
+void ChAABBTree::Remove(int leaf) {
+    assert(m_nodes[leaf].IsLeaf());
+    RemoveLeaf(leaf);
+    FreeNode(leaf);
+}
+
+void ChAABBTree::Update(int leaf, const real3& aabb_min, const real3& aabb_max) {
+    assert(m_nodes[leaf].IsLeaf());
+    RemoveLeaf(leaf);
+    m_nodes[leaf].aabb_min = aabb_min;
+    m_nodes[leaf].aabb_max = aabb_max;
+    InsertLeaf(leaf);
+}
+
+void ChAABBTree::InsertLeaf(int leaf) {
+    if (m_root == NULL_NODE) {
+        m_root = leaf;
+        m_nodes[leaf].parent = NULL_NODE;
+        return;
+    }
+
+    // Find the best sibling for the new leaf (surface area heuristic)
+    const real3 leaf_min = m_nodes[leaf].aabb_min;
+    const real3 leaf_max = m_nodes[leaf].aabb_max;
+    int index = m_root;
+    while (!m_nodes[index].IsLeaf()) {
+        int child1 = m_nodes[index].child1;
+        int child2 = m_nodes[index].child2;
+
+        real area = Perimeter(m_nodes[index].aabb_min, m_nodes[index].aabb_max);
+        real combined_area = Perimeter(Min(m_nodes[index].aabb_min, leaf_min), Max(m_nodes[index].aabb_max, leaf_max));
+
+        // Cost of creating a new parent for this node and the new leaf
+        real cost = 2 * combined_area;
+
+        // Minimum cost of pushing the leaf further down the tree
+        real inheritance_cost = 2 * (combined_area - area);
+
+        // Cost of descending into each child
+        real cost1 = inheritance_cost +
+                     Perimeter(Min(m_nodes[child1].aabb_min, leaf_min), Max(m_nodes[child1].aabb_max, leaf_max));
+        if (!m_nodes[child1].IsLeaf())
+            cost1 -= Perimeter(m_nodes[child1].aabb_min, m_nodes[child1].aabb_max);
+        real cost2 = inheritance_cost +
+                     Perimeter(Min(m_nodes[child2].aabb_min, leaf_min), Max(m_nodes[child2].aabb_max, leaf_max));
+        if (!m_nodes[child2].IsLeaf())
+            cost2 -= Perimeter(m_nodes[child2].aabb_min, m_nodes[child2].aabb_max);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    int sibling = index;
+
+    // Create a new parent
+    int old_parent = m_nodes[sibling].parent;
+    int new_parent = AllocateNode();
+    m_nodes[new_parent].parent = old_parent;
+    m_nodes[new_parent].aabb_min = Min(leaf_min, m_nodes[sibling].aabb_min);
+    m_nodes[new_parent].aabb_max = Max(leaf_max, m_nodes[sibling].aabb_max);
+    m_nodes[new_parent].height = m_nodes[sibling].height + 1;
+    m_nodes[new_parent].child1 = sibling;
+    m_nodes[new_parent].child2 = leaf;
+    m_nodes[sibling].parent = new_parent;
+    m_nodes[leaf].parent = new_parent;
+
+    if (old_parent != NULL_NODE) {
+        if (m_nodes[old_parent].child1 == sibling)
+            m_nodes[old_parent].child1 = new_parent;
+        else
+            m_nodes[old_parent].child2 = new_parent;
+    } else {
+        m_root = new_parent;
+    }
+
+    // Walk back up the tree, fixing heights and AABBs
+    Refit(m_nodes[leaf].parent);
+}
+
+void ChAABBTree::RemoveLeaf(int leaf) {
+    if (leaf == m_root) {
+        m_root = NULL_NODE;
+        return;
+    }
+
+    int parent = m_nodes[leaf].parent;
+    int grand_parent = m_nodes[parent].parent;
+    int sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grand_parent != NULL_NODE) {
+        // Destroy parent and connect sibling to grand parent
+        if (m_nodes[grand_parent].child1 == parent)
+            m_nodes[grand_parent].child1 = sibling;
+        else
+            m_nodes[grand_parent].child2 = sibling;
+        m_nodes[sibling].parent = grand_parent;
+        FreeNode(parent);
+
+        Refit(grand_parent);
+    } else {
+        m_root = sibling;
+        m_nodes[sibling].parent = NULL_NODE;
+        FreeNode(parent);
+    }
+}
+
+void ChAABBTree::Refit(int node) {
+    while (node != NULL_NODE) {
+        node = Balance(node);
+
+        int child1 = m_nodes[node].child1;
+        int child2 = m_nodes[node].child2;
+
+        m_nodes[node].height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+        m_nodes[node].aabb_min = Min(m_nodes[child1].aabb_min, m_nodes[child2].aabb_min);
+        m_nodes[node].aabb_max = Max(m_nodes[child1].aabb_max, m_nodes[child2].aabb_max);
+
+        node = m_nodes[node].parent;
+    }
+}
+
+// Perform a left or right rotation if node A is imbalanced. Return the new root of the subtree.
+int ChAABBTree::Balance(int iA) {
+    Node& A = m_nodes[iA];
+    if (A.IsLeaf() || A.height < 2)
+        return iA;
+
+    int iB = A.child1;
+    int iC = A.child2;
+    Node& B = m_nodes[iB];
+    Node& C = m_nodes[iC];
+
+    int balance = C.height - B.height;
+
+    // Rotate C up
+    if (balance > 1) {
+        int iF = C.child1;
+        int iG = C.child2;
+        Node& F = m_nodes[iF];
+        Node& G = m_nodes[iG];
+
+        // Swap A and C
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+
+        // A's old parent should point to C
+        if (C.parent != NULL_NODE) {
+            if (m_nodes[C.parent].child1 == iA)
+                m_nodes[C.parent].child1 = iC;
+            else
+                m_nodes[C.parent].child2 = iC;
+        } else {
+            m_root = iC;
+        }
+
+        // Rotate
+        if (F.height > G.height) {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+            A.aabb_min = Min(B.aabb_min, G.aabb_min);
+            A.aabb_max = Max(B.aabb_max, G.aabb_max);
+            C.aabb_min = Min(A.aabb_min, F.aabb_min);
+            C.aabb_max = Max(A.aabb_max, F.aabb_max);
+            A.height = 1 + std::max(B.height, G.height);
+            C.height = 1 + std::max(A.height, F.height);
+        } else {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+            A.aabb_min = Min(B.aabb_min, F.aabb_min);
+            A.aabb_max = Max(B.aabb_max, F.aabb_max);
+            C.aabb_min = Min(A.aabb_min, G.aabb_min);
+            C.aabb_max = Max(A.aabb_max, G.aabb_max);
+            A.height = 1 + std::max(B.height, F.height);
+            C.height = 1 + std::max(A.height, G.height);
+        }
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (balance < -1) {
+        int iD = B.child1;
+        int iE = B.child2;
+        Node& D = m_nodes[iD];
+        Node& E = m_nodes[iE];
+
+        // Swap A and B
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+
+        // A's old parent should point to B
+        if (B.parent != NULL_NODE) {
+            if (m_nodes[B.parent].child1 == iA)
+                m_nodes[B.parent].child1 = iB;
+            else
+                m_nodes[B.parent].child2 = iB;
+        } else {
+            m_root = iB;
+        }
+
+        // Rotate
+        if (D.height > E.height) {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+            A.aabb_min = Min(C.aabb_min, E.aabb_min);
+            A.aabb_max = Max(C.aabb_max, E.aabb_max);
+            B.aabb_min = Min(A.aabb_min, D.aabb_min);
+            B.aabb_max = Max(A.aabb_max, D.aabb_max);
+            A.height = 1 + std::max(C.height, E.height);
+            B.height = 1 + std::max(A.height, D.height);
+        } else {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+            A.aabb_min = Min(C.aabb_min, D.aabb_min);
+            A.aabb_max = Max(C.aabb_max, D.aabb_max);
+            B.aabb_min = Min(A.aabb_min, E.aabb_min);
+            B.aabb_max = Max(A.aabb_max, E.aabb_max);
+            A.height = 1 + std::max(C.height, D.height);
+            B.height = 1 + std::max(A.height, E.height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// Collect the user indices of all leaves for which the specified test (on the node AABB) passes.
+template <typename Test>
+void ChAABBTree::Traverse(const Test& test, std::vector<int>& result) const {
+    if (m_root == NULL_NODE)
+        return;
+
+    int stack[128];
+    std::vector<int> stack_ext;  // used only for (unlikely) very deep trees
+    int count = 0;
+    stack[count++] = m_root;
+
+    while (count > 0 || !stack_ext.empty()) {
+        int node;
+        if (!stack_ext.empty()) {
+            node = stack_ext.back();
+            stack_ext.pop_back();
+        } else {
+            node = stack[--count];
+        }
+
+        const Node& n = m_nodes[node];
+        if (!test(n.aabb_min, n.aabb_max))
+            continue;
+
+        if (n.IsLeaf()) {
+            result.push_back(n.user_index);
+        } else if (count < 127) {
+            stack[count++] = n.child1;
+            stack[count++] = n.child2;
+        } else {
+            stack_ext.push_back(n.child1);
+            stack_ext.push_back(n.child2);
+        }
+    }
+}
+
+void ChAABBTree::Query(const real3& aabb_min, const real3& aabb_max, std::vector<int>& result) const {
+    Traverse([&](const real3& nmin, const real3& nmax) { return Overlap(nmin, nmax, aabb_min, aabb_max); }, result);
+}
+
+void ChAABBTree::QuerySegment(const real3& start, const real3& end, std::vector<int>& result) const {
+    const real3 dir = end - start;
+
+    // Slab test of the segment against a node AABB
+    auto test = [&](const real3& nmin, const real3& nmax) {
+        real t0 = 0;
+        real t1 = 1;
+        for (int i = 0; i < 3; i++) {
+            if (Abs(dir[i]) < C_REAL_EPSILON) {
+                if (start[i] < nmin[i] || start[i] > nmax[i])
+                    return false;
+                continue;
+            }
+            real inv = 1 / dir[i];
+            real ta = (nmin[i] - start[i]) * inv;
+            real tb = (nmax[i] - start[i]) * inv;
+            if (ta > tb)
+                std::swap(ta, tb);
+            t0 = std::max(t0, ta);
+            t1 = std::min(t1, tb);
+            if (t0 > t1)
+                return false;
+        }
+        return true;
+    };
+
+    Traverse(test, result);
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -0,0 +1,107 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Dynamic AABB tree used by the incremental broadphase.
+//
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/multicore_math/real3.h"
+
+namespace chrono {
+namespace collision {
+
+/// @addtogroup collision_mc
+/// @{
+
+/// Dynamic bounding volume hierarchy of axis-aligned boxes.
+/// Each leaf stores an enlarged ("fat") AABB of a collision shape, so that the tree must only be updated when a shape
+/// moves outside its fat AABB. Internal nodes are selected with the surface area heuristic and the tree is kept
+/// balanced with tree rotations.
+class ChApi ChAABBTree {
+  public:
+    ChAABBTree();
+
+    /// Remove all leaves.
+    void Clear();
+
+    /// Insert a leaf with the given AABB and associated user index. Return the leaf ID.
+    int Insert(const real3& aabb_min, const real3& aabb_max, int user_index);
+
+    /// Remove the specified leaf.
+    void Remove(int leaf);
+
+    /// Change the AABB of the specified leaf (the leaf is removed and reinserted).
+    void Update(int leaf, const real3& aabb_min, const real3& aabb_max);
+
+    /// Return the user index associated with the specified leaf.
+    int GetUserIndex(int leaf) const { return m_nodes[leaf].user_index; }
+
+    /// Return the minimum corner of the AABB of the specified node.
+    const real3& GetMin(int node) const { return m_nodes[node].aabb_min; }
+
+    /// Return the maximum corner of the AABB of the specified node.
+    const real3& GetMax(int node) const { return m_nodes[node].aabb_max; }
+
+    /// Return the root node of the tree (NULL_NODE for an empty tree).
+    int GetRoot() const { return m_root; }
+
+    /// Return the height of the tree (0 for an empty tree or a tree with a single leaf).
+    int GetHeight() const { return m_root == NULL_NODE ? 0 : m_nodes[m_root].height; }
+
+    /// Collect the user indices of all leaves whose AABB overlaps the given box.
+    /// This function is thread safe, as long as the tree is not modified concurrently.
+    void Query(const real3& aabb_min, const real3& aabb_max, std::vector<int>& result) const;
+
+    /// Collect the user indices of all leaves whose AABB is intersected by the segment from `start` to `end`.
+    /// This function is thread safe, as long as the tree is not modified concurrently.
+    void QuerySegment(const real3& start, const real3& end, std::vector<int>& result) const;
+
+    static const int NULL_NODE = -1;
+
+  private:
+    struct Node {
+        real3 aabb_min;
+        real3 aabb_max;
+        int parent;  ///< parent node (also used as next free node for nodes in the free list)
+        int child1;  ///< first child (NULL_NODE for leaves)
+        int child2;  ///< second child (NULL_NODE for leaves)
+        int height;  ///< height of the node subtree (0 for leaves, -1 for free nodes)
+        int user_index;
+
+        bool IsLeaf() const { return child1 == NULL_NODE; }
+    };
+
+    int AllocateNode();
+    void FreeNode(int node);
+    void InsertLeaf(int leaf);
+    void RemoveLeaf(int leaf);
+    int Balance(int node);
+    template <typename Test>
+    void Traverse(const Test& test, std::vector<int>& result) const;
+    void Refit(int node);
+
+    std::vector<Node> m_nodes;
+    int m_root;
+    int m_free_list;
+};
+
+/// @} collision_mc
+
+}  // end namespace collision
+}  // end namespace chrono
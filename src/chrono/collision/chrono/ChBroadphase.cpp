@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <iterator>
 
 #include "chrono/collision/chrono/ChBroadphase.h"
 #include "chrono/collision/chrono/ChCollisionUtils.h"
@@ -35,7 +36,10 @@ namespace collision {
 using namespace chrono::collision::ch_utils;
 
 ChBroadphase::ChBroadphase()
-    : grid_type(GridType::FIXED_RESOLUTION),
+    : algorithm(Algorithm::GRID),
+      tree_margin(0),
+      tree_generation(0),
+      grid_type(GridType::FIXED_RESOLUTION),
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
@@ -209,8 +213,13 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // -----------------------------------------------------------------------------
 
-// Use spatial subdivision to detect the list of POSSIBLE collisions
+// Use spatial subdivision (or the dynamic AABB tree) to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
+    // The AABB tree works with the AABBs in absolute coordinates (i.e., before offsetting), so that shapes that do not
+    // move need not be updated.
+    if (algorithm == Algorithm::AABB_TREE && cd_data->num_rigid_shapes != 0)
+        TreeUpdate();
+
     // Compute overall AABB and then offset all AABBs
     DetermineBoundingBox();
     OffsetAABB();
@@ -219,12 +228,275 @@ void ChBroadphase::Process() {
     ComputeTopLevelResolution();
 
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (algorithm == Algorithm::GRID) {
+            OneLevelBroadphase();
+        } else {
+            TreePairs();
+            // No grid data is generated (ray intersection tests use the tree)
+            cd_data->num_active_bins = 0;
+        }
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
     return;
 }
 
+// Incremental broadphase using a dynamic AABB tree.
+// The tree stores enlarged (fat) AABBs of all shapes and the list of pairs of overlapping fat AABBs is maintained
+// persistently. At each call, only the shapes whose AABB moved outside of their fat AABB are updated in the tree and
+// only the pairs involving these shapes are recomputed.
+void ChBroadphase::TreeUpdate() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const real margin = (tree_margin > 0) ? tree_margin : cd_data->collision_envelope;
+
+    // If collision shapes were added or removed since the tree was built, rebuild it from scratch
+    // (shape indices may have changed, so that neither the tree leaves nor the persistent pairs can be reused)
+    if (tree_generation != cd_data->shape_generation || (int)tree_leaf.size() > num_shapes) {
+        tree.Clear();
+        tree_leaf.clear();
+        tree_pairs.clear();
+        tree_generation = cd_data->shape_generation;
+    }
+
+    int num_tree_shapes = (int)tree_leaf.size();
+    tree_leaf.resize(num_shapes);
+    fat_min.resize(num_shapes);
+    fat_max.resize(num_shapes);
+    shape_moved.resize(num_shapes);
+
+    // Flag shapes that moved outside their enlarged AABB (new shapes are always flagged).
+    // Triangles of mesh shapes are never inserted in the tree.
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (cd_data->shape_data.IsMeshTriangle(i)) {
+            shape_moved[i] = false;
+            tree_leaf[i] = ChAABBTree::NULL_NODE;
+            continue;
+        }
+        shape_moved[i] = (i >= num_tree_shapes) || aabb_min[i].x < fat_min[i].x || aabb_min[i].y < fat_min[i].y ||
+                         aabb_min[i].z < fat_min[i].z || aabb_max[i].x > fat_max[i].x ||
+                         aabb_max[i].y > fat_max[i].y || aabb_max[i].z > fat_max[i].z;
+    }
+
+    // Update the tree (sequential)
+    std::vector<int> moved;
+    for (int i = 0; i < num_shapes; i++) {
+        if (!shape_moved[i])
+            continue;
+        moved.push_back(i);
+        fat_min[i] = aabb_min[i] - margin;
+        fat_max[i] = aabb_max[i] + margin;
+        if (i < num_tree_shapes)
+            tree.Update(tree_leaf[i], fat_min[i], fat_max[i]);
+        else
+            tree_leaf[i] = tree.Insert(fat_min[i], fat_max[i], i);
+    }
+
+    if (!moved.empty()) {
+        // Discard all persistent pairs involving a moved shape
+        tree_pairs.erase(std::remove_if(tree_pairs.begin(), tree_pairs.end(),
+                                        [this](long long p) {
+                                            return shape_moved[int(p >> 32)] || shape_moved[int(p & 0xffffffff)];
+                                        }),
+                         tree_pairs.end());
+
+        // Find the new pairs of the moved shapes. A pair of two moved shapes is reported only by its first shape.
+        const int num_moved = (int)moved.size();
+        std::vector<std::vector<long long>> new_pairs(num_moved);
+#pragma omp parallel for schedule(dynamic, 16)
+        for (int k = 0; k < num_moved; k++) {
+            int shapeA = moved[k];
+            std::vector<int> overlaps;
+            tree.Query(fat_min[shapeA], fat_max[shapeA], overlaps);
+            for (auto shapeB : overlaps) {
+                if (shapeB == shapeA)
+                    continue;
+                if (shape_moved[shapeB] && shapeB < shapeA)
+                    continue;
+                if (obj_data_id[shapeA] == obj_data_id[shapeB] && obj_data_id[shapeA] != UINT_MAX)
+                    continue;
+                int s1 = std::min(shapeA, shapeB);
+                int s2 = std::max(shapeA, shapeB);
+                new_pairs[k].push_back((long long)s1 << 32 | (long long)s2);
+            }
+        }
+
+        // Merge the new pairs in the sorted list of persistent pairs
+        std::vector<long long> added;
+        for (const auto& p : new_pairs)
+            added.insert(added.end(), p.begin(), p.end());
+        std::sort(added.begin(), added.end());
+        size_t num_kept = tree_pairs.size();
+        tree_pairs.insert(tree_pairs.end(), added.begin(), added.end());
+        std::inplace_merge(tree_pairs.begin(), tree_pairs.begin() + num_kept, tree_pairs.end());
+    }
+}
+
+// Candidate pairs of the AABB tree broadphase, obtained by filtering the list of persistent pairs with the actual AABBs
+// (and collision families). The filter uses the offset AABBs, like the grid algorithm, so that the candidate pairs are
+// identical to those produced by the grid (also for AABBs that only touch).
+void ChBroadphase::TreePairs() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+
+    // Filter the persistent pairs using the actual shape AABBs
+    std::vector<long long> old_pairs;
+    old_pairs.swap(pair_shapeIDs);
+    pair_shapeIDs.clear();
+    for (auto p : tree_pairs) {
+        uint shapeA = uint(p >> 32);
+        uint shapeB = uint(p & 0xffffffff);
+        uint bodyA = obj_data_id[shapeA];
+        uint bodyB = obj_data_id[shapeB];
+
+        if (bodyA == UINT_MAX || bodyB == UINT_MAX)
+            continue;
+        if (bodyA == bodyB)
+            continue;
+        if (obj_collide[bodyA] == 0 || obj_collide[bodyB] == 0)
+            continue;
+        if (!obj_active[bodyA] && !obj_active[bodyB])
+            continue;
+        if (!collide(fam_data[shapeA], fam_data[shapeB]))
+            continue;
+        if (!overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]))
+            continue;
+        pair_shapeIDs.push_back(p);
+    }
+
+    // Replace the pairs involving mesh shapes (keeps the list sorted)
+    ExpandMeshPairs(cd_data->global_origin);
+
+    cd_data->num_possible_collisions = (uint)pair_shapeIDs.size();
+
+    // Changes in the list of candidate pairs since the previous call.
+    // Note that the list of pairs from a previous call is sorted only if it was generated by this algorithm.
+    if (!std::is_sorted(old_pairs.begin(), old_pairs.end()))
+        std::sort(old_pairs.begin(), old_pairs.end());
+    pairs_added.clear();
+    pairs_removed.clear();
+    std::set_difference(pair_shapeIDs.begin(), pair_shapeIDs.end(), old_pairs.begin(), old_pairs.end(),
+                        std::back_inserter(pairs_added));
+    std::set_difference(old_pairs.begin(), old_pairs.end(), pair_shapeIDs.begin(), pair_shapeIDs.end(),
+                        std::back_inserter(pairs_removed));
+}
+
+// Collect the triangles of the specified mesh shape with an AABB overlapping the given box (in absolute frame).
+// The box is expressed in the body frame and the BVH of the mesh is traversed with the bounding AABB of the result.
+static void QueryMesh(const shape_container& shape_data,
+                      const real3& pos,
+                      const quaternion& rot,
+                      int mesh_shape,
+                      const real3& box_min,
+                      const real3& box_max,
+                      std::vector<int>& triangles) {
+    real3 center = RotateT(0.5 * (box_max + box_min) - pos, rot);
+    real3 hdim = AbsRotate(~rot, 0.5 * (box_max - box_min));
+    shape_data.mesh_bvh[shape_data.start_rigid[mesh_shape]].Query(center - hdim, center + hdim, triangles);
+}
+
+// Replace the candidate pairs involving a TRIANGLEMESH shape with pairs involving the mesh triangles.
+// For a mesh-shape pair, the BVH of the mesh is traversed with the AABB of the other shape. For a mesh-mesh pair, the
+// BVH of the second mesh is traversed with the AABB of each triangle of the first mesh overlapping the second mesh.
+// The shape AABBs are offset by the specified origin. The resulting list of pairs is sorted. The list of mesh
+// triangles referenced by the new pairs is also generated, so that the narrowphase only needs to transform these.
+void ChBroadphase::ExpandMeshPairs(const real3& origin) {
+    const shape_container& shape_data = cd_data->shape_data;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<int>& mesh_triangles = cd_data->mesh_triangles;
+
+    mesh_triangles.clear();
+    if (shape_data.mesh_bvh.empty())
+        return;
+
+    const std::vector<int>& obj_data_T = shape_data.typ_rigid;
+    const std::vector<uint>& obj_data_id = shape_data.id_rigid;
+    const std::vector<real3>& body_pos = *cd_data->state_data.pos_rigid;
+    const std::vector<quaternion>& body_rot = *cd_data->state_data.rot_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    // Split the pairs, keeping in place those not involving a mesh shape
+    std::vector<long long> mesh_pairs;
+    size_t num_kept = 0;
+    for (auto p : pair_shapeIDs) {
+        int shapeA = int(p >> 32);
+        int shapeB = int(p & 0xffffffff);
+        if (obj_data_T[shapeA] == ChCollisionShape::Type::TRIANGLEMESH ||
+            obj_data_T[shapeB] == ChCollisionShape::Type::TRIANGLEMESH)
+            mesh_pairs.push_back(p);
+        else
+            pair_shapeIDs[num_kept++] = p;
+    }
+    pair_shapeIDs.resize(num_kept);
+
+    if (mesh_pairs.empty())
+        return;
+
+    // Traverse the mesh BVHs
+    const int num_mesh_pairs = (int)mesh_pairs.size();
+    std::vector<std::vector<long long>> new_pairs(num_mesh_pairs);
+#pragma omp parallel for schedule(dynamic, 4)
+    for (int k = 0; k < num_mesh_pairs; k++) {
+        int shapeA = int(mesh_pairs[k] >> 32);
+        int shapeB = int(mesh_pairs[k] & 0xffffffff);
+        if (obj_data_T[shapeA] != ChCollisionShape::Type::TRIANGLEMESH)
+            std::swap(shapeA, shapeB);
+        uint bodyA = obj_data_id[shapeA];
+        uint bodyB = obj_data_id[shapeB];
+
+        std::vector<int> trianglesA;
+        QueryMesh(shape_data, body_pos[bodyA], body_rot[bodyA], shapeA, aabb_min[shapeB] + origin,
+                  aabb_max[shapeB] + origin, trianglesA);
+
+        if (obj_data_T[shapeB] != ChCollisionShape::Type::TRIANGLEMESH) {
+            for (auto t : trianglesA)
+                new_pairs[k].push_back((long long)std::min(t, shapeB) << 32 | (long long)std::max(t, shapeB));
+            continue;
+        }
+
+        std::vector<int> trianglesB;
+        for (auto tA : trianglesA) {
+            const real3* tri = &shape_data.triangle_rigid[shape_data.start_rigid[tA]];
+            real3 v0 = TransformLocalToParent(body_pos[bodyA], body_rot[bodyA], tri[0]);
+            real3 v1 = TransformLocalToParent(body_pos[bodyA], body_rot[bodyA], tri[1]);
+            real3 v2 = TransformLocalToParent(body_pos[bodyA], body_rot[bodyA], tri[2]);
+            trianglesB.clear();
+            QueryMesh(shape_data, body_pos[bodyB], body_rot[bodyB], shapeB, Min(v0, Min(v1, v2)),
+                      Max(v0, Max(v1, v2)), trianglesB);
+            for (auto tB : trianglesB)
+                new_pairs[k].push_back((long long)std::min(tA, tB) << 32 | (long long)std::max(tA, tB));
+        }
+    }
+
+    // Append the new pairs and collect the referenced mesh triangles
+    for (const auto& p : new_pairs) {
+        for (auto pair : p) {
+            int shapeA = int(pair >> 32);
+            int shapeB = int(pair & 0xffffffff);
+            if (shape_data.mesh_rigid[shapeA] >= 0)
+                mesh_triangles.push_back(shapeA);
+            if (shape_data.mesh_rigid[shapeB] >= 0)
+                mesh_triangles.push_back(shapeB);
+        }
+        pair_shapeIDs.insert(pair_shapeIDs.end(), p.begin(), p.end());
+    }
+    std::sort(pair_shapeIDs.begin(), pair_shapeIDs.end());
+    std::sort(mesh_triangles.begin(), mesh_triangles.end());
+    mesh_triangles.erase(std::unique(mesh_triangles.begin(), mesh_triangles.end()), mesh_triangles.end());
+}
+
 void ChBroadphase::OneLevelBroadphase() {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
     const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
@@ -260,7 +532,7 @@ void ChBroadphase::OneLevelBroadphase() {
     // Count the number of bins intersected by each shape AABB -> bin_intersections
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX) {
+        if (obj_data_id[i] == UINT_MAX || cd_data->shape_data.IsMeshTriangle(i)) {
             bin_intersections[i] = 0;
             continue;
         }
@@ -279,7 +551,7 @@ void ChBroadphase::OneLevelBroadphase() {
     // For each shape, store the bin index and the shape ID for intersections with this shape 
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX)
+        if (obj_data_id[i] == UINT_MAX || cd_data->shape_data.IsMeshTriangle(i))
             continue;
         f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
                                       bin_aabb_number);
@@ -342,6 +614,10 @@ void ChBroadphase::OneLevelBroadphase() {
     for (int j = bin_active[num_active_bins - 1] + 1; j <= (signed)num_bins; j++) {
         bin_start_index_ext[j] = bin_start_index[num_active_bins];
     }
+
+    // Replace the pairs involving mesh shapes
+    ExpandMeshPairs(cd_data->global_origin);
+    num_possible_collisions = (uint)pair_shapeIDs.size();
 }
 
 }  // end namespace collision
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "chrono/collision/ChCollisionModel.h"
+#include "chrono/collision/chrono/ChAABBTree.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
 
 namespace chrono {
@@ -30,6 +31,12 @@ namespace collision {
 /// Class for performing broad-phase collision detection.
 class ChApi ChBroadphase {
   public:
+    /// Broadphase algorithm
+    enum class Algorithm {
+        GRID,      ///< uniform grid, rebuilt from scratch at each call
+        AABB_TREE  ///< persistent dynamic AABB tree, incrementally updated for moving shapes only
+    };
+
     /// Method for computing grid resolution
     enum class GridType {
         FIXED_RESOLUTION,  ///< user-specified number of bins in each direction
@@ -43,8 +50,19 @@ class ChApi ChBroadphase {
     /// Collision detection results are loaded in the shared data object (see ChCollisionData).
     void Process();
 
+    /// Return the shape pairs that were added to the list of candidate pairs at the last call to Process().
+    /// Only available with Algorithm::AABB_TREE (encoded as in ChCollisionData::pair_shapeIDs).
+    const std::vector<long long>& GetAddedPairs() const { return pairs_added; }
+
+    /// Return the shape pairs that were removed from the list of candidate pairs at the last call to Process().
+    /// Only available with Algorithm::AABB_TREE (encoded as in ChCollisionData::pair_shapeIDs).
+    const std::vector<long long>& GetRemovedPairs() const { return pairs_removed; }
+
   private:
     void OneLevelBroadphase();
+    void TreeUpdate();
+    void TreePairs();
+    void ExpandMeshPairs(const real3& origin);
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -53,11 +71,23 @@ class ChApi ChBroadphase {
 
     std::shared_ptr<ChCollisionData> cd_data;
 
+    Algorithm algorithm;   ///< (input) broadphase algorithm
+    real tree_margin;      ///< (input) enlargement of shape AABBs stored in the tree (used for Algorithm::AABB_TREE)
     GridType grid_type;    ///< (input) method for setting grid resolution
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
 
+    ChAABBTree tree;                       ///< dynamic AABB tree of enlarged shape AABBs
+    uint tree_generation;                  ///< shape generation (see ChCollisionData) for which the tree was built
+    std::vector<int> tree_leaf;            ///< tree leaf of each shape
+    std::vector<real3> fat_min;            ///< minimum corner of enlarged AABB of each shape
+    std::vector<real3> fat_max;            ///< maximum corner of enlarged AABB of each shape
+    std::vector<char> shape_moved;         ///< flag for shapes that moved outside their enlarged AABB
+    std::vector<long long> tree_pairs;     ///< persistent (sorted) list of pairs with overlapping enlarged AABBs
+    std::vector<long long> pairs_added;    ///< pairs added at last call (sorted)
+    std::vector<long long> pairs_removed;  ///< pairs removed at last call (sorted)
+
     friend class ChCollisionSystemChrono;
     friend class ChCollisionSystemChronoMulticore;
 };
@@ -23,6 +23,8 @@
 
 #include "chrono/multicore_math/ChMulticoreMath.h"
 
+#include "chrono/collision/chrono/ChAABBTree.h"
+
 namespace chrono {
 namespace collision {
 
@@ -41,7 +43,8 @@ struct shape_container {
     std::vector<int> typ_rigid;     ///< shape type
     std::vector<int> local_rigid;   ///< local shape index in collision model of associated body
     std::vector<int> start_rigid;   ///< start index in the appropriate container of dimensions
-    std::vector<int> length_rigid;  ///< usually 1, except for convex
+    std::vector<int> length_rigid;  ///< usually 1, except for convex and triangle mesh
+    std::vector<int> mesh_rigid;    ///< mesh owning a triangle shape (-1 for shapes not part of a mesh)
 
     std::vector<quaternion> ObR_rigid;  ///< shape rotations
     std::vector<real3> ObA_rigid;       ///< shape positions
@@ -57,6 +60,15 @@ struct shape_container {
     std::vector<real3> convex_rigid;     ///< points for convex hull shapes
 
     std::vector<real3> triangle_global;  ///< triangle vertices in global frame
+
+    /// BVH of each triangle mesh shape, built from the triangle AABBs in the body frame.
+    /// The leaves store the IDs of the triangle shapes of the mesh. A TRIANGLEMESH shape stores the index of its BVH
+    /// as start index and the number of triangles as length.
+    std::vector<ChAABBTree> mesh_bvh;
+
+    /// Return true if the specified shape is a triangle of a mesh shape.
+    /// Such triangles are not processed by the broadphase; they are instead collected from the BVH of their mesh.
+    bool IsMeshTriangle(int index) const { return !mesh_bvh.empty() && mesh_rigid[index] >= 0; }
 };
 
 /// Structure of arrays containing state data.
@@ -98,6 +110,7 @@ class ChApi ChCollisionData {
           num_rigid_fluid_contacts(0),
           num_fluid_contacts(0),
           num_rigid_shapes(0),
+          shape_generation(0),
           //
           bins_per_axis(vec3(10, 10, 10)),
           //
@@ -162,6 +175,7 @@ class ChApi ChCollisionData {
 
     std::vector<long long> pair_shapeIDs;     ///< shape IDs for each shape pair (encoded in a single long long)
     std::vector<long long> contact_shapeIDs;  ///< shape IDs for each contact (encoded in a single long long)
+    std::vector<int> mesh_triangles;          ///< mesh triangle shapes referenced by the current shape pairs
 
     // Rigid-rigid geometric collision data
     std::vector<real3> norm_rigid_rigid;  ///< [num_rigid_contacts] normal for each rigid-rigid contact
@@ -217,6 +231,7 @@ class ChApi ChCollisionData {
     // ------------------
 
     uint num_rigid_shapes;          ///< number of collision models in a system
+    uint shape_generation;          ///< counter incremented whenever collision shapes are added or removed
     uint num_rigid_contacts;        ///< number of contacts between rigid bodies in a system
     uint num_rigid_fluid_contacts;  ///< number of contacts between rigid and fluid objects
     uint num_fluid_contacts;        ///< number of contacts between fluid objects
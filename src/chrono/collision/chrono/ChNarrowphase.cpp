@@ -38,6 +38,7 @@ using namespace chrono::collision::ch_utils;
 
 ChNarrowphase::ChNarrowphase()
     : algorithm(Algorithm::HYBRID),
+      batched(true),
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
@@ -151,45 +152,49 @@ int ChNarrowphase::PreprocessCount() {
     return num_potentialContacts;
 }
 
+// Transform the specified shape to the global frame.
+static void ShapeLocalToParent(shape_container& shape_data, const real3& pos, const quaternion& rot, int index) {
+    shape_data.obj_data_A_global[index] = TransformLocalToParent(pos, rot, shape_data.ObA_rigid[index]);
+    if (shape_data.typ_rigid[index] == ChCollisionShape::Type::TRIANGLE) {
+        int start = shape_data.start_rigid[index];
+        shape_data.triangle_global[start + 0] = TransformLocalToParent(pos, rot, shape_data.triangle_rigid[start + 0]);
+        shape_data.triangle_global[start + 1] = TransformLocalToParent(pos, rot, shape_data.triangle_rigid[start + 1]);
+        shape_data.triangle_global[start + 2] = TransformLocalToParent(pos, rot, shape_data.triangle_rigid[start + 2]);
+    }
+    shape_data.obj_data_R_global[index] = Mult(rot, shape_data.ObR_rigid[index]);
+}
+
 void ChNarrowphase::PreprocessLocalToParent() {
     uint num_shapes = cd_data->num_rigid_shapes;
+    shape_container& shape_data = cd_data->shape_data;
 
-    const std::vector<int>& obj_data_T = cd_data->shape_data.typ_rigid;
-    const std::vector<real3>& obj_data_A = cd_data->shape_data.ObA_rigid;
-    const std::vector<quaternion>& obj_data_R = cd_data->shape_data.ObR_rigid;
-    const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
+    const std::vector<uint>& obj_data_ID = shape_data.id_rigid;
 
     const std::vector<real3>& body_pos = *cd_data->state_data.pos_rigid;
     const std::vector<quaternion>& body_rot = *cd_data->state_data.rot_rigid;
 
-    cd_data->shape_data.obj_data_A_global.resize(num_shapes);
+    shape_data.obj_data_A_global.resize(num_shapes);
 
-    cd_data->shape_data.obj_data_R_global.resize(num_shapes);
-    cd_data->shape_data.triangle_global.resize(cd_data->shape_data.triangle_rigid.size());
+    shape_data.obj_data_R_global.resize(num_shapes);
+    shape_data.triangle_global.resize(shape_data.triangle_rigid.size());
 
+    // Triangles of mesh shapes are transformed only if they appear in a candidate pair (see ChBroadphase)
 #pragma omp parallel for
     for (int index = 0; index < (signed)num_shapes; index++) {
-        shape_type T = obj_data_T[index];
-
         // Get the identifier for the object associated with this collision shape
         uint ID = obj_data_ID[index];
-        if (ID == UINT_MAX)
+        if (ID == UINT_MAX || shape_data.IsMeshTriangle(index))
             continue;
 
-        real3 pos = body_pos[ID];       // Get the global object position
-        quaternion rot = body_rot[ID];  // Get the global object rotation
-
-        cd_data->shape_data.obj_data_A_global[index] = TransformLocalToParent(pos, rot, obj_data_A[index]);
-        if (T == ChCollisionShape::Type::TRIANGLE) {
-            int start = cd_data->shape_data.start_rigid[index];
-            cd_data->shape_data.triangle_global[start + 0] =
-                TransformLocalToParent(pos, rot, cd_data->shape_data.triangle_rigid[start + 0]);
-            cd_data->shape_data.triangle_global[start + 1] =
-                TransformLocalToParent(pos, rot, cd_data->shape_data.triangle_rigid[start + 1]);
-            cd_data->shape_data.triangle_global[start + 2] =
-                TransformLocalToParent(pos, rot, cd_data->shape_data.triangle_rigid[start + 2]);
-        }
-        cd_data->shape_data.obj_data_R_global[index] = Mult(rot, obj_data_R[index]);
+        ShapeLocalToParent(shape_data, body_pos[ID], body_rot[ID], index);
+    }
+
+    const std::vector<int>& mesh_triangles = cd_data->mesh_triangles;
+#pragma omp parallel for
+    for (int i = 0; i < (signed)mesh_triangles.size(); i++) {
+        int index = mesh_triangles[i];
+        uint ID = obj_data_ID[index];
+        ShapeLocalToParent(shape_data, body_pos[ID], body_rot[ID], index);
     }
 }
 
@@ -269,12 +274,22 @@ void ChNarrowphase::DispatchPRIMS() {
     ConvexShape shapeA;
     ConvexShape shapeB;
 
+    // Process candidate pairs of known types in batches. The remaining pairs are processed individually.
+    int num_pairs = (int)num_potential_rigid_contacts;
+    if (batched) {
+        BinPairs();
+        for (int bin = 0; bin < OTHER; bin++)
+            DispatchBatch(PairBin(bin));
+        num_pairs = (int)(pair_bin_start[OTHER + 1] - pair_bin_start[OTHER]);
+    }
+
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int k = 0; k < num_pairs; k++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
+        int index = batched ? (int)pair_bin_index[pair_bin_start[OTHER] + k] : k;
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
         if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
@@ -297,12 +312,22 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
+    // Process candidate pairs of known types in batches. The remaining pairs are processed individually.
+    int num_pairs = (int)num_potential_rigid_contacts;
+    if (batched) {
+        BinPairs();
+        for (int bin = 0; bin < OTHER; bin++)
+            DispatchBatch(PairBin(bin));
+        num_pairs = (int)(pair_bin_start[OTHER + 1] - pair_bin_start[OTHER]);
+    }
+
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int k = 0; k < num_pairs; k++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
+        int index = batched ? (int)pair_bin_index[pair_bin_start[OTHER] + k] : k;
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
         if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
@@ -528,9 +553,30 @@ void ChNarrowphase::ProcessRigidFluid() {
     const vec3& bins_per_axis = cd_data->bins_per_axis;
     real3 global_origin = cd_data->global_origin;
     real3 inv_bin_size = cd_data->inv_bin_size;
-    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    shape_container& shape_data = cd_data->shape_data;
+    const std::vector<short2>& fam_data = shape_data.fam_rigid;
     const real radius = sphere_radius;
 
+    // Collision test between a rigid shape and a 3-dof particle.
+    // If the two shapes are in contact, the contact is added to the list of contacts of the particle.
+    auto rigid_fluid_collision = [&](const ConvexBase* shapeA, const ConvexShapeSphere* shapeB, uint bodyA, uint p) {
+        uint index = p * max_rigid_neighbors + contact_counts[p];
+        real3 ptA, ptB, norm;
+        real depth, erad = 0;
+        int nC = 0;
+        if (PRIMSCollision(shapeA, shapeB, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad, nC)) {
+            if (nC != 1)
+                return;
+        } else if (!MPRCollision(shapeA, shapeB, envelope, norm, ptA, ptB, depth)) {
+            return;
+        }
+        neighbor_rigid_sphere[index] = bodyA;
+        norm_rigid_sphere[index] = norm;
+        cpta_rigid_sphere[index] = ptA;
+        dpth_rigid_sphere[index] = depth;
+        contact_counts[p]++;
+    };
+
     uint total_bins = (bins_per_axis.x + 1) * (bins_per_axis.y + 1) * (bins_per_axis.z + 1);
     is_rigid_bin_active.resize(total_bins);
 
@@ -615,6 +661,7 @@ void ChNarrowphase::ProcessRigidFluid() {
                 real3 Bmin = pos_sphere - real3(radius + envelope) - global_origin;
                 real3 Bmax = pos_sphere + real3(radius + envelope) - global_origin;
                 ConvexShapeSphere* shapeB = new ConvexShapeSphere(pos_sphere, sphere_radius * .5);
+                std::vector<int> triangles;
 
                 for (uint j = rigid_start; j < rigid_end; j++) {
                     if (contact_counts[p] < max_rigid_neighbors) {
@@ -624,30 +671,30 @@ void ChNarrowphase::ProcessRigidFluid() {
                         // if the sphere and the rigid body appear in the same bin more than once, dont count
                         if (current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size, bins_per_axis, bin_number) == true) {
                             if (overlap(Amin, Amax, Bmin, Bmax) && collide(family, fam_data[shape_id_a])) {
-                                ConvexShape* shapeA = new ConvexShape(shape_id_a, &cd_data->shape_data);
-                                real3 ptA, ptB, norm;
-                                real depth, erad = 0;
-                                int nC = 0;
-                                if (PRIMSCollision(shapeA, shapeB, 2 * envelope, &norm, &ptA, &ptB, &depth, &erad,
-                                                   nC)) {
-                                    if (nC == 1) {
-                                        uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
-                                        neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
-                                        norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = norm;
-                                        cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = ptA;
-                                        dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = depth;
-                                        contact_counts[p]++;
+                                uint bodyA = shape_data.id_rigid[shape_id_a];
+                                if (shape_data.typ_rigid[shape_id_a] == ChCollisionShape::Type::TRIANGLEMESH) {
+                                    // test the sphere against the mesh triangles found by traversing the mesh BVH
+                                    // with the sphere AABB (expressed in the body frame)
+                                    const real3& pos = (*cd_data->state_data.pos_rigid)[bodyA];
+                                    const quaternion& rot = (*cd_data->state_data.rot_rigid)[bodyA];
+                                    real3 center = RotateT(pos_sphere - pos, rot);
+                                    triangles.clear();
+                                    shape_data.mesh_bvh[shape_data.start_rigid[shape_id_a]].Query(
+                                        center - real3(radius + envelope), center + real3(radius + envelope), triangles);
+                                    for (auto tri : triangles) {
+                                        if (contact_counts[p] >= max_rigid_neighbors)
+                                            break;
+                                        const real3* vert = &shape_data.triangle_rigid[shape_data.start_rigid[tri]];
+                                        real3 v0 = TransformLocalToParent(pos, rot, vert[0]);
+                                        real3 v1 = TransformLocalToParent(pos, rot, vert[1]);
+                                        real3 v2 = TransformLocalToParent(pos, rot, vert[2]);
+                                        ConvexShapeTriangle shapeA(v0, v1, v2);
+                                        rigid_fluid_collision(&shapeA, shapeB, bodyA, p);
                                     }
-                                } else if (MPRCollision(
-                                               shapeA, shapeB, envelope,
-                                               norm_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]],
-                                               cpta_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]], ptB,
-                                               dpth_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]])) {
-                                    uint bodyA = cd_data->shape_data.id_rigid[shape_id_a];
-                                    neighbor_rigid_sphere[p * max_rigid_neighbors + contact_counts[p]] = bodyA;
-                                    contact_counts[p]++;
+                                } else {
+                                    ConvexShape shapeA(shape_id_a, &shape_data);
+                                    rigid_fluid_collision(&shapeA, shapeB, bodyA, p);
                                 }
-                                delete shapeA;
                             }
                         }
                     }
@@ -130,6 +130,29 @@ class ChApi ChNarrowphase {
     void ProcessRigidRigid();
     void ProcessRigidFluid();
 
+    /// Pair types processed in batches (see BinPairs).
+    enum PairBin {
+        SPHERE_SPHERE,
+        BOX_SPHERE,
+        SPHERE_BOX,
+        BOX_BOX,
+        CAPSULE_SPHERE,
+        SPHERE_CAPSULE,
+        CAPSULE_CAPSULE,
+        OTHER,
+        NUM_PAIR_BINS
+    };
+
+    /// Sort the candidate pairs by the types of the two shapes (see PairBin).
+    void BinPairs();
+
+    /// Batched analytical collision detection for the candidate pairs in the specified bin.
+    /// Sphere-sphere and box-sphere pairs are processed with vectorized kernels operating on structure-of-arrays data;
+    /// all other pairs in the bin are processed with a direct call to the corresponding analytical function.
+    void DispatchBatch(PairBin bin);
+    void DispatchBatchSphereSphere();
+    void DispatchBatchBoxSphere(bool swap);
+
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
@@ -149,6 +172,10 @@ class ChApi ChNarrowphase {
 
     Algorithm algorithm;
 
+    bool batched;                      ///< batch processing of candidate pairs (PRIMS and HYBRID only)
+    std::vector<uint> pair_bin_index;  ///< candidate pair indices, sorted by pair bin
+    std::vector<uint> pair_bin_start;  ///< start of each pair bin in pair_bin_index (plus end marker)
+
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
     std::vector<uint> f_bin_number_out;  //// TODO: rename to f_bin_active
@@ -16,6 +16,9 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono/collision/chrono/ChNarrowphase.h"
 #include "chrono/collision/chrono/ChCollisionUtils.h"
 
@@ -1604,5 +1607,338 @@ bool ChNarrowphase::PRIMSCollision(const ConvexBase* shapeA,  // first candidate
     return false;
 }
 
+// =============================================================================
+//              BATCHED DISPATCH
+
+// Number of candidate pairs gathered in structure-of-arrays form and processed together by the vectorized kernels.
+static const int BATCH_SIZE = 64;
+
+// Classify a pair of shape types.
+static int PairBinIndex(int type1, int type2) {
+    if (type1 == ChCollisionShape::Type::SPHERE) {
+        if (type2 == ChCollisionShape::Type::SPHERE)
+            return 0;  // SPHERE_SPHERE
+        if (type2 == ChCollisionShape::Type::BOX)
+            return 2;  // SPHERE_BOX
+        if (type2 == ChCollisionShape::Type::CAPSULE)
+            return 5;  // SPHERE_CAPSULE
+    } else if (type1 == ChCollisionShape::Type::BOX) {
+        if (type2 == ChCollisionShape::Type::SPHERE)
+            return 1;  // BOX_SPHERE
+        if (type2 == ChCollisionShape::Type::BOX)
+            return 3;  // BOX_BOX
+    } else if (type1 == ChCollisionShape::Type::CAPSULE) {
+        if (type2 == ChCollisionShape::Type::SPHERE)
+            return 4;  // CAPSULE_SPHERE
+        if (type2 == ChCollisionShape::Type::CAPSULE)
+            return 6;  // CAPSULE_CAPSULE
+    }
+    return 7;  // OTHER
+}
+
+void ChNarrowphase::BinPairs() {
+    const int num_pairs = (int)num_potential_rigid_contacts;
+    const shape_type* obj_data_T = cd_data->shape_data.typ_rigid.data();
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+
+    // Counting sort of the candidate pairs by pair bin (stable, so that pairs in a bin are in their original order)
+    std::vector<char> bin(num_pairs);
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        int s1 = int(pair_shapeIDs[index] >> 32);
+        int s2 = int(pair_shapeIDs[index] & 0xffffffff);
+        bin[index] = (char)PairBinIndex(obj_data_T[s1], obj_data_T[s2]);
+    }
+
+    pair_bin_start.assign(NUM_PAIR_BINS + 1, 0);
+    for (int index = 0; index < num_pairs; index++)
+        pair_bin_start[bin[index] + 1]++;
+    for (int b = 0; b < NUM_PAIR_BINS; b++)
+        pair_bin_start[b + 1] += pair_bin_start[b];
+
+    std::vector<uint> next(pair_bin_start.begin(), pair_bin_start.end() - 1);
+    pair_bin_index.resize(num_pairs);
+    for (int index = 0; index < num_pairs; index++)
+        pair_bin_index[next[bin[index]]++] = index;
+}
+
+void ChNarrowphase::DispatchBatch(PairBin bin) {
+    if (pair_bin_start[bin + 1] == pair_bin_start[bin])
+        return;
+
+    switch (bin) {
+        case SPHERE_SPHERE:
+            DispatchBatchSphereSphere();
+            return;
+        case BOX_SPHERE:
+            DispatchBatchBoxSphere(false);
+            return;
+        case SPHERE_BOX:
+            DispatchBatchBoxSphere(true);
+            return;
+        default:
+            break;
+    }
+
+    // Direct calls to the analytical collision functions (no dispatch on shape types)
+    const real separation = 2 * cd_data->collision_envelope;
+    const shape_container& sd = cd_data->shape_data;
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* depth = cd_data->dpth_rigid_rigid.data();
+    real* eff_radius = cd_data->erad_rigid_rigid.data();
+
+    const int start = (int)pair_bin_start[bin];
+    const int end = (int)pair_bin_start[bin + 1];
+
+#pragma omp parallel for
+    for (int k = start; k < end; k++) {
+        uint index = pair_bin_index[k];
+        int s1 = int(pair_shapeIDs[index] >> 32);
+        int s2 = int(pair_shapeIDs[index] & 0xffffffff);
+        uint icoll = contact_index[index];
+        int nC = 0;
+
+        switch (bin) {
+            case BOX_BOX:
+                nC = box_box(sd.obj_data_A_global[s1], sd.obj_data_R_global[s1], sd.box_like_rigid[sd.start_rigid[s1]],
+                             sd.obj_data_A_global[s2], sd.obj_data_R_global[s2], sd.box_like_rigid[sd.start_rigid[s2]],
+                             separation, &norm[icoll], &depth[icoll], &ptA[icoll], &ptB[icoll], &eff_radius[icoll]);
+                break;
+            case CAPSULE_SPHERE: {
+                const real2& cap = sd.capsule_rigid[sd.start_rigid[s1]];
+                if (capsule_sphere(sd.obj_data_A_global[s1], sd.obj_data_R_global[s1], cap.x, cap.y,
+                                   sd.obj_data_A_global[s2], sd.sphere_rigid[sd.start_rigid[s2]], separation,
+                                   norm[icoll], depth[icoll], ptA[icoll], ptB[icoll], eff_radius[icoll])) {
+                    nC = 1;
+                }
+                break;
+            }
+            case SPHERE_CAPSULE: {
+                const real2& cap = sd.capsule_rigid[sd.start_rigid[s2]];
+                if (capsule_sphere(sd.obj_data_A_global[s2], sd.obj_data_R_global[s2], cap.x, cap.y,
+                                   sd.obj_data_A_global[s1], sd.sphere_rigid[sd.start_rigid[s1]], separation,
+                                   norm[icoll], depth[icoll], ptB[icoll], ptA[icoll], eff_radius[icoll])) {
+                    norm[icoll] = -norm[icoll];
+                    nC = 1;
+                }
+                break;
+            }
+            case CAPSULE_CAPSULE: {
+                const real2& cap1 = sd.capsule_rigid[sd.start_rigid[s1]];
+                const real2& cap2 = sd.capsule_rigid[sd.start_rigid[s2]];
+                nC = capsule_capsule(sd.obj_data_A_global[s1], sd.obj_data_R_global[s1], cap1.x, cap1.y,
+                                     sd.obj_data_A_global[s2], sd.obj_data_R_global[s2], cap2.x, cap2.y, separation,
+                                     &norm[icoll], &depth[icoll], &ptA[icoll], &ptB[icoll], &eff_radius[icoll]);
+                break;
+            }
+            default:
+                break;
+        }
+
+        if (nC > 0)
+            Dispatch_Finalize(icoll, sd.id_rigid[s1], sd.id_rigid[s2], nC);
+    }
+}
+
+// Vectorized sphere-sphere collision detection (see sphere_sphere).
+void ChNarrowphase::DispatchBatchSphereSphere() {
+    const real separation = 2 * cd_data->collision_envelope;
+    const shape_container& sd = cd_data->shape_data;
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+
+    const int start = (int)pair_bin_start[SPHERE_SPHERE];
+    const int end = (int)pair_bin_start[SPHERE_SPHERE + 1];
+    const int num_batches = (end - start + BATCH_SIZE - 1) / BATCH_SIZE;
+
+#pragma omp parallel for
+    for (int ib = 0; ib < num_batches; ib++) {
+        const int first = start + ib * BATCH_SIZE;
+        const int n = std::min(BATCH_SIZE, end - first);
+
+        int s1[BATCH_SIZE], s2[BATCH_SIZE];
+        real x1[BATCH_SIZE], y1[BATCH_SIZE], z1[BATCH_SIZE], r1[BATCH_SIZE];
+        real x2[BATCH_SIZE], y2[BATCH_SIZE], z2[BATCH_SIZE], r2[BATCH_SIZE];
+        real nx[BATCH_SIZE], ny[BATCH_SIZE], nz[BATCH_SIZE], depth[BATCH_SIZE], erad[BATCH_SIZE];
+        char hit[BATCH_SIZE];
+
+        // Gather shape data
+        for (int k = 0; k < n; k++) {
+            long long p = pair_shapeIDs[pair_bin_index[first + k]];
+            s1[k] = int(p >> 32);
+            s2[k] = int(p & 0xffffffff);
+            const real3& pos1 = sd.obj_data_A_global[s1[k]];
+            const real3& pos2 = sd.obj_data_A_global[s2[k]];
+            x1[k] = pos1.x;
+            y1[k] = pos1.y;
+            z1[k] = pos1.z;
+            x2[k] = pos2.x;
+            y2[k] = pos2.y;
+            z2[k] = pos2.z;
+            r1[k] = sd.sphere_rigid[sd.start_rigid[s1[k]]];
+            r2[k] = sd.sphere_rigid[sd.start_rigid[s2[k]]];
+        }
+
+        // Collision tests
+#pragma omp simd
+        for (int k = 0; k < n; k++) {
+            real dx = x2[k] - x1[k];
+            real dy = y2[k] - y1[k];
+            real dz = z2[k] - z1[k];
+            real dist2 = dx * dx + dy * dy + dz * dz;
+            real radSum = r1[k] + r2[k];
+            real radSum_s = radSum + separation;
+            bool h = (dist2 < radSum_s * radSum_s) && (dist2 >= 1e-12);
+            real dist = std::sqrt(h ? dist2 : real(1));
+            hit[k] = h;
+            nx[k] = dx / dist;
+            ny[k] = dy / dist;
+            nz[k] = dz / dist;
+            depth[k] = dist - radSum;
+            erad[k] = r1[k] * r2[k] / radSum;
+        }
+
+        // Scatter contact data
+        for (int k = 0; k < n; k++) {
+            if (!hit[k])
+                continue;
+            uint icoll = contact_index[pair_bin_index[first + k]];
+            real3 normal(nx[k], ny[k], nz[k]);
+            cd_data->norm_rigid_rigid[icoll] = normal;
+            cd_data->cpta_rigid_rigid[icoll] = sd.obj_data_A_global[s1[k]] + normal * r1[k];
+            cd_data->cptb_rigid_rigid[icoll] = sd.obj_data_A_global[s2[k]] - normal * r2[k];
+            cd_data->dpth_rigid_rigid[icoll] = depth[k];
+            cd_data->erad_rigid_rigid[icoll] = erad[k];
+            Dispatch_Finalize(icoll, sd.id_rigid[s1[k]], sd.id_rigid[s2[k]], 1);
+        }
+    }
+}
+
+// Vectorized box-sphere collision detection (see box_sphere).
+// If 'swap' is true, the first shape in each candidate pair is the sphere.
+void ChNarrowphase::DispatchBatchBoxSphere(bool swap) {
+    const real separation = 2 * cd_data->collision_envelope;
+    const shape_container& sd = cd_data->shape_data;
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+
+    const PairBin bin = swap ? SPHERE_BOX : BOX_SPHERE;
+    const int start = (int)pair_bin_start[bin];
+    const int end = (int)pair_bin_start[bin + 1];
+    const int num_batches = (end - start + BATCH_SIZE - 1) / BATCH_SIZE;
+
+#pragma omp parallel for
+    for (int ib = 0; ib < num_batches; ib++) {
+        const int first = start + ib * BATCH_SIZE;
+        const int n = std::min(BATCH_SIZE, end - first);
+
+        int sb[BATCH_SIZE], ss[BATCH_SIZE];
+        real bx[BATCH_SIZE], by[BATCH_SIZE], bz[BATCH_SIZE];
+        real qw[BATCH_SIZE], qx[BATCH_SIZE], qy[BATCH_SIZE], qz[BATCH_SIZE];
+        real hx[BATCH_SIZE], hy[BATCH_SIZE], hz[BATCH_SIZE];
+        real sx[BATCH_SIZE], sy[BATCH_SIZE], sz[BATCH_SIZE], rad[BATCH_SIZE];
+        real px[BATCH_SIZE], py[BATCH_SIZE], pz[BATCH_SIZE];
+        real nx[BATCH_SIZE], ny[BATCH_SIZE], nz[BATCH_SIZE], depth[BATCH_SIZE];
+        int code[BATCH_SIZE];
+        char hit[BATCH_SIZE];
+
+        // Gather shape data
+        for (int k = 0; k < n; k++) {
+            long long p = pair_shapeIDs[pair_bin_index[first + k]];
+            sb[k] = swap ? int(p & 0xffffffff) : int(p >> 32);
+            ss[k] = swap ? int(p >> 32) : int(p & 0xffffffff);
+            const real3& pos1 = sd.obj_data_A_global[sb[k]];
+            const quaternion& rot1 = sd.obj_data_R_global[sb[k]];
+            const real3& hdims1 = sd.box_like_rigid[sd.start_rigid[sb[k]]];
+            const real3& pos2 = sd.obj_data_A_global[ss[k]];
+            bx[k] = pos1.x;
+            by[k] = pos1.y;
+            bz[k] = pos1.z;
+            qw[k] = rot1.w;
+            qx[k] = rot1.x;
+            qy[k] = rot1.y;
+            qz[k] = rot1.z;
+            hx[k] = hdims1.x;
+            hy[k] = hdims1.y;
+            hz[k] = hdims1.z;
+            sx[k] = pos2.x;
+            sy[k] = pos2.y;
+            sz[k] = pos2.z;
+            rad[k] = sd.sphere_rigid[sd.start_rigid[ss[k]]];
+        }
+
+        // Collision tests (in the box frame)
+#pragma omp simd
+        for (int k = 0; k < n; k++) {
+            // Sphere position in box frame: v + w*t + q x t, with t = 2 * q x v (conjugate quaternion)
+            real vx = sx[k] - bx[k];
+            real vy = sy[k] - by[k];
+            real vz = sz[k] - bz[k];
+            real ux = -qx[k], uy = -qy[k], uz = -qz[k];
+            real tx = 2 * (uy * vz - uz * vy);
+            real ty = 2 * (uz * vx - ux * vz);
+            real tz = 2 * (ux * vy - uy * vx);
+            real lx = vx + qw[k] * tx + (uy * tz - uz * ty);
+            real ly = vy + qw[k] * ty + (uz * tx - ux * tz);
+            real lz = vz + qw[k] * tz + (ux * ty - uy * tx);
+
+            // Snap to box surface
+            real cx = std::min(std::max(lx, -hx[k]), hx[k]);
+            real cy = std::min(std::max(ly, -hy[k]), hy[k]);
+            real cz = std::min(std::max(lz, -hz[k]), hz[k]);
+            code[k] = (cx != lx ? 1 : 0) | (cy != ly ? 2 : 0) | (cz != lz ? 4 : 0);
+
+            real dx = lx - cx;
+            real dy = ly - cy;
+            real dz = lz - cz;
+            real dist2 = dx * dx + dy * dy + dz * dz;
+            real rad_s = rad[k] + separation;
+            bool h = (dist2 < rad_s * rad_s) && (dist2 > 1e-12f);
+            real dist = std::sqrt(h ? dist2 : real(1));
+            hit[k] = h;
+            depth[k] = dist - rad[k];
+            nx[k] = dx / dist;
+            ny[k] = dy / dist;
+            nz[k] = dz / dist;
+            px[k] = cx;
+            py[k] = cy;
+            pz[k] = cz;
+        }
+
+        // Scatter contact data (transformed back to the global frame)
+        for (int k = 0; k < n; k++) {
+            if (!hit[k])
+                continue;
+            uint icoll = contact_index[pair_bin_index[first + k]];
+            const real3& pos1 = sd.obj_data_A_global[sb[k]];
+            const quaternion& rot1 = sd.obj_data_R_global[sb[k]];
+            const real3& pos2 = sd.obj_data_A_global[ss[k]];
+
+            real3 normal = Rotate(real3(nx[k], ny[k], nz[k]), rot1);
+            real3 pt1 = TransformLocalToParent(pos1, rot1, real3(px[k], py[k], pz[k]));
+            real3 pt2 = pos2 - normal * rad[k];
+            real eff_radius = rad[k];
+            if ((code[k] != 1) && (code[k] != 2) && (code[k] != 4))
+                eff_radius = rad[k] * edge_radius / (rad[k] + edge_radius);
+
+            cd_data->dpth_rigid_rigid[icoll] = depth[k];
+            cd_data->erad_rigid_rigid[icoll] = eff_radius;
+            if (swap) {
+                cd_data->norm_rigid_rigid[icoll] = -normal;
+                cd_data->cpta_rigid_rigid[icoll] = pt2;
+                cd_data->cptb_rigid_rigid[icoll] = pt1;
+                Dispatch_Finalize(icoll, sd.id_rigid[ss[k]], sd.id_rigid[sb[k]], 1);
+            } else {
+                cd_data->norm_rigid_rigid[icoll] = normal;
+                cd_data->cpta_rigid_rigid[icoll] = pt1;
+                cd_data->cptb_rigid_rigid[icoll] = pt2;
+                Dispatch_Finalize(icoll, sd.id_rigid[sb[k]], sd.id_rigid[ss[k]], 1);
+            }
+        }
+    }
+}
+
 }  // end namespace collision
 }  // namespace chrono
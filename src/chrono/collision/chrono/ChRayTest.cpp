@@ -445,8 +445,12 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
             num_shape_tests++;
             shape.index = bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
+            if (shape.Type() == ChCollisionShape::Type::TRIANGLEMESH) {
+                if (CheckMesh(shape.index, start, end, info.normal, mindist2))
+                    hit = true;
+            } else if (CheckShape(shape, start, end, info.normal, mindist2)) {
                 hit = true;
+            }
         }
 
         // If a shape in the current bin was hit, stop.
@@ -471,6 +475,37 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     return hit;
 }
 
+bool ChRayTest::Check(const real3& start, const real3& end, const ChAABBTree& tree, RayHitInfo& info) {
+    tree_shapes.clear();
+    tree.QuerySegment(start, end, tree_shapes);
+
+    // Test ray against all candidate shapes, keeping track of the closest hit.
+    ConvexShape shape(-1, &cd_data->shape_data);
+    real mindist2 = C_REAL_MAX;
+    bool hit = false;
+
+    for (auto index : tree_shapes) {
+        num_shape_tests++;
+        shape.index = index;
+        bool shape_hit = (shape.Type() == ChCollisionShape::Type::TRIANGLEMESH)
+                             ? CheckMesh(index, start, end, info.normal, mindist2)
+                             : CheckShape(shape, start, end, info.normal, mindist2);
+        if (shape_hit) {
+            info.shapeID = index;
+            hit = true;
+        }
+    }
+
+    if (hit) {
+        real3 ray = end - start;
+        info.dist = Sqrt(mindist2);         // Distance from ray origin
+        info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
+        info.point = start + info.t * ray;  // Intersection point
+    }
+
+    return hit;
+}
+
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
 // fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
@@ -499,5 +534,32 @@ bool ChRayTest::CheckShape(const ConvexBase& shape,
     }
 }
 
+bool ChRayTest::CheckMesh(int index, const real3& start, const real3& end, real3& normal, real& mindist2) {
+    const shape_container& shape_data = cd_data->shape_data;
+    uint ID = shape_data.id_rigid[index];
+    const real3& pos = (*cd_data->state_data.pos_rigid)[ID];
+    const quaternion& rot = (*cd_data->state_data.rot_rigid)[ID];
+
+    // Express the ray in the body frame (the mesh triangles are defined in the body frame)
+    real3 start_B = RotateT(start - pos, rot);
+    real3 end_B = RotateT(end - pos, rot);
+
+    mesh_triangles.clear();
+    shape_data.mesh_bvh[shape_data.start_rigid[index]].QuerySegment(start_B, end_B, mesh_triangles);
+
+    bool found = false;
+    real3 normal_B;
+    for (auto t : mesh_triangles) {
+        num_shape_tests++;
+        const real3* tri = &shape_data.triangle_rigid[shape_data.start_rigid[t]];
+        if (triangle_ray(tri[0], tri[1], tri[2], start_B, end_B, normal_B, mindist2)) {
+            normal = Rotate(normal_B, rot);
+            found = true;
+        }
+    }
+
+    return found;
+}
+
 }  // end namespace collision
 }  // end namespace chrono
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "chrono/collision/chrono/ChAABBTree.h"
 #include "chrono/collision/chrono/ChCollisionData.h"
 #include "chrono/collision/chrono/ChConvexShape.h"
 
@@ -49,6 +50,15 @@ class ChApi ChRayTest {
                RayHitInfo& info     ///< [output] test result info
     );
 
+    /// Check for intersection of the given ray with the collision shapes stored in the given AABB tree.
+    /// Used with the AABB tree broadphase (see ChBroadphase::Algorithm::AABB_TREE), for which no grid is available.
+    /// Only the shapes with a tree AABB intersected by the ray are tested.
+    bool Check(const real3& start,      ///< ray start point
+               const real3& end,        ///< ray end point
+               const ChAABBTree& tree,  ///< tree of shape AABBs (leaf user indices are shape identifiers)
+               RayHitInfo& info         ///< [output] test result info
+    );
+
     /// Return the number of bins visited by the DDA algorithm during the last ray test.
     uint GetNumBinTests() const { return num_bin_tests; }
 
@@ -64,7 +74,18 @@ class ChApi ChRayTest {
                     real& mindist2            ///< [output] smallest squared distance to ray origin
     );
 
+    /// Ray intersection test for a triangle mesh shape.
+    /// The ray is expressed in the body frame and the BVH of the mesh is traversed to find the candidate triangles.
+    bool CheckMesh(int index,          ///< mesh shape identifier
+                   const real3& start,  ///< ray start point
+                   const real3& end,    ///< ray end point
+                   real3& normal,       ///< [output] normal to shape at intersectin point
+                   real& mindist2       ///< [output] smallest squared distance to ray origin
+    );
+
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
+    std::vector<int> mesh_triangles;           ///< candidate triangles from mesh BVH traversal
+    std::vector<int> tree_shapes;              ///< candidate shapes from AABB tree traversal
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
 };
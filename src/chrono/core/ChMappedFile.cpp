@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "chrono/core/ChMappedFile.h"
+
+namespace chrono {
+
+ChMappedFile::ChMappedFile(const std::string& filename)
+    : m_data(nullptr), m_size(0), m_valid(false), m_file(nullptr), m_mapping(nullptr), m_fd(-1) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+    m_file = file;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+        return;
+    m_size = (size_t)size.QuadPart;
+    m_valid = true;
+    if (m_size == 0)
+        return;
+    m_mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (m_mapping)
+        m_data = (const char*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    m_valid = (m_data != nullptr);
+#else
+    m_fd = open(filename.c_str(), O_RDONLY);
+    if (m_fd < 0)
+        return;
+    struct stat st;
+    if (fstat(m_fd, &st) != 0)
+        return;
+    m_size = (size_t)st.st_size;
+    m_valid = true;
+    if (m_size == 0)
+        return;
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+    m_data = (data == MAP_FAILED) ? nullptr : (const char*)data;
+    m_valid = (m_data != nullptr);
+#endif
+}
+
+ChMappedFile::~ChMappedFile() {
+#ifdef _WIN32
+    if (m_data)
+        UnmapViewOfFile(m_data);
+    if (m_mapping)
+        CloseHandle(m_mapping);
+    if (m_file)
+        CloseHandle(m_file);
+#else
+    if (m_data)
+        munmap((void*)m_data, m_size);
+    if (m_fd >= 0)
+        close(m_fd);
+#endif
+}
+
+}  // end namespace chrono
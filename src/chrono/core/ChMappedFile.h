@@ -0,0 +1,58 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CHMAPPEDFILE_H
+#define CHMAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// Read-only view of the contents of a file, mapped in memory.
+/// The file is mapped at construction and unmapped at destruction. Pages are loaded by the operating system on first
+/// access, so that mapping a large file is cheap and reading it does not require intermediate buffers.
+class ChApi ChMappedFile {
+  public:
+    /// Map the specified file. Use IsValid() to check for success.
+    explicit ChMappedFile(const std::string& filename);
+
+    ~ChMappedFile();
+
+    /// Return true if the file was successfully mapped (an empty file is valid, with a null data pointer).
+    bool IsValid() const { return m_valid; }
+
+    /// Return a pointer to the file contents.
+    const char* GetData() const { return m_data; }
+
+    /// Return the size of the file, in bytes.
+    size_t GetSize() const { return m_size; }
+
+  private:
+    ChMappedFile(const ChMappedFile&) = delete;
+    ChMappedFile& operator=(const ChMappedFile&) = delete;
+
+    const char* m_data;
+    size_t m_size;
+    bool m_valid;
+    void* m_file;     ///< file handle (Windows)
+    void* m_mapping;  ///< file mapping handle (Windows)
+    int m_fd;         ///< file descriptor (POSIX)
+};
+
+}  // end namespace chrono
+
+#endif
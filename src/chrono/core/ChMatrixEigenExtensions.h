@@ -63,6 +63,18 @@ friend const CwiseBinaryOp<internal::scalar_sum_op<Scalar>, const ConstantReturn
         mat.derived().Constant(mat.rows(), mat.cols(), val), mat.derived());
 }
 
+/// Return a pointer to the coefficients of a plain matrix, stored contiguously in the order of linear indices, for
+/// serialization as a raw block (see ChArchiveBlock). Return a null pointer for other expressions.
+template <typename D = Derived>
+typename std::enable_if<std::is_same<D, typename D::PlainObject>::value, Scalar*>::type blockData() {
+    return derived().data();
+}
+
+template <typename D = Derived>
+typename std::enable_if<!std::is_same<D, typename D::PlainObject>::value, Scalar*>::type blockData() {
+    return nullptr;
+}
+
 void ArchiveOUT(chrono::ChArchiveOut& marchive) {
     // suggested: use versioning
 	marchive.VersionWrite<chrono::ChMatrix_dense_version_tag>(); // btw use the ChMatrixDynamic version tag also for all other templates.
@@ -95,6 +107,11 @@ void ArchiveOUT(chrono::ChArchiveOut& marchive) {
 		double* foo = 0;
         chrono::ChValueSpecific< double* > specVal(foo, "data", 0);
         marchive.out_array_pre(specVal, tot_elements);
+        if (blockData() && marchive.out_block_possible<Scalar>()) {
+            marchive.out_block_data(blockData(), tot_elements);
+            marchive.out_array_end(specVal, tot_elements);
+            return;
+        }
 		char idname[21]; // only for xml, xml serialization needs unique element name
         for (size_t i = 0; i < tot_elements; i++) {
 			sprintf(idname, "%lu", (unsigned long)i);
@@ -120,6 +137,11 @@ void ArchiveIN(chrono::ChArchiveIn& marchive) {
     // custom input of matrix data as array
     size_t tot_elements = derived().rows() * derived().cols();
     marchive.in_array_pre("data", tot_elements);
+    if (blockData() && marchive.in_block_possible<Scalar>()) {
+        marchive.in_block_data(blockData(), tot_elements);
+        marchive.in_array_end("data");
+        return;
+    }
 	char idname[20]; // only for xml, xml serialization needs unique element name
     for (size_t i = 0; i < tot_elements; i++) {
 		sprintf(idname, "%lu", (unsigned long)i);
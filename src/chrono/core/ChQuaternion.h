@@ -418,6 +418,13 @@ class ChQuaternion {
 
 CH_CLASS_VERSION(ChQuaternion<double>, 0)
 
+/// Arrays of ChQuaternions are serialized as raw blocks by archives supporting it (see ChArchiveBlock).
+template <class Real>
+struct ChArchiveBlock<ChQuaternion<Real>> {
+    static const bool value = ChArchiveBlock<Real>::value && sizeof(ChQuaternion<Real>) == 4 * sizeof(Real);
+    typedef ChQuaternion<double> version_type;
+};
+
 // -----------------------------------------------------------------------------
 
 /// Shortcut for faster use of typical double-precision quaternion.
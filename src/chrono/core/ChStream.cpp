@@ -726,16 +726,14 @@ ChStreamVectorWrapper::~ChStreamVectorWrapper() {
 }
 
 void ChStreamVectorWrapper::Write(const char* data, size_t n) {
-    std::copy(data, data + n, std::back_inserter(*vbuffer));
+    vbuffer->insert(vbuffer->end(), data, data + n);
 }
 void ChStreamVectorWrapper::Read(char* data, size_t n) {
     if (pos + n > vbuffer->size())
         n = vbuffer->size() - pos;
 
-    for (int i = 0; i < n; i++) {
-        data[i] = (*vbuffer)[pos];
-        pos++;
-    }
+    std::copy(vbuffer->begin() + pos, vbuffer->begin() + pos + n, data);
+    pos += (int)n;
 }
 bool ChStreamVectorWrapper::End_of_stream() const {
     if (pos >= vbuffer->size())
@@ -805,6 +803,20 @@ ChStreamInBinaryFile::ChStreamInBinaryFile(const char* filename)
 ChStreamInBinaryFile::~ChStreamInBinaryFile() {
 }
 
+ChStreamInBinaryMappedFile::ChStreamInBinaryMappedFile(const char* filename) : file(filename), pos(0) {
+    if (!file.IsValid())
+        throw ChException("Cannot open stream");
+}
+ChStreamInBinaryMappedFile::~ChStreamInBinaryMappedFile() {
+}
+void ChStreamInBinaryMappedFile::Input(char* data, size_t n) {
+    if (pos > file.GetSize() || n > file.GetSize() - pos)
+        throw ChException("Cannot read from stream");
+    if (n)
+        memcpy(data, file.GetData() + pos, n);
+    pos += n;
+}
+
 ChStreamInAsciiFile::ChStreamInAsciiFile(const char* filename) : ChStreamFile(filename, std::ios::in) {
 }
 ChStreamInAsciiFile::~ChStreamInAsciiFile() {
@@ -24,6 +24,7 @@
 
 #include "chrono/core/ChException.h"
 #include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMappedFile.h"
 
 namespace chrono {
 /// Ugly hack added by hammad to get code to compile on osx.
@@ -341,6 +342,9 @@ class ChApi ChStreamOutBinary : public ChStreamOut, public ChBinaryArchive {
         this->Output((char*)&ogg, sizeof(T));
     }
 
+    /// Output a raw chunk of 'n' bytes, without any byte ordering conversion.
+    void RawOutput(const char* data, size_t n) { this->Output(data, n); }
+
     /// Stores an object, given the pointer, into the archive.
     /// This function can be used to serialize objects from
     /// nontrivial class trees, where at load time one may wonder
@@ -457,6 +461,9 @@ class ChApi ChStreamInBinary : public ChStreamIn, public ChBinaryArchive {
         this->Input((char*)&ogg, sizeof(T));
     }
 
+    /// Input a raw chunk of 'n' bytes, without any byte ordering conversion.
+    void RawInput(char* data, size_t n) { this->Input(data, n); }
+
     /// Extract an object from the archive, and assignes the pointer to it.
     /// This function can be used to load objects whose class is not
     /// known in advance (anyway, assuming the class had been registered
@@ -810,6 +817,32 @@ class ChApi ChStreamInBinaryFile : public ChStreamFile, public ChStreamInBinary
     virtual void Input(char* data, size_t n) override { ChStreamFile::Read(data, n); }
 };
 
+///
+/// This is a specialized class for BINARY input from a file mapped in memory.
+/// The file is not read through the C++ file streams: data is copied directly from the memory mapping, which makes
+/// reading large archives (see ChArchiveInBinary) considerably faster.
+///
+
+class ChApi ChStreamInBinaryMappedFile : public ChStreamInBinary {
+  public:
+    ChStreamInBinaryMappedFile(const char* filename);
+    virtual ~ChStreamInBinaryMappedFile();
+
+    virtual bool End_of_stream() const override { return pos >= file.GetSize(); }
+
+    /// Return the size of the file, in bytes.
+    size_t GetSize() const { return file.GetSize(); }
+
+    /// Rewind read position to char number (0= beginning).
+    void Seek(size_t position) { pos = position; }
+
+  private:
+    virtual void Input(char* data, size_t n) override;
+
+    ChMappedFile file;
+    size_t pos;
+};
+
 ///
 /// This is a specialized class for ASCII input on system's file,
 ///
@@ -246,6 +246,13 @@ class ChVector {
 
 CH_CLASS_VERSION(ChVector<double>, 0)
 
+/// Arrays of ChVectors are serialized as raw blocks by archives supporting it (see ChArchiveBlock).
+template <class Real>
+struct ChArchiveBlock<ChVector<Real>> {
+    static const bool value = ChArchiveBlock<Real>::value && sizeof(ChVector<Real>) == 3 * sizeof(Real);
+    typedef ChVector<double> version_type;
+};
+
 // -----------------------------------------------------------------------------
 
 /// Shortcut for faster use of typical double-precision vectors.
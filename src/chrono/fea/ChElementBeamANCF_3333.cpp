@@ -1068,6 +1068,11 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
     // zeta directions for "Full Integration". However, very similar results can be obtained with fewer GQ point in each
     // direction, resulting in significantly fewer calculations.  Based on testing, this could be as low as 3x2x2
 
+    // Fixed-size views of the precomputed shape function derivatives and Gauss quadrature weights
+    Eigen::Map<const MatrixNx3NIP> SD(m_SD.data());
+    Eigen::Map<const VectorNIP_D0> kGQ_D0(m_kGQ_D0.data());
+    Eigen::Map<const VectorNIP_Dv> kGQ_Dv(m_kGQ_Dv.data());
+
     MatrixNx6 ebar_ebardot;
     CalcCombinedCoordMatrix(ebar_ebardot);
 
@@ -1084,7 +1089,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
     //      [F13  F23  F33  F13dot  F23dot  F33dot ] <-- Dv Block (With Poisson Effect)
     // =============================================================================
 
-    ChMatrixNMc<double, 3 * NIP, 6> FC = m_SD.transpose() * ebar_ebardot;
+    ChMatrixNMc<double, 3 * NIP, 6> FC = SD.transpose() * ebar_ebardot;
 
     // =============================================================================
     // =============================================================================
@@ -1123,7 +1128,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
                                    FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2));
     SPK2_1_Block_D0.array() -= 1;
     SPK2_1_Block_D0 += (2 * m_Alpha) * E_BlockDamping_D0;
-    SPK2_1_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_1_Block_D0.array() *= kGQ_D0.array();
     SPK2_1_Block_D0 *= (0.5 * D0(0));
 
     // Each entry in SPK2_2 = D22*kGQ*(E22+alpha*E22dot)
@@ -1138,7 +1143,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
         FC.template block<NIP_D0, 1>(NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2));
     SPK2_2_Block_D0.array() -= 1;
     SPK2_2_Block_D0 += (2 * m_Alpha) * E_BlockDamping_D0;
-    SPK2_2_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_2_Block_D0.array() *= kGQ_D0.array();
     SPK2_2_Block_D0 *= (0.5 * D0(1));
 
     // Each entry in SPK2_3 = D33*kGQ*(E33+alpha*E33dot)
@@ -1153,7 +1158,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
         FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
     SPK2_3_Block_D0.array() -= 1;
     SPK2_3_Block_D0 += (2 * m_Alpha) * E_BlockDamping_D0;
-    SPK2_3_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_3_Block_D0.array() *= kGQ_D0.array();
     SPK2_3_Block_D0 *= (0.5 * D0(2));
 
     // Each entry in SPK2_4 = D44*kGQ*(2*(E23+alpha*E23dot))
@@ -1171,7 +1176,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
         FC.template block<NIP_D0, 1>(NIP_D0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
     SPK2_4_Block_D0 += m_Alpha * E_BlockDamping_D0;
-    SPK2_4_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_4_Block_D0.array() *= kGQ_D0.array();
     SPK2_4_Block_D0 *= D0(3);
 
     // Each entry in SPK2_5 = D55*kGQ*(2*(E13+alpha*E13dot))
@@ -1189,7 +1194,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
         FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
     SPK2_5_Block_D0 += m_Alpha * E_BlockDamping_D0;
-    SPK2_5_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_5_Block_D0.array() *= kGQ_D0.array();
     SPK2_5_Block_D0 *= D0(4);
 
     // Each entry in SPK2_6 = D66*kGQ*(2*(E12+alpha*E12dot))
@@ -1207,7 +1212,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
         FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2));
     SPK2_6_Block_D0 += m_Alpha * E_BlockDamping_D0;
-    SPK2_6_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_6_Block_D0.array() *= kGQ_D0.array();
     SPK2_6_Block_D0 *= D0(5);
 
     // =============================================================================
@@ -1294,7 +1299,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
     E1_Block_Dv.array() -= 1;
     E1_Block_Dv *= 0.5;
     E1_Block_Dv += m_Alpha * E_BlockDamping_Dv;
-    E1_Block_Dv.array() *= m_kGQ_Dv.array();
+    E1_Block_Dv.array() *= kGQ_Dv.array();
 
     // Each entry in E2 = kGQ*(E22+alpha*E22dot)
     //                  = kGQ*(1/2*(F12*F12+F22*F22+F32*F32-1)+alpha*(F12*F12dot+F22*F22dot+F32*F32dot))
@@ -1313,7 +1318,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
     E2_Block_Dv.array() -= 1;
     E2_Block_Dv *= 0.5;
     E2_Block_Dv += m_Alpha * E_BlockDamping_Dv;
-    E2_Block_Dv.array() *= m_kGQ_Dv.array();
+    E2_Block_Dv.array() *= kGQ_Dv.array();
 
     // Each entry in E3 = kGQ*(E33+alpha*E33dot)
     //                  = kGQ*(1/2*(F13*F13+F23*F23+F33*F33-1)+alpha*(F13*F13dot+F23*F23dot+F33*F33dot))
@@ -1332,7 +1337,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
     E3_Block_Dv.array() -= 1;
     E3_Block_Dv *= 0.5;
     E3_Block_Dv += m_Alpha * E_BlockDamping_Dv;
-    E3_Block_Dv.array() *= m_kGQ_Dv.array();
+    E3_Block_Dv.array() *= kGQ_Dv.array();
 
     // =============================================================================
     // Get the upper 3x3 block of the stiffness tensor in 6x6 matrix that accounts for the Poisson effect.  Note that
@@ -1394,7 +1399,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntDamping(ChVectorDynamic
     // force vector in matrix form (in the correct order if its calculated in row-major memory layout)
     // =============================================================================
 
-    MatrixNx3 QiCompact = m_SD * P_Block;
+    MatrixNx3 QiCompact = SD * P_Block;
 
     // =============================================================================
     // Reshape the compact matrix form of the generalized internal force vector (stored using a row-major memory layout)
@@ -1417,6 +1422,11 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
     // "Full Integration". However, very similar results can be obtained with fewer GQ point in each direction,
     // resulting in significantly fewer calculations.  Based on testing, this could be as low as 3x2x2
 
+    // Fixed-size views of the precomputed shape function derivatives and Gauss quadrature weights
+    Eigen::Map<const MatrixNx3NIP> SD(m_SD.data());
+    Eigen::Map<const VectorNIP_D0> kGQ_D0(m_kGQ_D0.data());
+    Eigen::Map<const VectorNIP_Dv> kGQ_Dv(m_kGQ_Dv.data());
+
     Matrix3xN e_bar;
     CalcCoordMatrix(e_bar);
 
@@ -1433,7 +1443,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
     //      [F13  F23  F33 ] <-- Dv Block (With Poisson Effect)
     // =============================================================================
 
-    ChMatrixNMc<double, 3 * NIP, 3> FC = m_SD.transpose() * e_bar.transpose();
+    ChMatrixNMc<double, 3 * NIP, 3> FC = SD.transpose() * e_bar.transpose();
 
     // =============================================================================
     // =============================================================================
@@ -1464,7 +1474,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
                                    FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1)) +
                                    FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2));
     SPK2_1_Block_D0.array() -= 1;
-    SPK2_1_Block_D0.array() *= (0.5 * D0(0)) * m_kGQ_D0.array();
+    SPK2_1_Block_D0.array() *= (0.5 * D0(0)) * kGQ_D0.array();
 
     // Each entry in SPK2_2 = D22*kGQ*E22 = D22*kGQ*1/2*(F12*F12+F22*F22+F32*F32-1)
     VectorNIP_D0 SPK2_2_Block_D0 =
@@ -1472,7 +1482,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
         FC.template block<NIP_D0, 1>(NIP_D0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2));
     SPK2_2_Block_D0.array() -= 1;
-    SPK2_2_Block_D0.array() *= (0.5 * D0(1)) * m_kGQ_D0.array();
+    SPK2_2_Block_D0.array() *= (0.5 * D0(1)) * kGQ_D0.array();
 
     // Each entry in SPK2_3 = D33*kGQ_D0*E33 = D33*kGQ*1/2*(F13*F13+F23*F23+F33*F33-1)
     VectorNIP_D0 SPK2_3_Block_D0 =
@@ -1480,28 +1490,28 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
         FC.template block<NIP_D0, 1>(2 * NIP_D0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
     SPK2_3_Block_D0.array() -= 1;
-    SPK2_3_Block_D0.array() *= (0.5 * D0(2)) * m_kGQ_D0.array();
+    SPK2_3_Block_D0.array() *= (0.5 * D0(2)) * kGQ_D0.array();
 
     // Each entry in SPK2_4 = D44*kGQ*2*E23 = D44*kGQ*(F12*F13+F22*F23+F32*F33)
     VectorNIP_D0 SPK2_4_Block_D0 =
         FC.template block<NIP_D0, 1>(NIP_D0, 0).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0)) +
         FC.template block<NIP_D0, 1>(NIP_D0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
-    SPK2_4_Block_D0.array() *= D0(3) * m_kGQ_D0.array();
+    SPK2_4_Block_D0.array() *= D0(3) * kGQ_D0.array();
 
     // Each entry in SPK2_5 = D55*kGQ*2*E13 = D55*kGQ*(F11*F13+F21*F23+F31*F33)
     VectorNIP_D0 SPK2_5_Block_D0 =
         FC.template block<NIP_D0, 1>(0, 0).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0)) +
         FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
-    SPK2_5_Block_D0.array() *= D0(4) * m_kGQ_D0.array();
+    SPK2_5_Block_D0.array() *= D0(4) * kGQ_D0.array();
 
     // Each entry in SPK2_6 = D66*kGQ*2*E12 = D66*(F11*F12+F21*F22+F31*F32)
     VectorNIP_D0 SPK2_6_Block_D0 =
         FC.template block<NIP_D0, 1>(0, 0).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 0)) +
         FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2));
-    SPK2_6_Block_D0.array() *= D0(5) * m_kGQ_D0.array();
+    SPK2_6_Block_D0.array() *= D0(5) * kGQ_D0.array();
 
     // =============================================================================
     // Calculate the transpose of the 1st Piola-Kirchoff stresses in block tensor form whose entries have been
@@ -1579,7 +1589,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
         FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 1).cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 1)) +
         FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 2).cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 2));
     E1_Block_Dv.array() -= 1;
-    E1_Block_Dv.array() *= 0.5 * m_kGQ_Dv.array();
+    E1_Block_Dv.array() *= 0.5 * kGQ_Dv.array();
 
     // Each entry in E2 = kGQ*E22 = kGQ*1/2*(F12*F12+F22*F22+F32*F32-1)
     VectorNIP_Dv E2_Block_Dv = FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 0)
@@ -1589,7 +1599,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
                                FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 2)
                                    .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 2));
     E2_Block_Dv.array() -= 1;
-    E2_Block_Dv.array() *= 0.5 * m_kGQ_Dv.array();
+    E2_Block_Dv.array() *= 0.5 * kGQ_Dv.array();
 
     // Each entry in E3 = kGQ*E33 = kGQ*1/2*(F13*F13+F23*F23+F33*F33-1)
     VectorNIP_Dv E3_Block_Dv = FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 0)
@@ -1599,7 +1609,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
                                FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 2)
                                    .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 2));
     E3_Block_Dv.array() -= 1;
-    E3_Block_Dv.array() *= 0.5 * m_kGQ_Dv.array();
+    E3_Block_Dv.array() *= 0.5 * kGQ_Dv.array();
 
     // =============================================================================
     // Get the upper 3x3 block of the stiffness tensor in 6x6 matrix that accounts for the Poisson effect.  Note that
@@ -1661,7 +1671,7 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntNoDamping(ChVectorDynam
     // force vector in matrix form (in the correct order if its calculated in row-major memory layout)
     // =============================================================================
 
-    MatrixNx3 QiCompact = m_SD * P_Block;
+    MatrixNx3 QiCompact = SD * P_Block;
 
     // =============================================================================
     // Reshape the compact matrix form of the generalized internal force vector (stored using a row-major memory layout)
@@ -1731,6 +1741,11 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // calculation is performed. For this element, this is likely more efficient than the "Pre-Integration" style
     // calculation method.
 
+    // Fixed-size views of the precomputed shape function derivatives and Gauss quadrature weights
+    Eigen::Map<const MatrixNx3NIP> SD(m_SD.data());
+    Eigen::Map<const VectorNIP_D0> kGQ_D0(m_kGQ_D0.data());
+    Eigen::Map<const VectorNIP_Dv> kGQ_Dv(m_kGQ_Dv.data());
+
     MatrixNx6 ebar_ebardot;
     CalcCombinedCoordMatrix(ebar_ebardot);
 
@@ -1754,7 +1769,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     //      [F13  F23  F33  F13dot  F23dot  F33dot ] <-- Dv Block (With Poisson Effect)
     // =============================================================================
 
-    ChMatrixNMc<double, 3 * NIP, 6> FC = m_SD.transpose() * ebar_ebardot;
+    ChMatrixNMc<double, 3 * NIP, 6> FC = SD.transpose() * ebar_ebardot;
 
     //==============================================================================
     //==============================================================================
@@ -1789,102 +1804,102 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
 
     for (auto i = 0; i < NSF; i++) {
         PE.template block<1, NIP_D0>(3 * i, 0 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(0 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 1 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(1 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 2 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 3 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(1 * NIP_D0, 0).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 4 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(0 * NIP_D0, 0).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 5 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(0 * NIP_D0, 0).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(1 * NIP_D0, 0).transpose());
 
         PE.template block<1, NIP_Dv>(3 * i, 6 * NIP_D0 + 0 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0 * NIP_Dv, 0).transpose());
         PE.template block<1, NIP_Dv>(3 * i, 6 * NIP_D0 + 1 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 1 * NIP_Dv, 0).transpose());
         PE.template block<1, NIP_Dv>(3 * i, 6 * NIP_D0 + 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 0).transpose());
 
         PE.template block<1, NIP_D0>((3 * i) + 1, 0) =
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose());
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, 2 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, 3 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, 4 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose()) +
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, 5 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose()) +
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1).transpose());
 
         PE.template block<1, NIP_Dv>((3 * i) + 1, 6 * NIP_D0 + 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 1).transpose());
         PE.template block<1, NIP_Dv>((3 * i) + 1, 6 * NIP_D0 + NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 1).transpose());
         PE.template block<1, NIP_Dv>((3 * i) + 1, 6 * NIP_D0 + 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 1).transpose());
 
         PE.template block<1, NIP_D0>((3 * i) + 2, 0) =
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose());
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, 2 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, 3 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, 4 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose()) +
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, 5 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose()) +
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2).transpose());
 
         PE.template block<1, NIP_Dv>((3 * i) + 2, 6 * NIP_D0 + 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 2).transpose());
         PE.template block<1, NIP_Dv>((3 * i) + 2, 6 * NIP_D0 + NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 2).transpose());
         PE.template block<1, NIP_Dv>((3 * i) + 2, 6 * NIP_D0 + 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 2).transpose());
     }
 
@@ -1907,12 +1922,12 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
                                                (m_Alpha * Kfactor) * FC.template block<3 * NIP, 3>(0, 3);
 
     for (auto i = 0; i < 3; i++) {
-        FCscaled.template block<NIP_D0, 1>(0, i).array() *= m_kGQ_D0.array();
-        FCscaled.template block<NIP_D0, 1>(NIP_D0, i).array() *= m_kGQ_D0.array();
-        FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, i).array() *= m_kGQ_D0.array();
-        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, i).array() *= m_kGQ_Dv.array();
-        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, i).array() *= m_kGQ_Dv.array();
-        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, i).array() *= m_kGQ_Dv.array();
+        FCscaled.template block<NIP_D0, 1>(0, i).array() *= kGQ_D0.array();
+        FCscaled.template block<NIP_D0, 1>(NIP_D0, i).array() *= kGQ_D0.array();
+        FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, i).array() *= kGQ_D0.array();
+        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, i).array() *= kGQ_Dv.array();
+        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, i).array() *= kGQ_Dv.array();
+        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, i).array() *= kGQ_Dv.array();
     }
 
     // =============================================================================
@@ -1937,78 +1952,78 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
 
     for (auto i = 0; i < NSF; i++) {
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 0) =
-            D0(0) * m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            D0(0) * SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 0).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, NIP_D0) =
-            D0(1) * m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(1) * SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 0).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 2 * NIP_D0) =
-            D0(2) * m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(2) * SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 3 * NIP_D0) =
-            D0(3) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(3) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 0).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 4 * NIP_D0) =
-            D0(4) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(4) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 0).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 5 * NIP_D0) =
-            D0(5) * (m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(5) * (SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 0).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 0).transpose()));
 
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 0) =
-            D0(0) * m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            D0(0) * SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 1).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, NIP_D0) =
-            D0(1) * m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(1) * SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 1).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 2 * NIP_D0) =
-            D0(2) * m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(2) * SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 3 * NIP_D0) =
-            D0(3) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(3) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 1).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 4 * NIP_D0) =
-            D0(4) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(4) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 1).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 5 * NIP_D0) =
-            D0(5) * (m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(5) * (SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 1).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 1).transpose()));
 
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 0) =
-            D0(0) * m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            D0(0) * SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 2).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, NIP_D0) =
-            D0(1) * m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(1) * SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 2).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 2 * NIP_D0) =
-            D0(2) * m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(2) * SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 3 * NIP_D0) =
-            D0(3) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(3) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 2).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 4 * NIP_D0) =
-            D0(4) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(4) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 2).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 5 * NIP_D0) =
-            D0(5) * (m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(5) * (SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 2).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 2).transpose()));
     }
 
@@ -2022,33 +2037,33 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
 
     for (auto i = 0; i < NSF; i++) {
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>(3 * i, 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 0).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>(3 * i, NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 0).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>(3 * i, 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 0).transpose());
 
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 1, 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 1).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 1, NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 1).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 1, 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 1).transpose());
 
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 2, 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 2).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 2, NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 2).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 2, 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 2).transpose());
     }
 
@@ -2119,7 +2134,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
                                    FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2));
     SPK2_1_Block_D0.array() -= 1;
     SPK2_1_Block_D0 += (2 * m_Alpha) * E_BlockDamping_D0;
-    SPK2_1_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_1_Block_D0.array() *= kGQ_D0.array();
     SPK2_1_Block_D0 *= (0.5 * D0(0));
 
     // Each entry in SPK2_2 = D22*kGQ*(E22+alpha*E22dot)
@@ -2134,7 +2149,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         FC.template block<NIP_D0, 1>(NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2));
     SPK2_2_Block_D0.array() -= 1;
     SPK2_2_Block_D0 += (2 * m_Alpha) * E_BlockDamping_D0;
-    SPK2_2_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_2_Block_D0.array() *= kGQ_D0.array();
     SPK2_2_Block_D0 *= (0.5 * D0(1));
 
     // Each entry in SPK2_3 = D33*kGQ*(E33+alpha*E33dot)
@@ -2149,7 +2164,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
     SPK2_3_Block_D0.array() -= 1;
     SPK2_3_Block_D0 += (2 * m_Alpha) * E_BlockDamping_D0;
-    SPK2_3_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_3_Block_D0.array() *= kGQ_D0.array();
     SPK2_3_Block_D0 *= (0.5 * D0(2));
 
     // Each entry in SPK2_4 = D44*kGQ*(2*(E23+alpha*E23dot))
@@ -2167,7 +2182,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         FC.template block<NIP_D0, 1>(NIP_D0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
     SPK2_4_Block_D0 += m_Alpha * E_BlockDamping_D0;
-    SPK2_4_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_4_Block_D0.array() *= kGQ_D0.array();
     SPK2_4_Block_D0 *= D0(3);
 
     // Each entry in SPK2_5 = D55*kGQ*(2*(E13+alpha*E13dot))
@@ -2185,7 +2200,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
     SPK2_5_Block_D0 += m_Alpha * E_BlockDamping_D0;
-    SPK2_5_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_5_Block_D0.array() *= kGQ_D0.array();
     SPK2_5_Block_D0 *= D0(4);
 
     // Each entry in SPK2_6 = D66*kGQ*(2*(E12+alpha*E12dot))
@@ -2203,7 +2218,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2));
     SPK2_6_Block_D0 += m_Alpha * E_BlockDamping_D0;
-    SPK2_6_Block_D0.array() *= m_kGQ_D0.array();
+    SPK2_6_Block_D0.array() *= kGQ_D0.array();
     SPK2_6_Block_D0 *= D0(5);
 
     // =============================================================================
@@ -2227,7 +2242,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     E1_Block_Dv.array() -= 1;
     E1_Block_Dv *= 0.5;
     E1_Block_Dv += m_Alpha * E_BlockDamping_Dv;
-    E1_Block_Dv.array() *= m_kGQ_Dv.array();
+    E1_Block_Dv.array() *= kGQ_Dv.array();
 
     // Each entry in E2 = kGQ*(E22+alpha*E22dot)
     //                  = kGQ*(1/2*(F12*F12+F22*F22+F32*F32-1)+alpha*(F12*F12dot+F22*F22dot+F32*F32dot))
@@ -2246,7 +2261,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     E2_Block_Dv.array() -= 1;
     E2_Block_Dv *= 0.5;
     E2_Block_Dv += m_Alpha * E_BlockDamping_Dv;
-    E2_Block_Dv.array() *= m_kGQ_Dv.array();
+    E2_Block_Dv.array() *= kGQ_Dv.array();
 
     // Each entry in E3 = kGQ*(E33+alpha*E33dot)
     //                  = kGQ*(1/2*(F13*F13+F23*F23+F33*F33-1)+alpha*(F13*F13dot+F23*F23dot+F33*F33dot))
@@ -2265,7 +2280,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     E3_Block_Dv.array() -= 1;
     E3_Block_Dv *= 0.5;
     E3_Block_Dv += m_Alpha * E_BlockDamping_Dv;
-    E3_Block_Dv.array() *= m_kGQ_Dv.array();
+    E3_Block_Dv.array() *= kGQ_Dv.array();
 
     // =============================================================================
     // Calculate the 2nd Piola-Kirchoff stresses in Voigt notation across all the Dv Gauss quadrature points.
@@ -2289,28 +2304,28 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
 
     for (auto i = 0; i < NSF; i++) {
         S_scaled_SD.template block<1, NIP_D0>(i, 0) =
-            SPK2_1_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
-            SPK2_6_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
-            SPK2_5_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
+            SPK2_1_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
+            SPK2_6_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
+            SPK2_5_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
 
         S_scaled_SD.template block<1, NIP_D0>(i, NIP_D0) =
-            SPK2_6_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
-            SPK2_2_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
-            SPK2_4_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
+            SPK2_6_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
+            SPK2_2_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
+            SPK2_4_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
 
         S_scaled_SD.template block<1, NIP_D0>(i, 2 * NIP_D0) =
-            SPK2_5_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
-            SPK2_4_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
-            SPK2_3_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
+            SPK2_5_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
+            SPK2_4_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
+            SPK2_3_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
 
         S_scaled_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0) =
-            SPK2_1_Block_Dv.transpose().cwiseProduct(m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv));
+            SPK2_1_Block_Dv.transpose().cwiseProduct(SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv));
 
         S_scaled_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + NIP_Dv) =
-            SPK2_2_Block_Dv.transpose().cwiseProduct(m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv));
+            SPK2_2_Block_Dv.transpose().cwiseProduct(SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv));
 
         S_scaled_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv) =
-            SPK2_3_Block_Dv.transpose().cwiseProduct(m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv));
+            SPK2_3_Block_Dv.transpose().cwiseProduct(SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv));
     }
 
     // =============================================================================
@@ -2322,10 +2337,14 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // Add in the Mass Matrix Which is Stored in Compact Upper Triangular Form
     ChVectorN<double, (NSF * (NSF + 1)) / 2> ScaledMassMatrix = Mfactor * m_MassMatrix;
 
+    // Contract the shape function derivatives with the scaled stresses for all the Gauss quadrature points in a single
+    // matrix multiplication
+    MatrixNxN K_SD = Kfactor * SD * S_scaled_SD.transpose();
+
     unsigned int idx = 0;
     for (unsigned int i = 0; i < NSF; i++) {
         for (unsigned int j = i; j < NSF; j++) {
-            double d = Kfactor * m_SD.row(i) * S_scaled_SD.row(j).transpose();
+            double d = K_SD(i, j);
             d += ScaledMassMatrix(idx);
 
             H(3 * i, 3 * j) += d;
@@ -2347,6 +2366,11 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // internal force vector is integrated across the volume of the element every time this calculation is performed.
     // For this element, this is likely more efficient than the "Pre-Integration" style calculation method.
 
+    // Fixed-size views of the precomputed shape function derivatives and Gauss quadrature weights
+    Eigen::Map<const MatrixNx3NIP> SD(m_SD.data());
+    Eigen::Map<const VectorNIP_D0> kGQ_D0(m_kGQ_D0.data());
+    Eigen::Map<const VectorNIP_Dv> kGQ_Dv(m_kGQ_Dv.data());
+
     Matrix3xN e_bar;
     CalcCoordMatrix(e_bar);
 
@@ -2370,7 +2394,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     //      [F13  F23  F33 ] <-- Dv Block (With Poisson Effect)
     // =============================================================================
 
-    ChMatrixNMc<double, 3 * NIP, 3> FC = m_SD.transpose() * e_bar.transpose();
+    ChMatrixNMc<double, 3 * NIP, 3> FC = SD.transpose() * e_bar.transpose();
 
     //==============================================================================
     //==============================================================================
@@ -2405,102 +2429,102 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
 
     for (auto i = 0; i < NSF; i++) {
         PE.template block<1, NIP_D0>(3 * i, 0 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(0 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 1 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(1 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 2 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 3 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(1 * NIP_D0, 0).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 4 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(0 * NIP_D0, 0).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose());
         PE.template block<1, NIP_D0>(3 * i, 5 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(0 * NIP_D0, 0).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(1 * NIP_D0, 0).transpose());
 
         PE.template block<1, NIP_Dv>(3 * i, 6 * NIP_D0 + 0 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0 * NIP_Dv, 0).transpose());
         PE.template block<1, NIP_Dv>(3 * i, 6 * NIP_D0 + 1 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 1 * NIP_Dv, 0).transpose());
         PE.template block<1, NIP_Dv>(3 * i, 6 * NIP_D0 + 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 0).transpose());
 
         PE.template block<1, NIP_D0>((3 * i) + 1, 0) =
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose());
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, 2 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, 3 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, 4 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose()) +
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 1, 5 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1).transpose()) +
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1).transpose());
 
         PE.template block<1, NIP_Dv>((3 * i) + 1, 6 * NIP_D0 + 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 1).transpose());
         PE.template block<1, NIP_Dv>((3 * i) + 1, 6 * NIP_D0 + NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 1).transpose());
         PE.template block<1, NIP_Dv>((3 * i) + 1, 6 * NIP_D0 + 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 1).transpose());
 
         PE.template block<1, NIP_D0>((3 * i) + 2, 0) =
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose());
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, 2 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, 3 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, 4 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 2 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose()) +
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose());
         PE.template block<1, NIP_D0>((3 * i) + 2, 5 * NIP_D0) =
-            m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose()) +
-            m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            SD.template block<1, NIP_D0>(i, 1 * NIP_D0).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2).transpose()) +
+            SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                 .cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2).transpose());
 
         PE.template block<1, NIP_Dv>((3 * i) + 2, 6 * NIP_D0 + 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 2).transpose());
         PE.template block<1, NIP_Dv>((3 * i) + 2, 6 * NIP_D0 + NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 2).transpose());
         PE.template block<1, NIP_Dv>((3 * i) + 2, 6 * NIP_D0 + 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 2).transpose());
     }
 
@@ -2512,12 +2536,12 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     ChMatrixNMc<double, 3 * NIP, 3> FCscaled = Kfactor * FC;
 
     for (auto i = 0; i < 3; i++) {
-        FCscaled.template block<NIP_D0, 1>(0, i).array() *= m_kGQ_D0.array();
-        FCscaled.template block<NIP_D0, 1>(NIP_D0, i).array() *= m_kGQ_D0.array();
-        FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, i).array() *= m_kGQ_D0.array();
-        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, i).array() *= m_kGQ_Dv.array();
-        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, i).array() *= m_kGQ_Dv.array();
-        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, i).array() *= m_kGQ_Dv.array();
+        FCscaled.template block<NIP_D0, 1>(0, i).array() *= kGQ_D0.array();
+        FCscaled.template block<NIP_D0, 1>(NIP_D0, i).array() *= kGQ_D0.array();
+        FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, i).array() *= kGQ_D0.array();
+        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, i).array() *= kGQ_Dv.array();
+        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, i).array() *= kGQ_Dv.array();
+        FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, i).array() *= kGQ_Dv.array();
     }
 
     // =============================================================================
@@ -2540,78 +2564,78 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
 
     for (auto i = 0; i < NSF; i++) {
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 0) =
-            D0(0) * m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            D0(0) * SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 0).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, NIP_D0) =
-            D0(1) * m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(1) * SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 0).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 2 * NIP_D0) =
-            D0(2) * m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(2) * SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 3 * NIP_D0) =
-            D0(3) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(3) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 0).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 4 * NIP_D0) =
-            D0(4) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(4) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 0).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 0).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>(3 * i, 5 * NIP_D0) =
-            D0(5) * (m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(5) * (SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 0).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 0).transpose()));
 
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 0) =
-            D0(0) * m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            D0(0) * SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 1).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, NIP_D0) =
-            D0(1) * m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(1) * SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 1).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 2 * NIP_D0) =
-            D0(2) * m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(2) * SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 3 * NIP_D0) =
-            D0(3) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(3) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 1).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 4 * NIP_D0) =
-            D0(4) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(4) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 1).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 1).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 1, 5 * NIP_D0) =
-            D0(5) * (m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(5) * (SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 1).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 1).transpose()));
 
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 0) =
-            D0(0) * m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+            D0(0) * SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 2).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, NIP_D0) =
-            D0(1) * m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(1) * SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 2).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 2 * NIP_D0) =
-            D0(2) * m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(2) * SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                         .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose());
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 3 * NIP_D0) =
-            D0(3) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(3) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 2).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 4 * NIP_D0) =
-            D0(4) * (m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
+            D0(4) * (SD.template block<1, NIP_D0>(i, 2 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 2).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(2 * NIP_D0, 2).transpose()));
         DScaled_Combined_PE.template block<1, NIP_D0>((3 * i) + 2, 5 * NIP_D0) =
-            D0(5) * (m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
+            D0(5) * (SD.template block<1, NIP_D0>(i, 1 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(0, 2).transpose()) +
-                     m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
+                     SD.template block<1, NIP_D0>(i, 0 * NIP_D0)
                          .cwiseProduct(FCscaled.template block<NIP_D0, 1>(NIP_D0, 2).transpose()));
     }
 
@@ -2625,33 +2649,33 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
 
     for (auto i = 0; i < NSF; i++) {
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>(3 * i, 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 0).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>(3 * i, NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 0).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>(3 * i, 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 0).transpose());
 
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 1, 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 1).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 1, NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 1).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 1, 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 1).transpose());
 
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 2, 0) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 2).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 2, NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 2).transpose());
         Scaled_Combined_PE_Dv.template block<1, NIP_Dv>((3 * i) + 2, 2 * NIP_Dv) =
-            m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
+            SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv)
                 .cwiseProduct(FCscaled.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 2).transpose());
     }
 
@@ -2715,7 +2739,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
                                    FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(0, 1)) +
                                    FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(0, 2));
     SPK2_1_Block_D0.array() -= 1;
-    SPK2_1_Block_D0.array() *= (0.5 * D0(0)) * m_kGQ_D0.array();
+    SPK2_1_Block_D0.array() *= (0.5 * D0(0)) * kGQ_D0.array();
 
     // Each entry in SPK2_2 = D22*kGQ*E22 = D22*kGQ*1/2*(F12*F12+F22*F22+F32*F32-1)
     VectorNIP_D0 SPK2_2_Block_D0 =
@@ -2723,7 +2747,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
         FC.template block<NIP_D0, 1>(NIP_D0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2));
     SPK2_2_Block_D0.array() -= 1;
-    SPK2_2_Block_D0.array() *= (0.5 * D0(1)) * m_kGQ_D0.array();
+    SPK2_2_Block_D0.array() *= (0.5 * D0(1)) * kGQ_D0.array();
 
     // Each entry in SPK2_3 = D33*kGQ_D0*E33 = D33*kGQ*1/2*(F13*F13+F23*F23+F33*F33-1)
     VectorNIP_D0 SPK2_3_Block_D0 =
@@ -2731,28 +2755,28 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
         FC.template block<NIP_D0, 1>(2 * NIP_D0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(2 * NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
     SPK2_3_Block_D0.array() -= 1;
-    SPK2_3_Block_D0.array() *= (0.5 * D0(2)) * m_kGQ_D0.array();
+    SPK2_3_Block_D0.array() *= (0.5 * D0(2)) * kGQ_D0.array();
 
     // Each entry in SPK2_4 = D44*kGQ*2*E23 = D44*kGQ*(F12*F13+F22*F23+F32*F33)
     VectorNIP_D0 SPK2_4_Block_D0 =
         FC.template block<NIP_D0, 1>(NIP_D0, 0).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0)) +
         FC.template block<NIP_D0, 1>(NIP_D0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(NIP_D0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
-    SPK2_4_Block_D0.array() *= D0(3) * m_kGQ_D0.array();
+    SPK2_4_Block_D0.array() *= D0(3) * kGQ_D0.array();
 
     // Each entry in SPK2_5 = D55*kGQ*2*E13 = D55*kGQ*(F11*F13+F21*F23+F31*F33)
     VectorNIP_D0 SPK2_5_Block_D0 =
         FC.template block<NIP_D0, 1>(0, 0).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 0)) +
         FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(2 * NIP_D0, 2));
-    SPK2_5_Block_D0.array() *= D0(4) * m_kGQ_D0.array();
+    SPK2_5_Block_D0.array() *= D0(4) * kGQ_D0.array();
 
     // Each entry in SPK2_6 = D66*kGQ*2*E12 = D66*(F11*F12+F21*F22+F31*F32)
     VectorNIP_D0 SPK2_6_Block_D0 =
         FC.template block<NIP_D0, 1>(0, 0).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 0)) +
         FC.template block<NIP_D0, 1>(0, 1).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 1)) +
         FC.template block<NIP_D0, 1>(0, 2).cwiseProduct(FC.template block<NIP_D0, 1>(NIP_D0, 2));
-    SPK2_6_Block_D0.array() *= D0(5) * m_kGQ_D0.array();
+    SPK2_6_Block_D0.array() *= D0(5) * kGQ_D0.array();
 
     // =============================================================================
     // For the Dv Gauss quadrature points:
@@ -2768,7 +2792,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
         FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 1).cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 1)) +
         FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 2).cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 0, 2));
     E1_Block_Dv.array() -= 1;
-    E1_Block_Dv.array() *= 0.5 * m_kGQ_Dv.array();
+    E1_Block_Dv.array() *= 0.5 * kGQ_Dv.array();
 
     // Each entry in E2 = kGQ*E22 = kGQ*1/2*(F12*F12+F22*F22+F32*F32-1)
     VectorNIP_Dv E2_Block_Dv = FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 0)
@@ -2778,7 +2802,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
                                FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 2)
                                    .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + NIP_Dv, 2));
     E2_Block_Dv.array() -= 1;
-    E2_Block_Dv.array() *= 0.5 * m_kGQ_Dv.array();
+    E2_Block_Dv.array() *= 0.5 * kGQ_Dv.array();
 
     // Each entry in E3 = kGQ*E33 = kGQ*1/2*(F13*F13+F23*F23+F33*F33-1)
     VectorNIP_Dv E3_Block_Dv = FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 0)
@@ -2788,7 +2812,7 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
                                FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 2)
                                    .cwiseProduct(FC.template block<NIP_Dv, 1>(3 * NIP_D0 + 2 * NIP_Dv, 2));
     E3_Block_Dv.array() -= 1;
-    E3_Block_Dv.array() *= 0.5 * m_kGQ_Dv.array();
+    E3_Block_Dv.array() *= 0.5 * kGQ_Dv.array();
 
     // =============================================================================
     // Calculate the 2nd Piola-Kirchoff stresses in Voigt notation across all the Dv Gauss quadrature points.
@@ -2812,28 +2836,28 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
 
     for (auto i = 0; i < NSF; i++) {
         S_scaled_SD.template block<1, NIP_D0>(i, 0) =
-            SPK2_1_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
-            SPK2_6_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
-            SPK2_5_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
+            SPK2_1_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
+            SPK2_6_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
+            SPK2_5_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
 
         S_scaled_SD.template block<1, NIP_D0>(i, NIP_D0) =
-            SPK2_6_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
-            SPK2_2_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
-            SPK2_4_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
+            SPK2_6_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
+            SPK2_2_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
+            SPK2_4_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
 
         S_scaled_SD.template block<1, NIP_D0>(i, 2 * NIP_D0) =
-            SPK2_5_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
-            SPK2_4_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
-            SPK2_3_Block_D0.transpose().cwiseProduct(m_SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
+            SPK2_5_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 0 * NIP_D0)) +
+            SPK2_4_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 1 * NIP_D0)) +
+            SPK2_3_Block_D0.transpose().cwiseProduct(SD.template block<1, NIP_D0>(i, 2 * NIP_D0));
 
         S_scaled_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0) =
-            SPK2_1_Block_Dv.transpose().cwiseProduct(m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv));
+            SPK2_1_Block_Dv.transpose().cwiseProduct(SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 0 * NIP_Dv));
 
         S_scaled_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + NIP_Dv) =
-            SPK2_2_Block_Dv.transpose().cwiseProduct(m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv));
+            SPK2_2_Block_Dv.transpose().cwiseProduct(SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 1 * NIP_Dv));
 
         S_scaled_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv) =
-            SPK2_3_Block_Dv.transpose().cwiseProduct(m_SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv));
+            SPK2_3_Block_Dv.transpose().cwiseProduct(SD.template block<1, NIP_Dv>(i, 3 * NIP_D0 + 2 * NIP_Dv));
     }
 
     // =============================================================================
@@ -2845,10 +2869,14 @@ void ChElementBeamANCF_3333::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // Add in the Mass Matrix Which is Stored in Compact Upper Triangular Form
     ChVectorN<double, (NSF * (NSF + 1)) / 2> ScaledMassMatrix = Mfactor * m_MassMatrix;
 
+    // Contract the shape function derivatives with the scaled stresses for all the Gauss quadrature points in a single
+    // matrix multiplication
+    MatrixNxN K_SD = Kfactor * SD * S_scaled_SD.transpose();
+
     unsigned int idx = 0;
     for (unsigned int i = 0; i < NSF; i++) {
         for (unsigned int j = i; j < NSF; j++) {
-            double d = Kfactor * m_SD.row(i) * S_scaled_SD.row(j).transpose();
+            double d = K_SD(i, j);
             d += ScaledMassMatrix(idx);
 
             H(3 * i, 3 * j) += d;
@@ -90,6 +90,7 @@ class ChApi ChElementBeamANCF_3333 : public ChElementBeam, public ChLoadableU, p
     using MatrixNx3c = ChMatrixNMc<double, NSF, 3>;
     using MatrixNx6 = ChMatrixNM<double, NSF, 6>;
     using MatrixNxN = ChMatrixNM<double, NSF, NSF>;
+    using MatrixNx3NIP = ChMatrixNM<double, NSF, 3 * NIP>;
 
     /// Internal force calculation method
     enum class IntFrcMethod {
@@ -25,20 +25,16 @@ void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c
     // GetLog() << "EleIntLoadResidual_F , mFi=" << mFi << "  c=" << c << "\n";
     mFi *= c;
 
-    //// RADU
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    // Note: this is called from within a parallel OMP for loop, but ChMesh only processes in parallel elements that
+    // do not share nodes (see ChMesh::GetNumElementColors). No atomic increment is needed when updating R.
 
     int stride = 0;
     for (int in = 0; in < this->GetNnodes(); in++) {
         int nodedofs = GetNodeNdofs(in);
         // GetLog() << "  in=" << in << "  stride=" << stride << "  nodedofs=" << nodedofs << " offset=" <<
         // GetNodeN(in)->NodeGetOffset_w() << "\n";
-        if (!GetNodeN(in)->GetFixed()) {
-            for (int j = 0; j < nodedofs; j++)
-#pragma omp atomic
-                R(GetNodeN(in)->NodeGetOffset_w() + j) += mFi(stride + j);
-        }
+        if (!GetNodeN(in)->GetFixed())
+            R.segment(GetNodeN(in)->NodeGetOffset_w(), nodedofs) += mFi.segment(stride, nodedofs);
         stride += nodedofs;
     }
     // GetLog() << "EleIntLoadResidual_F , R=" << R << "\n";
@@ -86,12 +82,9 @@ void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const
     int stride = 0;
     for (int in = 0; in < this->GetNnodes(); in++) {
         int nodedofs = GetNodeNdofs(in);
-        if (!GetNodeN(in)->GetFixed()) {
-            for (int j = 0; j < nodedofs; j++)
-                //// ATOMIC as called from an OMP parallel loop: this is here to avoid race conditions when writing to R
-                #pragma omp atomic  
-                R(GetNodeN(in)->NodeGetOffset_w() + j) += mFg(stride + j);
-        }
+        // No atomic increment needed, as ChMesh only processes in parallel elements that do not share nodes
+        if (!GetNodeN(in)->GetFixed())
+            R.segment(GetNodeN(in)->NodeGetOffset_w(), nodedofs) += mFg.segment(stride, nodedofs);
         stride += nodedofs;
     }
 
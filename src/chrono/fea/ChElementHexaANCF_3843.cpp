@@ -1016,6 +1016,10 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
     // Integration". However, very similar results can be obtained with fewer GQ point in each direction, resulting in
     // significantly fewer calculations.  Based on testing, this could be as low as 4x4x4
 
+    // Fixed-size views of the precomputed shape function derivatives and Gauss quadrature weights
+    Eigen::Map<const MatrixNx3NIP> SD(m_SD.data());
+    Eigen::Map<const VectorNIP> kGQ(m_kGQ.data());
+
     MatrixNx6 ebar_ebardot;
     CalcCombinedCoordMatrix(ebar_ebardot);
 
@@ -1029,14 +1033,14 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
     //      [F13  F23  F33  F13dot  F23dot  F33dot ]
     // =============================================================================
 
-    ChMatrixNMc<double, 3 * NIP, 6> FC = m_SD.transpose() * ebar_ebardot;
+    ChMatrixNMc<double, 3 * NIP, 6> FC = SD.transpose() * ebar_ebardot;
 
     // =============================================================================
     // Calculate each individual value of the Green-Lagrange strain component by component across all the
     // Gauss-Quadrature points at a time to better leverage vectorized CPU instructions.
     // Note that the scaled time derivatives of the Green-Lagrange strain are added to make the later calculation of
     // the 2nd Piola-Kirchoff stresses more efficient.  The combined result is then scaled by minus the Gauss
-    // quadrature weight times the element Jacobian at the corresponding Gauss point (m_kGQ) again for efficiency.
+    // quadrature weight times the element Jacobian at the corresponding Gauss point (kGQ) again for efficiency.
     // Results are written in Voigt notation: epsilon = [E11,E22,E33,2*E23,2*E13,2*E12]
     // =============================================================================
 
@@ -1051,7 +1055,7 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
     E1_Block.array() -= 1;
     E1_Block *= 0.5;
     E1_Block += m_Alpha * E_BlockDamping;
-    E1_Block.array() *= m_kGQ.array();
+    E1_Block.array() *= kGQ.array();
 
     // Each entry in E2 = kGQ*(E22+alpha*E22dot)
     //                  = kGQ*(1/2*(F12*F12+F22*F22+F32*F32-1)+alpha*(F12*F12dot+F22*F22dot+F32*F32dot))
@@ -1064,7 +1068,7 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
     E2_Block.array() -= 1;
     E2_Block *= 0.5;
     E2_Block += m_Alpha * E_BlockDamping;
-    E2_Block.array() *= m_kGQ.array();
+    E2_Block.array() *= kGQ.array();
 
     // Each entry in E3 = kGQ*(E33+alpha*E33dot)
     //                  = kGQ*(1/2*(F13*F13+F23*F23+F33*F33-1)+alpha*(F13*F13dot+F23*F23dot+F33*F33dot))
@@ -1078,7 +1082,7 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
     E3_Block.array() -= 1;
     E3_Block *= 0.5;
     E3_Block += m_Alpha * E_BlockDamping;
-    E3_Block.array() *= m_kGQ.array();
+    E3_Block.array() *= kGQ.array();
 
     // Each entry in E4 = kGQ*(2*(E23+alpha*E23dot))
     //                  = kGQ*((F12*F13+F22*F23+F32*F33)
@@ -1093,7 +1097,7 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
                          FC.template block<NIP, 1>(NIP, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(NIP, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
     E4_Block += m_Alpha * E_BlockDamping;
-    E4_Block.array() *= m_kGQ.array();
+    E4_Block.array() *= kGQ.array();
 
     // Each entry in E5 = kGQ*(2*(E13+alpha*E13dot))
     //                  = kGQ*((F11*F13+F21*F23+F31*F33)
@@ -1108,7 +1112,7 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
     E5_Block += m_Alpha * E_BlockDamping;
-    E5_Block.array() *= m_kGQ.array();
+    E5_Block.array() *= kGQ.array();
 
     // Each entry in E6 = kGQ*(2*(E12+alpha*E12dot))
     //                  = kGQ*((F11*F12+F21*F22+F31*F32)
@@ -1123,7 +1127,7 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(NIP, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(NIP, 2));
     E6_Block += m_Alpha * E_BlockDamping;
-    E6_Block.array() *= m_kGQ.array();
+    E6_Block.array() *= kGQ.array();
 
     // =============================================================================
     // Get the stiffness tensor in 6x6 matrix form
@@ -1199,7 +1203,7 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntDamping(ChVectorDynamic
     // force vector in matrix form (in the correct order if its calculated in row-major memory layout)
     // =============================================================================
 
-    MatrixNx3 QiCompact = m_SD * P_Block;
+    MatrixNx3 QiCompact = SD * P_Block;
 
     // =============================================================================
     // Reshape the compact matrix form of the generalized internal force vector (stored using a row-major memory layout)
@@ -1222,6 +1226,10 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntNoDamping(ChVectorDynam
     // similar results can be obtained with fewer GQ point in each direction, resulting in significantly fewer
     // calculations.  Based on testing, this could be as low as 4x4x4
 
+    // Fixed-size views of the precomputed shape function derivatives and Gauss quadrature weights
+    Eigen::Map<const MatrixNx3NIP> SD(m_SD.data());
+    Eigen::Map<const VectorNIP> kGQ(m_kGQ.data());
+
     Matrix3xN e_bar;
     CalcCoordMatrix(e_bar);
 
@@ -1235,13 +1243,13 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntNoDamping(ChVectorDynam
     //      [F13  F23  F33 ]
     // =============================================================================
 
-    ChMatrixNMc<double, 3 * NIP, 3> FC = m_SD.transpose() * e_bar.transpose();
+    ChMatrixNMc<double, 3 * NIP, 3> FC = SD.transpose() * e_bar.transpose();
 
     // =============================================================================
     // Calculate each individual value of the Green-Lagrange strain component by component across all the
     // Gauss-Quadrature points at a time to better leverage vectorized CPU instructions.
     // The result is then scaled by minus the Gauss quadrature weight times the element Jacobian at the
-    // corresponding Gauss point (m_kGQ) for efficiency.
+    // corresponding Gauss point (kGQ) for efficiency.
     // Results are written in Voigt notation: epsilon = [E11,E22,E33,2*E23,2*E13,2*E12]
     // =============================================================================
 
@@ -1250,39 +1258,39 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntNoDamping(ChVectorDynam
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(0, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(0, 2));
     E1_Block.array() -= 1;
-    E1_Block.array() *= 0.5 * m_kGQ.array();
+    E1_Block.array() *= 0.5 * kGQ.array();
 
     // Each entry in E2 = kGQ*E22 = kGQ*1/2*(F12*F12+F22*F22+F32*F32-1)
     VectorNIP E2_Block = FC.template block<NIP, 1>(NIP, 0).cwiseProduct(FC.template block<NIP, 1>(NIP, 0)) +
                          FC.template block<NIP, 1>(NIP, 1).cwiseProduct(FC.template block<NIP, 1>(NIP, 1)) +
                          FC.template block<NIP, 1>(NIP, 2).cwiseProduct(FC.template block<NIP, 1>(NIP, 2));
     E2_Block.array() -= 1;
-    E2_Block.array() *= 0.5 * m_kGQ.array();
+    E2_Block.array() *= 0.5 * kGQ.array();
 
     // Each entry in E3 = kGQ*E33 = kGQ*1/2*(F13*F13+F23*F23+F33*F33-1)
     VectorNIP E3_Block = FC.template block<NIP, 1>(2 * NIP, 0).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0)) +
                          FC.template block<NIP, 1>(2 * NIP, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(2 * NIP, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
     E3_Block.array() -= 1;
-    E3_Block.array() *= 0.5 * m_kGQ.array();
+    E3_Block.array() *= 0.5 * kGQ.array();
 
     // Each entry in E4 = kGQ*2*E23 = kGQ*(F12*F13+F22*F23+F32*F33)
     VectorNIP E4_Block = FC.template block<NIP, 1>(NIP, 0).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0)) +
                          FC.template block<NIP, 1>(NIP, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(NIP, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
-    E4_Block.array() *= m_kGQ.array();
+    E4_Block.array() *= kGQ.array();
 
     // Each entry in E5 = kGQ*2*E13 = kGQ*(F11*F13+F21*F23+F31*F33)
     VectorNIP E5_Block = FC.template block<NIP, 1>(0, 0).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0)) +
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
-    E5_Block.array() *= m_kGQ.array();
+    E5_Block.array() *= kGQ.array();
 
     // Each entry in E6 = kGQ*2*E12 = (F11*F12+F21*F22+F31*F32)
     VectorNIP E6_Block = FC.template block<NIP, 1>(0, 0).cwiseProduct(FC.template block<NIP, 1>(NIP, 0)) +
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(NIP, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(NIP, 2));
-    E6_Block.array() *= m_kGQ.array();
+    E6_Block.array() *= kGQ.array();
 
     // =============================================================================
     // Get the stiffness tensor in 6x6 matrix form
@@ -1358,7 +1366,7 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntNoDamping(ChVectorDynam
     // force vector in matrix form (in the correct order if its calculated in row-major memory layout)
     // =============================================================================
 
-    MatrixNx3 QiCompact = m_SD * P_Block;
+    MatrixNx3 QiCompact = SD * P_Block;
 
     // =============================================================================
     // Reshape the compact matrix form of the generalized internal force vector (stored using a row-major memory layout)
@@ -1429,6 +1437,10 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // calculation is performed. For this element, this is likely more efficient than the "Pre-Integration" style
     // calculation method.
 
+    // Fixed-size views of the precomputed shape function derivatives and Gauss quadrature weights
+    Eigen::Map<const MatrixNx3NIP> SD(m_SD.data());
+    Eigen::Map<const VectorNIP> kGQ(m_kGQ.data());
+
     MatrixNx6 ebar_ebardot;
     CalcCombinedCoordMatrix(ebar_ebardot);
 
@@ -1449,7 +1461,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     //      [F13  F23  F33  F13dot  F23dot  F33dot ]
     // =============================================================================
 
-    ChMatrixNMc<double, 3 * NIP, 6> FC = m_SD.transpose() * ebar_ebardot;
+    ChMatrixNMc<double, 3 * NIP, 6> FC = SD.transpose() * ebar_ebardot;
 
     //==============================================================================
     //==============================================================================
@@ -1477,52 +1489,52 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
 
     for (auto i = 0; i < NSF; i++) {
         PE.block<1, NIP>(3 * i, 0 * NIP) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0 * NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 1 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(1 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(1 * NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(1 * NIP, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(1 * NIP, 0).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0 * NIP, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0 * NIP, 0).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0 * NIP, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(1 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0 * NIP, 0).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(1 * NIP, 0).transpose());
 
         PE.block<1, NIP>((3 * i) + 1, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose());
 
         PE.block<1, NIP>((3 * i) + 2, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose());
     }
 
     // =============================================================================
@@ -1541,9 +1553,9 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
                                                (m_Alpha * Kfactor) * FC.template block<3 * NIP, 3>(0, 3);
 
     for (auto i = 0; i < 3; i++) {
-        FCscaled.template block<NIP, 1>(0, i).array() *= m_kGQ.array();
-        FCscaled.template block<NIP, 1>(NIP, i).array() *= m_kGQ.array();
-        FCscaled.template block<NIP, 1>(2 * NIP, i).array() *= m_kGQ.array();
+        FCscaled.template block<NIP, 1>(0, i).array() *= kGQ.array();
+        FCscaled.template block<NIP, 1>(NIP, i).array() *= kGQ.array();
+        FCscaled.template block<NIP, 1>(2 * NIP, i).array() *= kGQ.array();
     }
 
     // =============================================================================
@@ -1561,52 +1573,52 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
 
     for (auto i = 0; i < NSF; i++) {
         Scaled_Combined_PE.block<1, NIP>(3 * i, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose());
 
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose());
 
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose());
     }
 
     // =============================================================================
@@ -1684,7 +1696,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // Gauss-Quadrature points at a time to better leverage vectorized CPU instructions.
     // Note that the scaled time derivatives of the Green-Lagrange strain are added to make the later calculation of
     // the 2nd Piola-Kirchoff stresses more efficient.  The combined result is then scaled by minus the Gauss
-    // quadrature weight times the element Jacobian at the corresponding Gauss point (m_kGQ) again for efficiency.
+    // quadrature weight times the element Jacobian at the corresponding Gauss point (kGQ) again for efficiency.
     // Results are written in Voigt notation: epsilon = [E11,E22,E33,2*E23,2*E13,2*E12]
     // =============================================================================
 
@@ -1699,7 +1711,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     E1_Block.array() -= 1;
     E1_Block *= 0.5;
     E1_Block += m_Alpha * E_BlockDamping;
-    E1_Block.array() *= m_kGQ.array();
+    E1_Block.array() *= kGQ.array();
 
     // Each entry in E2 = kGQ*(E22+alpha*E22dot)
     //                  = kGQ*(1/2*(F12*F12+F22*F22+F32*F32-1)+alpha*(F12*F12dot+F22*F22dot+F32*F32dot))
@@ -1712,7 +1724,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     E2_Block.array() -= 1;
     E2_Block *= 0.5;
     E2_Block += m_Alpha * E_BlockDamping;
-    E2_Block.array() *= m_kGQ.array();
+    E2_Block.array() *= kGQ.array();
 
     // Each entry in E3 = kGQ*(E33+alpha*E33dot)
     //                  = kGQ*(1/2*(F13*F13+F23*F23+F33*F33-1)+alpha*(F13*F13dot+F23*F23dot+F33*F33dot))
@@ -1726,7 +1738,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     E3_Block.array() -= 1;
     E3_Block *= 0.5;
     E3_Block += m_Alpha * E_BlockDamping;
-    E3_Block.array() *= m_kGQ.array();
+    E3_Block.array() *= kGQ.array();
 
     // Each entry in E4 = kGQ*(2*(E23+alpha*E23dot))
     //                  = kGQ*((F12*F13+F22*F23+F32*F33)
@@ -1741,7 +1753,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
                          FC.template block<NIP, 1>(NIP, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(NIP, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
     E4_Block += m_Alpha * E_BlockDamping;
-    E4_Block.array() *= m_kGQ.array();
+    E4_Block.array() *= kGQ.array();
 
     // Each entry in E5 = kGQ*(2*(E13+alpha*E13dot))
     //                  = kGQ*((F11*F13+F21*F23+F31*F33)
@@ -1756,7 +1768,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
     E5_Block += m_Alpha * E_BlockDamping;
-    E5_Block.array() *= m_kGQ.array();
+    E5_Block.array() *= kGQ.array();
 
     // Each entry in E6 = kGQ*(2*(E12+alpha*E12dot))
     //                  = kGQ*((F11*F12+F21*F22+F31*F32)
@@ -1771,7 +1783,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(NIP, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(NIP, 2));
     E6_Block += m_Alpha * E_BlockDamping;
-    E6_Block.array() *= m_kGQ.array();
+    E6_Block.array() *= kGQ.array();
 
     // =============================================================================
     // Calculate the 2nd Piola-Kirchoff stresses in Voigt notation across all the Gauss quadrature points at a time
@@ -1803,19 +1815,19 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
 
     for (auto i = 0; i < NSF; i++) {
         S_scaled_SD.template block<1, NIP>(i, 0) =
-            SPK2_1_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 0 * NIP)) +
-            SPK2_6_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 1 * NIP)) +
-            SPK2_5_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 2 * NIP));
+            SPK2_1_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 0 * NIP)) +
+            SPK2_6_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 1 * NIP)) +
+            SPK2_5_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 2 * NIP));
 
         S_scaled_SD.template block<1, NIP>(i, NIP) =
-            SPK2_6_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 0 * NIP)) +
-            SPK2_2_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 1 * NIP)) +
-            SPK2_4_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 2 * NIP));
+            SPK2_6_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 0 * NIP)) +
+            SPK2_2_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 1 * NIP)) +
+            SPK2_4_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 2 * NIP));
 
         S_scaled_SD.template block<1, NIP>(i, 2 * NIP) =
-            SPK2_5_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 0 * NIP)) +
-            SPK2_4_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 1 * NIP)) +
-            SPK2_3_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 2 * NIP));
+            SPK2_5_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 0 * NIP)) +
+            SPK2_4_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 1 * NIP)) +
+            SPK2_3_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 2 * NIP));
     }
 
     // =============================================================================
@@ -1827,10 +1839,14 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntDamping(ChMatrixRef&
     // Add in the Mass Matrix Which is Stored in Compact Upper Triangular Form
     ChVectorN<double, (NSF * (NSF + 1)) / 2> ScaledMassMatrix = Mfactor * m_MassMatrix;
 
+    // Contract the shape function derivatives with the scaled stresses for all the Gauss quadrature points in a single
+    // matrix multiplication
+    MatrixNxN K_SD = Kfactor * SD * S_scaled_SD.transpose();
+
     unsigned int idx = 0;
     for (unsigned int i = 0; i < NSF; i++) {
         for (unsigned int j = i; j < NSF; j++) {
-            double d = Kfactor * m_SD.row(i) * S_scaled_SD.row(j).transpose();
+            double d = K_SD(i, j);
             d += ScaledMassMatrix(idx);
 
             H(3 * i, 3 * j) += d;
@@ -1852,6 +1868,10 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // internal force vector is integrated across the volume of the element every time this calculation is performed.
     // For this element, this is likely more efficient than the "Pre-Integration" style calculation method.
 
+    // Fixed-size views of the precomputed shape function derivatives and Gauss quadrature weights
+    Eigen::Map<const MatrixNx3NIP> SD(m_SD.data());
+    Eigen::Map<const VectorNIP> kGQ(m_kGQ.data());
+
     Matrix3xN e_bar;
     CalcCoordMatrix(e_bar);
 
@@ -1871,7 +1891,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // FC = [F12  F22  F32 ]
     //      [F13  F23  F33 ]
     // =============================================================================
-    ChMatrixNMc<double, 3 * NIP, 3> FC = m_SD.transpose() * e_bar.transpose();
+    ChMatrixNMc<double, 3 * NIP, 3> FC = SD.transpose() * e_bar.transpose();
 
     //==============================================================================
     //==============================================================================
@@ -1898,52 +1918,52 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
 
     for (auto i = 0; i < NSF; i++) {
         PE.block<1, NIP>(3 * i, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 0).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 0).transpose());
         PE.block<1, NIP>(3 * i, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 0).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 0).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 0).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0).transpose());
         PE.block<1, NIP>(3 * i, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 0).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 0).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 0).transpose());
 
         PE.block<1, NIP>((3 * i) + 1, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1).transpose());
         PE.block<1, NIP>((3 * i) + 1, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 1).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 1).transpose());
 
         PE.block<1, NIP>((3 * i) + 2, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2).transpose());
         PE.block<1, NIP>((3 * i) + 2, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FC.template block<NIP, 1>(0, 2).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FC.template block<NIP, 1>(NIP, 2).transpose());
     }
 
     // =============================================================================
@@ -1953,9 +1973,9 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     ChMatrixNMc<double, 3 * NIP, 3> FCscaled = Kfactor * FC;
 
     for (auto i = 0; i < 3; i++) {
-        FCscaled.template block<NIP, 1>(0, i).array() *= m_kGQ.array();
-        FCscaled.template block<NIP, 1>(NIP, i).array() *= m_kGQ.array();
-        FCscaled.template block<NIP, 1>(2 * NIP, i).array() *= m_kGQ.array();
+        FCscaled.template block<NIP, 1>(0, i).array() *= kGQ.array();
+        FCscaled.template block<NIP, 1>(NIP, i).array() *= kGQ.array();
+        FCscaled.template block<NIP, 1>(2 * NIP, i).array() *= kGQ.array();
     }
 
     // =============================================================================
@@ -1970,52 +1990,52 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
 
     for (auto i = 0; i < NSF; i++) {
         Scaled_Combined_PE.block<1, NIP>(3 * i, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 0).transpose());
         Scaled_Combined_PE.block<1, NIP>(3 * i, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 0).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 0).transpose());
 
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 1).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 1, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 1).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 1).transpose());
 
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 0) =
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose());
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 2 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 3 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose()) +
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 4 * NIP) =
-            m_SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
+            SD.block<1, NIP>(i, 2 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(2 * NIP, 2).transpose());
         Scaled_Combined_PE.block<1, NIP>((3 * i) + 2, 5 * NIP) =
-            m_SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose()) +
-            m_SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose());
+            SD.block<1, NIP>(i, 1 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(0, 2).transpose()) +
+            SD.block<1, NIP>(i, 0 * NIP).cwiseProduct(FCscaled.template block<NIP, 1>(NIP, 2).transpose());
     }
 
     // =============================================================================
@@ -2091,7 +2111,7 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // Calculate each individual value of the Green-Lagrange strain component by component across all the
     // Gauss-Quadrature points at a time to better leverage vectorized CPU instructions.
     // The result is then scaled by minus the Gauss quadrature weight times the element Jacobian at the
-    // corresponding Gauss point (m_kGQ) for efficiency.
+    // corresponding Gauss point (kGQ) for efficiency.
     // Results are written in Voigt notation: epsilon = [E11,E22,E33,2*E23,2*E13,2*E12]
     // =============================================================================
 
@@ -2100,39 +2120,39 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(0, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(0, 2));
     E1_Block.array() -= 1;
-    E1_Block.array() *= 0.5 * m_kGQ.array();
+    E1_Block.array() *= 0.5 * kGQ.array();
 
     // Each entry in E2 = kGQ*E22 = kGQ*1/2*(F12*F12+F22*F22+F32*F32-1)
     VectorNIP E2_Block = FC.template block<NIP, 1>(NIP, 0).cwiseProduct(FC.template block<NIP, 1>(NIP, 0)) +
                          FC.template block<NIP, 1>(NIP, 1).cwiseProduct(FC.template block<NIP, 1>(NIP, 1)) +
                          FC.template block<NIP, 1>(NIP, 2).cwiseProduct(FC.template block<NIP, 1>(NIP, 2));
     E2_Block.array() -= 1;
-    E2_Block.array() *= 0.5 * m_kGQ.array();
+    E2_Block.array() *= 0.5 * kGQ.array();
 
     // Each entry in E3 = kGQ*E33 = kGQ*1/2*(F13*F13+F23*F23+F33*F33-1)
     VectorNIP E3_Block = FC.template block<NIP, 1>(2 * NIP, 0).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0)) +
                          FC.template block<NIP, 1>(2 * NIP, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(2 * NIP, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
     E3_Block.array() -= 1;
-    E3_Block.array() *= 0.5 * m_kGQ.array();
+    E3_Block.array() *= 0.5 * kGQ.array();
 
     // Each entry in E4 = kGQ*2*E23 = kGQ*(F12*F13+F22*F23+F32*F33)
     VectorNIP E4_Block = FC.template block<NIP, 1>(NIP, 0).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0)) +
                          FC.template block<NIP, 1>(NIP, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(NIP, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
-    E4_Block.array() *= m_kGQ.array();
+    E4_Block.array() *= kGQ.array();
 
     // Each entry in E5 = kGQ*2*E13 = kGQ*(F11*F13+F21*F23+F31*F33)
     VectorNIP E5_Block = FC.template block<NIP, 1>(0, 0).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 0)) +
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(2 * NIP, 2));
-    E5_Block.array() *= m_kGQ.array();
+    E5_Block.array() *= kGQ.array();
 
     // Each entry in E6 = kGQ*2*E12 = (F11*F12+F21*F22+F31*F32)
     VectorNIP E6_Block = FC.template block<NIP, 1>(0, 0).cwiseProduct(FC.template block<NIP, 1>(NIP, 0)) +
                          FC.template block<NIP, 1>(0, 1).cwiseProduct(FC.template block<NIP, 1>(NIP, 1)) +
                          FC.template block<NIP, 1>(0, 2).cwiseProduct(FC.template block<NIP, 1>(NIP, 2));
-    E6_Block.array() *= m_kGQ.array();
+    E6_Block.array() *= kGQ.array();
 
     // =============================================================================
     // Calculate the 2nd Piola-Kirchoff stresses in Voigt notation across all the Gauss quadrature points at a time
@@ -2164,19 +2184,19 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
 
     for (auto i = 0; i < NSF; i++) {
         S_scaled_SD.template block<1, NIP>(i, 0) =
-            SPK2_1_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 0 * NIP)) +
-            SPK2_6_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 1 * NIP)) +
-            SPK2_5_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 2 * NIP));
+            SPK2_1_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 0 * NIP)) +
+            SPK2_6_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 1 * NIP)) +
+            SPK2_5_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 2 * NIP));
 
         S_scaled_SD.template block<1, NIP>(i, NIP) =
-            SPK2_6_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 0 * NIP)) +
-            SPK2_2_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 1 * NIP)) +
-            SPK2_4_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 2 * NIP));
+            SPK2_6_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 0 * NIP)) +
+            SPK2_2_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 1 * NIP)) +
+            SPK2_4_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 2 * NIP));
 
         S_scaled_SD.template block<1, NIP>(i, 2 * NIP) =
-            SPK2_5_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 0 * NIP)) +
-            SPK2_4_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 1 * NIP)) +
-            SPK2_3_Block.transpose().cwiseProduct(m_SD.block<1, NIP>(i, 2 * NIP));
+            SPK2_5_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 0 * NIP)) +
+            SPK2_4_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 1 * NIP)) +
+            SPK2_3_Block.transpose().cwiseProduct(SD.block<1, NIP>(i, 2 * NIP));
     }
 
     // =============================================================================
@@ -2188,10 +2208,14 @@ void ChElementHexaANCF_3843::ComputeInternalJacobianContIntNoDamping(ChMatrixRef
     // Add in the Mass Matrix Which is Stored in Compact Upper Triangular Form
     ChVectorN<double, (NSF * (NSF + 1)) / 2> ScaledMassMatrix = Mfactor * m_MassMatrix;
 
+    // Contract the shape function derivatives with the scaled stresses for all the Gauss quadrature points in a single
+    // matrix multiplication
+    MatrixNxN K_SD = Kfactor * SD * S_scaled_SD.transpose();
+
     unsigned int idx = 0;
     for (unsigned int i = 0; i < NSF; i++) {
         for (unsigned int j = i; j < NSF; j++) {
-            double d = Kfactor * m_SD.row(i) * S_scaled_SD.row(j).transpose();
+            double d = K_SD(i, j);
             d += ScaledMassMatrix(idx);
 
             H(3 * i, 3 * j) += d;
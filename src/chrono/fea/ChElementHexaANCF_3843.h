@@ -93,6 +93,7 @@ class ChApi ChElementHexaANCF_3843 : public ChElementHexahedron, public ChElemen
     using MatrixNx3c = ChMatrixNMc<double, NSF, 3>;
     using MatrixNx6 = ChMatrixNM<double, NSF, 6>;
     using MatrixNxN = ChMatrixNM<double, NSF, NSF>;
+    using MatrixNx3NIP = ChMatrixNM<double, NSF, 3 * NIP>;
 
     /// Internal force calculation method
     enum class IntFrcMethod {
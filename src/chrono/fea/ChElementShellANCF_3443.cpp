@@ -1951,11 +1951,15 @@ void ChElementShellANCF_3443::ComputeInternalJacobianContIntDamping(ChMatrixRef&
         // matrix and then expand them out to full size by summing the contribution into the correct locations of the
         // full sized Jacobian matrix
         // =============================================================================
+
+        // Contract the shape function derivatives with the scaled stresses for all the Gauss quadrature points of
+        // the layer in a single matrix multiplication
+        MatrixNxN K_SD = Kfactor * m_SD.block<NSF, 3 * NIP>(0, 3 * kl * NIP) * S_scaled_SD.transpose();
+
         unsigned int idx = 0;
         for (unsigned int i = 0; i < NSF; i++) {
             for (unsigned int j = i; j < NSF; j++) {
-                double d = Kfactor * m_SD.block<1, 3 * NIP>(i, 3 * kl * NIP) *
-                           S_scaled_SD.template block<1, 3 * NIP>(j, 0).transpose();
+                double d = K_SD(i, j);
 
                 H(3 * i, 3 * j) += d;
                 H(3 * i + 1, 3 * j + 1) += d;
@@ -2354,11 +2358,15 @@ void ChElementShellANCF_3443::ComputeInternalJacobianContIntNoDamping(ChMatrixRe
         // matrix and then expand them out to full size by summing the contribution into the correct locations of the
         // full sized Jacobian matrix
         // =============================================================================
+
+        // Contract the shape function derivatives with the scaled stresses for all the Gauss quadrature points of
+        // the layer in a single matrix multiplication
+        MatrixNxN K_SD = Kfactor * m_SD.block<NSF, 3 * NIP>(0, 3 * kl * NIP) * S_scaled_SD.transpose();
+
         unsigned int idx = 0;
         for (unsigned int i = 0; i < NSF; i++) {
             for (unsigned int j = i; j < NSF; j++) {
-                double d = Kfactor * m_SD.block<1, 3 * NIP>(i, 3 * kl * NIP) *
-                           S_scaled_SD.template block<1, 3 * NIP>(j, 0).transpose();
+                double d = K_SD(i, j);
 
                 H(3 * i, 3 * j) += d;
                 H(3 * i + 1, 3 * j + 1) += d;
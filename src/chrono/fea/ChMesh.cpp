@@ -18,11 +18,13 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChTracer.h"
 
 #include "chrono/fea/ChElementTetraCorot_4.h"
 #include "chrono/fea/ChMesh.h"
@@ -47,6 +49,8 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    coloring_valid = false;
 }
 
 void ChMesh::SetupInitial() {
@@ -94,6 +98,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    coloring_valid = false;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -104,6 +109,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
 
 void ChMesh::ClearElements() {
     velements.clear();
+    coloring_valid = false;
     vcontactsurfaces.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
@@ -114,6 +120,7 @@ void ChMesh::ClearElements() {
 
 void ChMesh::ClearNodes() {
     velements.clear();
+    coloring_valid = false;
     vnodes.clear();
     vcontactsurfaces.clear();
 
@@ -152,11 +159,102 @@ void ChMesh::Setup() {
             n_dofs_w += vnodes[i]->Get_ndof_w();
         }
     }
+
+    // Color the elements (only if elements were added or removed)
+    if (!coloring_valid)
+        ColorElements();
+}
+
+// Maximum number of element colors processed in parallel. Elements that cannot be assigned one of these colors are
+// processed sequentially after all colors.
+static const int MAX_ELEMENT_COLORS = 63;
+
+void ChMesh::ColorElements() {
+    // Greedy (first fit) coloring. Each node keeps a bit mask of the colors of the elements connected to it.
+    // Fixed nodes are also considered, so that the coloring does not depend on the nodes' fixed state.
+    std::unordered_map<ChNodeFEAbase*, uint64_t> node_mask;
+    node_mask.reserve(vnodes.size());
+
+    int num_elements = (int)velements.size();
+    std::vector<int> elem_color(num_elements);
+    std::vector<int> color_count(MAX_ELEMENT_COLORS + 1, 0);
+
+    for (int ie = 0; ie < num_elements; ie++) {
+        auto& elem = velements[ie];
+        int num_nodes = elem->GetNnodes();
+
+        uint64_t used = 0;
+        for (int in = 0; in < num_nodes; in++)
+            used |= node_mask[elem->GetNodeN(in).get()];
+
+        int color = MAX_ELEMENT_COLORS;
+        for (int c = 0; c < MAX_ELEMENT_COLORS; c++) {
+            if (!(used & (uint64_t(1) << c))) {
+                color = c;
+                break;
+            }
+        }
+
+        if (color < MAX_ELEMENT_COLORS) {
+            for (int in = 0; in < num_nodes; in++)
+                node_mask[elem->GetNodeN(in).get()] |= (uint64_t(1) << color);
+        }
+
+        elem_color[ie] = color;
+        color_count[color]++;
+    }
+
+    // With first fit coloring, the used colors are always 0...n-1 (plus possibly the overflow color).
+    int num_colors = 0;
+    while (num_colors < MAX_ELEMENT_COLORS && color_count[num_colors] > 0)
+        num_colors++;
+
+    // Sort elements by color (counting sort, stable so that elements of a color are in mesh order).
+    std::vector<int> start(MAX_ELEMENT_COLORS + 2, 0);
+    for (int c = 0; c <= MAX_ELEMENT_COLORS; c++)
+        start[c + 1] = start[c] + color_count[c];
+
+    color_start.assign(start.begin(), start.begin() + num_colors + 1);
+
+    elem_colored.resize(num_elements);
+    for (int ie = 0; ie < num_elements; ie++)
+        elem_colored[start[elem_color[ie]]++] = ie;
+
+    coloring_valid = true;
+}
+
+template <typename Func>
+void ChMesh::ForEachElementColored(int nthreads, Func func) {
+    if (!coloring_valid)
+        ColorElements();
+
+    int num_colors = GetNumElementColors();
+
+    // Elements of the same color do not share nodes and can therefore write to R without synchronization
+    for (int color = 0; color < num_colors; color++) {
+        int start = color_start[color];
+        int end = color_start[color + 1];
+#pragma omp parallel num_threads(nthreads)
+        {
+            CH_TRACE_ZONE("ChMesh::ElementColor");
+#pragma omp for schedule(dynamic, 4)
+            for (int k = start; k < end; k++) {
+                func(velements[elem_colored[k]].get());
+            }
+        }
+    }
+
+    // Elements that could not be colored are processed sequentially
+    for (int k = color_start[num_colors]; k < (int)elem_colored.size(); k++) {
+        func(velements[elem_colored[k]].get());
+    }
 }
 
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+    CH_TRACE_ZONE("ChMesh::Update");
+
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
@@ -282,53 +380,53 @@ void ChMesh::IntStateGetIncrement(const unsigned int off_x,
 }
 
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
-    // nodes applied forces
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntLoadResidual_F(off + local_off_v, R, c);
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
-    }
+    CH_TRACE_ZONE("ChMesh::IntLoadResidual_F");
 
     int nthreads = GetSystem()->nthreads_chrono;
+    int num_nodes = (int)vnodes.size();
+
+    // Note: node offsets in R are obtained from the node state offsets (relative to the mesh offset), so that nodes
+    // can be processed in parallel. Each node writes only in its own segment of R.
+
+    // nodes applied forces
+#pragma omp parallel for num_threads(nthreads) if (num_nodes > 512)
+    for (int j = 0; j < num_nodes; j++) {
+        if (!vnodes[j]->GetFixed())
+            vnodes[j]->NodeIntLoadResidual_F(off + vnodes[j]->NodeGetOffset_w() - GetOffset_w(), R, c);
+    }
 
     // elements internal forces
-    timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+    {
+        CH_TRACE_ZONE("ChMesh::InternalForces");
+        timer_internal_forces.start();
+        ForEachElementColored(nthreads, [&R, c](ChElementBase* elem) { elem->EleIntLoadResidual_F(R, c); });
+        timer_internal_forces.stop();
+        ncalls_internal_forces++;
     }
-    timer_internal_forces.stop();
-    ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
-        }
+        const ChVector<> G_acc = GetSystem()->Get_G_acc();
+        ForEachElementColored(nthreads,
+                              [&R, &G_acc, c](ChElementBase* elem) { elem->EleIntLoadResidual_F_gravity(R, G_acc, c); });
     }
 
     // nodes gravity forces
-    local_off_v = 0;
     if (automatic_gravity_load && this->system) {
-        //#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        //***PARALLEL FOR***, (no need here to use omp atomic to avoid race condition in writing to R)
-        for (int in = 0; in < vnodes.size(); in++) {
+        const ChVector<> G_acc = this->system->Get_G_acc();
+#pragma omp parallel for num_threads(nthreads) if (num_nodes > 512)
+        for (int in = 0; in < num_nodes; in++) {
             if (!vnodes[in]->GetFixed()) {
+                unsigned int node_off = off + vnodes[in]->NodeGetOffset_w() - GetOffset_w();
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyz>(vnodes[in])) {
-                    ChVector<> fg = c * mnode->GetMass() * this->system->Get_G_acc();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
+                    ChVector<> fg = c * mnode->GetMass() * G_acc;
+                    R.segment(node_off, 3) += fg.eigen();
                 }
                 // odd stuf here... the ChNodeFEAxyzrot is not inherited from ChNodeFEAxyz so must trap it too:
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(vnodes[in])) {
-                    ChVector<> fg = c * mnode->GetMass() * this->system->Get_G_acc();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
+                    ChVector<> fg = c * mnode->GetMass() * G_acc;
+                    R.segment(node_off, 3) += fg.eigen();
                 }
-                local_off_v += vnodes[in]->Get_ndof_w();
             }
         }
     }
@@ -360,19 +458,20 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
                                 const ChVectorDynamic<>& w,  ///< the w vector
                                 const double c               ///< a scaling factor
 ) {
-    // nodal masses
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->GetFixed()) {
-            vnodes[j]->NodeIntLoadResidual_Mv(off + local_off_v, R, w, c);
-            local_off_v += vnodes[j]->Get_ndof_w();
-        }
+    CH_TRACE_ZONE("ChMesh::IntLoadResidual_Mv");
+
+    int nthreads = GetSystem()->nthreads_chrono;
+    int num_nodes = (int)vnodes.size();
+
+    // nodal masses (each node writes only in its own segment of R)
+#pragma omp parallel for num_threads(nthreads) if (num_nodes > 512)
+    for (int j = 0; j < num_nodes; j++) {
+        if (!vnodes[j]->GetFixed())
+            vnodes[j]->NodeIntLoadResidual_Mv(off + vnodes[j]->NodeGetOffset_w() - GetOffset_w(), R, w, c);
     }
 
     // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
-    }
+    ForEachElementColored(nthreads, [&R, &w, c](ChElementBase* elem) { elem->EleIntLoadResidual_Mv(R, w, c); });
 }
 
 void ChMesh::IntToDescriptor(const unsigned int off_v,
@@ -411,12 +510,18 @@ void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 }
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    CH_TRACE_ZONE("ChMesh::KRMmatricesLoad");
+
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
-#pragma omp parallel for num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+#pragma omp parallel num_threads(nthreads)
+    {
+        CH_TRACE_ZONE("ChMesh::KRMmatricesLoad_thread");
+#pragma omp for
+        for (int ie = 0; ie < velements.size(); ie++)
+            velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+    }
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
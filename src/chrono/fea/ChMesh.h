@@ -57,6 +57,10 @@ class ChApi ChMesh : public ChIndexedNodes {
     int ncalls_internal_forces;
     int ncalls_KRMload;
 
+    std::vector<int> elem_colored;   ///< element indices, sorted by color
+    std::vector<int> color_start;    ///< index in elem_colored of the first element of each color (plus end marker)
+    bool coloring_valid;             ///< is the element coloring up to date?
+
   public:
     ChMesh()
         : n_dofs(0),
@@ -64,7 +68,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          coloring_valid(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -110,6 +115,12 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative number of calls to load Jacobian information.
     int GetNumCallsJacobianLoad() { return ncalls_KRMload; }
 
+    /// Get the number of element colors.
+    /// Elements are colored (in Setup) so that no two elements of the same color share a node. Elements of the same
+    /// color are processed in parallel when loading the internal forces, gravity forces, and M*v products into a
+    /// residual vector, without any write conflicts. The result does not depend on the number of threads.
+    int GetNumElementColors() const { return (int)color_start.size() - 1; }
+
     /// Reset timers for internal force and Jacobian evaluations.
     void ResetTimers() {
         timer_internal_forces.reset();
@@ -285,6 +296,13 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Color the mesh elements so that elements with the same color do not share any node.
+    void ColorElements();
+
+    /// Invoke the given function for all elements, processing elements of the same color in parallel.
+    template <typename Func>
+    void ForEachElementColored(int nthreads, Func func);
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
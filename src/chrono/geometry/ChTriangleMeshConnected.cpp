@@ -40,10 +40,25 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <map>
+#include <random>
 #include <unordered_map>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "chrono/core/ChMappedFile.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 
 namespace chrono {
@@ -746,6 +761,90 @@ class BuildMesh : public GeometryInterface {
 
 // -----------------------------------------------------------------------------
 
+namespace {
+
+// 64-bit FNV-1a hash.
+uint64_t HashBytes(const char* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Header of a binary mesh file. The header is followed by the mesh arrays, in the order of the counts, each padded
+// to a multiple of 8 bytes.
+struct BinaryMeshHeader {
+    char magic[8];                  // "CHMESH" followed by two null characters
+    uint32_t version;               // format version
+    uint32_t byte_order;            // 0x01020304, as written by the host
+    uint64_t source_hash;           // hash of the source file (0 if unknown)
+    uint64_t payload_hash;          // hash of all bytes following the header
+    uint64_t counts[9];             // vertices, normals, UVs, colors, face vertex/normal/UV/color indices, triangle map
+    uint32_t tri_map_pathological;  // return value of ComputeNeighbouringTriangleMap
+    uint32_t reserved;
+};
+
+const char binary_mesh_magic[8] = {'C', 'H', 'M', 'E', 'S', 'H', 0, 0};
+const uint32_t binary_mesh_version = 2;
+const uint32_t binary_mesh_byte_order = 0x01020304;
+
+static_assert(sizeof(ChVector<double>) == 3 * sizeof(double), "unexpected ChVector layout");
+static_assert(sizeof(ChVector<float>) == 3 * sizeof(float), "unexpected ChVector layout");
+static_assert(sizeof(ChVector<int>) == 3 * sizeof(int), "unexpected ChVector layout");
+static_assert(sizeof(std::array<int, 4>) == 4 * sizeof(int), "unexpected std::array layout");
+
+size_t PaddedSize(size_t size) {
+    return (size + 7) & ~size_t(7);
+}
+
+// Write the array (padded to a multiple of 8 bytes) and accumulate the written bytes into the given hash.
+template <typename T>
+void WriteArray(std::ofstream& file, const std::vector<T>& v, uint64_t& hash) {
+    static const char padding[8] = {0};
+    size_t size = v.size() * sizeof(T);
+    if (size) {
+        file.write((const char*)v.data(), size);
+        hash = HashBytes((const char*)v.data(), size, hash);
+    }
+    file.write(padding, PaddedSize(size) - size);
+    hash = HashBytes(padding, PaddedSize(size) - size, hash);
+}
+
+// Return a temporary file name next to the given file, unique across processes and threads.
+std::string TemporaryFilename(const std::string& filename) {
+#ifdef _WIN32
+    unsigned long pid = (unsigned long)GetCurrentProcessId();
+#else
+    unsigned long pid = (unsigned long)getpid();
+#endif
+    std::random_device rd;
+    return filename + "." + std::to_string(pid) + "." + std::to_string(rd()) + ".tmp";
+}
+
+// Atomically replace the destination file (if any) with the source file.
+bool MoveIntoPlace(const std::string& src, const std::string& dst) {
+#ifdef _WIN32
+    return MoveFileExA(src.c_str(), dst.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return std::rename(src.c_str(), dst.c_str()) == 0;
+#endif
+}
+
+template <typename T>
+const char* ReadArray(const char* data, uint64_t count, std::vector<T>& v) {
+    v.resize((size_t)count);
+    size_t size = v.size() * sizeof(T);
+    if (size)
+        std::memcpy((void*)v.data(), data, size);
+    return data + PaddedSize(size);
+}
+
+}  // end anonymous namespace
+
+bool ChTriangleMeshConnected::m_binary_cache = true;
+std::string ChTriangleMeshConnected::m_binary_cache_dir;
+
 ChTriangleMeshConnected::ChTriangleMeshConnected(const ChTriangleMeshConnected& source) {
     m_vertices = source.m_vertices;
     m_normals = source.m_normals;
@@ -756,6 +855,10 @@ ChTriangleMeshConnected::ChTriangleMeshConnected(const ChTriangleMeshConnected&
     m_face_n_indices = source.m_face_n_indices;
     m_face_uv_indices = source.m_face_uv_indices;
     m_face_col_indices = source.m_face_col_indices;
+
+    m_tri_map = source.m_tri_map;
+    m_tri_map_hash = source.m_tri_map_hash;
+    m_tri_map_pathological = source.m_tri_map_pathological;
 }
 
 // Following function is a modified version of:
@@ -889,48 +992,58 @@ void ChTriangleMeshConnected::ComputeMassProperties(bool bodyCoords,
 using namespace WAVEFRONT;
 
 bool ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_normals, bool load_uv) {
-    this->m_vertices.clear();
-    this->m_normals.clear();
-    this->m_UV.clear();
-    this->m_face_v_indices.clear();
-    this->m_face_n_indices.clear();
-    this->m_face_uv_indices.clear();
+    // Try loading the binary cache, if generated from the same file contents
+    uint64_t hash = 0;
+    std::string cache_filename = GetBinaryCacheFilename(filename);
+    bool cached = false;
+    if (m_binary_cache) {
+        hash = ComputeFileHash(filename);
+        cached = (hash != 0) && LoadBinaryMesh(cache_filename, hash);
+    }
 
-    GeometryInterface emptybm;  // BuildMesh bm;
+    if (!cached) {
+        Clear();
 
-    m_filename = filename;
+        GeometryInterface emptybm;  // BuildMesh bm;
 
-    OBJ obj;
+        OBJ obj;
 
-    int ret = obj.LoadMesh(filename.c_str(), &emptybm, true);
-    if (ret == -1) {
-        std::cerr << "Error loading OBJ file " << filename << std::endl;
-        return false;
-    }
+        int ret = obj.LoadMesh(filename.c_str(), &emptybm, true);
+        if (ret == -1) {
+            std::cerr << "Error loading OBJ file " << filename << std::endl;
+            return false;
+        }
 
-    for (unsigned int iv = 0; iv < obj.mVerts.size(); iv += 3) {
-        this->m_vertices.push_back(ChVector<double>(obj.mVerts[iv], obj.mVerts[iv + 1], obj.mVerts[iv + 2]));
-    }
-    for (unsigned int in = 0; in < obj.mNormals.size(); in += 3) {
-        this->m_normals.push_back(ChVector<double>(obj.mNormals[in], obj.mNormals[in + 1], obj.mNormals[in + 2]));
-    }
-    for (unsigned int it = 0; it < obj.mTexels.size(); it += 2)  // +2 because only u,v each texel
-    {
-        this->m_UV.push_back(ChVector<double>(obj.mTexels[it], obj.mTexels[it + 1], 0));
-    }
-    for (unsigned int iiv = 0; iiv < obj.mIndexesVerts.size(); iiv += 3) {
-        this->m_face_v_indices.push_back(
-            ChVector<int>(obj.mIndexesVerts[iiv], obj.mIndexesVerts[iiv + 1], obj.mIndexesVerts[iiv + 2]));
-    }
-    for (unsigned int iin = 0; iin < obj.mIndexesNormals.size(); iin += 3) {
-        this->m_face_n_indices.push_back(
-            ChVector<int>(obj.mIndexesNormals[iin], obj.mIndexesNormals[iin + 1], obj.mIndexesNormals[iin + 2]));
-    }
-    for (unsigned int iit = 0; iit < obj.mIndexesTexels.size(); iit += 3) {
-        this->m_face_uv_indices.push_back(
-            ChVector<int>(obj.mIndexesTexels[iit], obj.mIndexesTexels[iit + 1], obj.mIndexesTexels[iit + 2]));
+        for (unsigned int iv = 0; iv < obj.mVerts.size(); iv += 3) {
+            this->m_vertices.push_back(ChVector<double>(obj.mVerts[iv], obj.mVerts[iv + 1], obj.mVerts[iv + 2]));
+        }
+        for (unsigned int in = 0; in < obj.mNormals.size(); in += 3) {
+            this->m_normals.push_back(ChVector<double>(obj.mNormals[in], obj.mNormals[in + 1], obj.mNormals[in + 2]));
+        }
+        for (unsigned int it = 0; it < obj.mTexels.size(); it += 2)  // +2 because only u,v each texel
+        {
+            this->m_UV.push_back(ChVector<double>(obj.mTexels[it], obj.mTexels[it + 1], 0));
+        }
+        for (unsigned int iiv = 0; iiv < obj.mIndexesVerts.size(); iiv += 3) {
+            this->m_face_v_indices.push_back(
+                ChVector<int>(obj.mIndexesVerts[iiv], obj.mIndexesVerts[iiv + 1], obj.mIndexesVerts[iiv + 2]));
+        }
+        for (unsigned int iin = 0; iin < obj.mIndexesNormals.size(); iin += 3) {
+            this->m_face_n_indices.push_back(
+                ChVector<int>(obj.mIndexesNormals[iin], obj.mIndexesNormals[iin + 1], obj.mIndexesNormals[iin + 2]));
+        }
+        for (unsigned int iit = 0; iit < obj.mIndexesTexels.size(); iit += 3) {
+            this->m_face_uv_indices.push_back(
+                ChVector<int>(obj.mIndexesTexels[iit], obj.mIndexesTexels[iit + 1], obj.mIndexesTexels[iit + 2]));
+        }
+
+        // Generate the binary cache (ignore failures, e.g. in read-only directories)
+        if (m_binary_cache && hash != 0)
+            WriteBinaryMesh(cache_filename, hash, true);
     }
 
+    m_filename = filename;
+
     if (!load_normals) {
         this->m_normals.clear();
         this->m_face_n_indices.clear();
@@ -943,6 +1056,138 @@ bool ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_
     return true;
 }
 
+bool ChTriangleMeshConnected::WriteBinaryMesh(const std::string& filename,
+                                              uint64_t source_hash,
+                                              bool neighbour_map) const {
+    BinaryMeshHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, binary_mesh_magic, sizeof(header.magic));
+    header.version = binary_mesh_version;
+    header.byte_order = binary_mesh_byte_order;
+    header.source_hash = source_hash;
+
+    // Write to a uniquely named temporary file first, then move it in place, so that an incomplete file is never
+    // found under the final name, even with concurrent writers. The payload hash is patched in the header at the end.
+    std::string tmp_filename = TemporaryFilename(filename);
+    {
+        // Open the file before computing the neighbouring triangle map, so that nothing is computed if the file
+        // cannot be written (e.g., in a read-only directory)
+        std::ofstream file(tmp_filename, std::ios::binary);
+        if (!file.is_open())
+            return false;
+
+        std::vector<std::array<int, 4>> tri_map;
+        if (neighbour_map)
+            header.tri_map_pathological = ComputeNeighbouringTriangleMap(tri_map) ? 1 : 0;
+
+        header.counts[0] = m_vertices.size();
+        header.counts[1] = m_normals.size();
+        header.counts[2] = m_UV.size();
+        header.counts[3] = m_colors.size();
+        header.counts[4] = m_face_v_indices.size();
+        header.counts[5] = m_face_n_indices.size();
+        header.counts[6] = m_face_uv_indices.size();
+        header.counts[7] = m_face_col_indices.size();
+        header.counts[8] = tri_map.size();
+
+        file.write((const char*)&header, sizeof(header));
+        uint64_t hash = HashBytes(nullptr, 0);
+        WriteArray(file, m_vertices, hash);
+        WriteArray(file, m_normals, hash);
+        WriteArray(file, m_UV, hash);
+        WriteArray(file, m_colors, hash);
+        WriteArray(file, m_face_v_indices, hash);
+        WriteArray(file, m_face_n_indices, hash);
+        WriteArray(file, m_face_uv_indices, hash);
+        WriteArray(file, m_face_col_indices, hash);
+        WriteArray(file, tri_map, hash);
+        header.payload_hash = hash;
+        file.seekp(0);
+        file.write((const char*)&header, sizeof(header));
+        file.close();
+        if (!file.good()) {
+            std::remove(tmp_filename.c_str());
+            return false;
+        }
+    }
+
+    if (!MoveIntoPlace(tmp_filename, filename)) {
+        std::remove(tmp_filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool ChTriangleMeshConnected::LoadBinaryMesh(const std::string& filename, uint64_t source_hash) {
+    ChMappedFile file(filename);
+    if (!file.IsValid() || file.GetSize() < sizeof(BinaryMeshHeader))
+        return false;
+
+    BinaryMeshHeader header;
+    std::memcpy(&header, file.GetData(), sizeof(header));
+    if (std::memcmp(header.magic, binary_mesh_magic, sizeof(header.magic)) != 0 ||
+        header.version != binary_mesh_version || header.byte_order != binary_mesh_byte_order)
+        return false;
+    if (source_hash != 0 && header.source_hash != source_hash)
+        return false;
+
+    const size_t sizes[9] = {sizeof(ChVector<double>), sizeof(ChVector<double>), sizeof(ChVector<double>),
+                             sizeof(ChVector<float>),  sizeof(ChVector<int>),    sizeof(ChVector<int>),
+                             sizeof(ChVector<int>),    sizeof(ChVector<int>),    sizeof(std::array<int, 4>)};
+    uint64_t expected = sizeof(header);
+    for (int i = 0; i < 9; i++) {
+        if (header.counts[i] > file.GetSize() / sizes[i])
+            return false;
+        expected += PaddedSize((size_t)header.counts[i] * sizes[i]);
+    }
+    if (expected != file.GetSize())
+        return false;
+
+    const char* data = file.GetData() + sizeof(header);
+    if (HashBytes(data, file.GetSize() - sizeof(header)) != header.payload_hash)
+        return false;
+
+    data = ReadArray(data, header.counts[0], m_vertices);
+    data = ReadArray(data, header.counts[1], m_normals);
+    data = ReadArray(data, header.counts[2], m_UV);
+    data = ReadArray(data, header.counts[3], m_colors);
+    data = ReadArray(data, header.counts[4], m_face_v_indices);
+    data = ReadArray(data, header.counts[5], m_face_n_indices);
+    data = ReadArray(data, header.counts[6], m_face_uv_indices);
+    data = ReadArray(data, header.counts[7], m_face_col_indices);
+    data = ReadArray(data, header.counts[8], m_tri_map);
+    m_tri_map_hash = m_tri_map.empty() ? 0 : ComputeFacesHash();
+    m_tri_map_pathological = (header.tri_map_pathological != 0);
+
+    m_filename = filename;
+    return true;
+}
+
+std::string ChTriangleMeshConnected::GetBinaryCacheFilename(const std::string& filename) {
+    if (m_binary_cache_dir.empty())
+        return filename + ".chmesh";
+
+    // Cache file named after the .obj file, tagged with a hash of its path (to distinguish files with the same name
+    // in different directories)
+    size_t sep = filename.find_last_of("/\\");
+    std::string name = (sep == std::string::npos) ? filename : filename.substr(sep + 1);
+    char tag[17];
+    std::snprintf(tag, sizeof(tag), "%016llx", (unsigned long long)HashBytes(filename.data(), filename.size()));
+    return m_binary_cache_dir + "/" + name + "." + tag + ".chmesh";
+}
+
+uint64_t ChTriangleMeshConnected::ComputeFileHash(const std::string& filename) {
+    ChMappedFile file(filename);
+    if (!file.IsValid())
+        return 0;
+    uint64_t hash = HashBytes(file.GetData(), file.GetSize());
+    return hash ? hash : 1;
+}
+
+uint64_t ChTriangleMeshConnected::ComputeFacesHash() const {
+    return HashBytes((const char*)m_face_v_indices.data(), m_face_v_indices.size() * sizeof(ChVector<int>));
+}
+
 // Write the specified meshes in a Wavefront .obj file
 void ChTriangleMeshConnected::WriteWavefront(const std::string& filename,
                                              std::vector<ChTriangleMeshConnected>& meshes) {
@@ -1086,6 +1331,12 @@ void ChTriangleMeshConnected::Transform(const ChVector<> displ, const ChMatrix33
 }
 
 bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const {
+    // Use the map loaded from a binary mesh file, unless the faces were modified since
+    if (!m_tri_map.empty() && m_tri_map.size() == m_face_v_indices.size() && ComputeFacesHash() == m_tri_map_hash) {
+        tri_map = m_tri_map;
+        return m_tri_map_pathological;
+    }
+
     bool pathological_edges = false;
 
     std::multimap<std::pair<int, int>, int> edge_map;
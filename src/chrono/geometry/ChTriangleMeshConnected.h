@@ -17,6 +17,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <map>
 
 #include "chrono/geometry/ChTriangleMesh.h"
@@ -59,9 +60,46 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     std::vector<ChVector<int>>& getIndicesUV() { return m_face_uv_indices; }
     std::vector<ChVector<int>>& getIndicesColors() { return m_face_col_indices; }
 
-    /// Load a triangle mesh saved as a Wavefront .obj file
+    /// Load a triangle mesh saved as a Wavefront .obj file.
+    /// If the binary mesh cache is enabled (default), the mesh is loaded from a binary cache file (see
+    /// GetBinaryCacheFilename), provided this cache was generated from the same .obj contents. Otherwise, the .obj file
+    /// is parsed and the cache file is (re)generated; failure to write the cache file (e.g., in a read-only directory)
+    /// is silently ignored.
     bool LoadWavefrontMesh(std::string filename, bool load_normals = true, bool load_uv = false);
 
+    /// Enable or disable the use of binary cache files in LoadWavefrontMesh (default: enabled).
+    static void EnableBinaryCache(bool val) { m_binary_cache = val; }
+
+    /// Return true if LoadWavefrontMesh uses binary cache files.
+    static bool IsBinaryCacheEnabled() { return m_binary_cache; }
+
+    /// Set the directory for the binary cache files generated by LoadWavefrontMesh (ATTENTION: not thread safe).
+    /// By default (empty string), each cache file is placed beside its .obj file. The directory must exist.
+    static void SetBinaryCacheDirectory(const std::string& dir) { m_binary_cache_dir = dir; }
+
+    /// Return the directory for the binary cache files (empty if cache files are placed beside the .obj files).
+    static const std::string& GetBinaryCacheDirectory() { return m_binary_cache_dir; }
+
+    /// Return the name of the binary cache file for the specified .obj file.
+    /// Without a cache directory, this is the .obj file name with an additional ".chmesh" extension. Otherwise, the
+    /// cache file is placed in the cache directory, and its name includes a hash of the specified .obj file path.
+    static std::string GetBinaryCacheFilename(const std::string& filename);
+
+    /// Write this mesh in the binary mesh format.
+    /// The file holds vertices, normals, UVs, colors and all face indices in their in-memory layout, so that it can
+    /// be loaded without any parsing. Optionally, the neighbouring triangle map (see ComputeNeighbouringTriangleMap) is
+    /// computed and stored as well. The specified hash identifies the source of the mesh (see ComputeFileHash).
+    /// Binary mesh files are not portable across platforms with different endianness.
+    bool WriteBinaryMesh(const std::string& filename, uint64_t source_hash = 0, bool neighbour_map = true) const;
+
+    /// Load a mesh written with WriteBinaryMesh (the file is memory-mapped).
+    /// If a non-zero hash is specified, the file is rejected unless it was written with the same source hash.
+    /// Return false if the file cannot be read, is not a valid binary mesh file, or does not match the hash.
+    bool LoadBinaryMesh(const std::string& filename, uint64_t source_hash = 0);
+
+    /// Return a hash of the contents of the specified file (0 if the file cannot be read).
+    static uint64_t ComputeFileHash(const std::string& filename);
+
     /// Write the specified meshes in a Wavefront .obj file
     static void WriteWavefront(const std::string& filename, std::vector<ChTriangleMeshConnected>& meshes);
 
@@ -98,6 +136,7 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
 
     /// Clear all data
     virtual void Clear() override {
+        m_tri_map.clear();
         this->getCoordsVertices().clear();
         this->getCoordsNormals().clear();
         this->getCoordsUV().clear();
@@ -120,7 +159,9 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Create a map of neighboring triangles, vector of:
     /// [Ti TieA TieB TieC]
     /// (the free sides have triangle id = -1).
-    /// Return false if some edge has more than 2 neighboring triangles
+    /// Return false if some edge has more than 2 neighboring triangles.
+    /// If the mesh was loaded from a binary mesh file including this map, and the faces were not changed since, the
+    /// stored map is returned.
     bool ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const;
 
     /// Create a winged edge structure, map of {key, value} as
@@ -226,6 +267,17 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    /// Return a hash of the vertex indices of all faces.
+    uint64_t ComputeFacesHash() const;
+
+    std::vector<std::array<int, 4>> m_tri_map;  ///< neighbouring triangle map loaded from a binary mesh file
+    uint64_t m_tri_map_hash = 0;                ///< hash of the faces for which m_tri_map was computed
+    bool m_tri_map_pathological = false;        ///< return value of ComputeNeighbouringTriangleMap for m_tri_map
+
+    static bool m_binary_cache;             ///< use binary cache files in LoadWavefrontMesh?
+    static std::string m_binary_cache_dir;  ///< directory for binary cache files (empty: beside the .obj files)
 };
 
 }  // end namespace geometry
@@ -13,6 +13,7 @@
 #ifndef CHFUNCT_H
 #define CHFUNCT_H
 
+#include "chrono/motion_functions/ChFunction_Compiled.h"
 #include "chrono/motion_functions/ChFunction_Const.h"
 #include "chrono/motion_functions/ChFunction_ConstAcc.h"
 #include "chrono/motion_functions/ChFunction_Derive.h"
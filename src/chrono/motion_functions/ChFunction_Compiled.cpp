@@ -0,0 +1,286 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <typeinfo>
+
+#include "chrono/motion_functions/ChFunction_Compiled.h"
+#include "chrono/motion_functions/ChFunction_Const.h"
+#include "chrono/motion_functions/ChFunction_Derive.h"
+#include "chrono/motion_functions/ChFunction_Recorder.h"
+#include "chrono/motion_functions/ChFunction_Sequence.h"
+
+namespace chrono {
+
+ChFunction_Compiled::ChFunction_Compiled() : m_xmin(0), m_xmax(1.2) {}
+
+ChFunction_Compiled::ChFunction_Compiled(std::shared_ptr<ChFunction> function) {
+    Compile(function);
+}
+
+ChFunction_Compiled::ChFunction_Compiled(const ChFunction_Compiled& other) {
+    m_nodes = other.m_nodes;
+    m_px = other.m_px;
+    m_py = other.m_py;
+    m_segments = other.m_segments;
+    m_hints = other.m_hints;
+    m_xmin = other.m_xmin;
+    m_xmax = other.m_xmax;
+}
+
+void ChFunction_Compiled::Compile(std::shared_ptr<ChFunction> function) {
+    m_nodes.clear();
+    m_px.clear();
+    m_py.clear();
+    m_segments.clear();
+    AddNode(function);
+    m_hints.assign(m_nodes.size(), 0);
+    function->Estimate_x_range(m_xmin, m_xmax);
+}
+
+// Append the nodes of the given function (children first) and return the index of its root node.
+// Only exact types are translated, since derived classes may override the evaluation functions.
+int ChFunction_Compiled::AddNode(std::shared_ptr<ChFunction> function) {
+    Node node;
+    node.type = NodeType::LEAF;
+    node.op = ChFunction_Operation::ChOP_ADD;
+    node.a = node.b = -1;
+    node.begin = node.end = 0;
+    node.value = 0;
+
+    const std::type_info& type = typeid(*function);
+
+    if (type == typeid(ChFunction_Const)) {
+        node.type = NodeType::CONSTANT;
+        node.value = function->Get_y(0);
+    } else if (type == typeid(ChFunction_Recorder)) {
+        auto recorder = std::static_pointer_cast<ChFunction_Recorder>(function);
+        node.type = NodeType::RECORDER;
+        node.begin = m_px.size();
+        for (const auto& point : recorder->GetPoints()) {
+            m_px.push_back(point.x);
+            m_py.push_back(point.y);
+        }
+        node.end = m_px.size();
+    } else if (type == typeid(ChFunction_Sequence)) {
+        auto sequence = std::static_pointer_cast<ChFunction_Sequence>(function);
+        // Segments can be located with a binary search only if they do not overlap (this is always the case after a
+        // call to ChFunction_Sequence::Setup); otherwise, keep the sequence as a leaf.
+        bool sorted = true;
+        const ChFseqNode* prev = nullptr;
+        for (const auto& fnode : sequence->Get_list()) {
+            if (prev && fnode.t_start < prev->t_end)
+                sorted = false;
+            prev = &fnode;
+        }
+        if (sorted) {
+            std::vector<Segment> segments;
+            for (const auto& fnode : sequence->Get_list())
+                segments.push_back({fnode.t_start, fnode.t_end, fnode.Iy, fnode.Iydt, fnode.Iydtdt, AddNode(fnode.fx)});
+            node.type = NodeType::SEQUENCE;
+            node.begin = m_segments.size();
+            m_segments.insert(m_segments.end(), segments.begin(), segments.end());
+            node.end = m_segments.size();
+        }
+    } else if (type == typeid(ChFunction_Operation)) {
+        auto operation = std::static_pointer_cast<ChFunction_Operation>(function);
+        node.type = NodeType::OPERATION;
+        node.op = operation->Get_optype();
+        node.a = AddNode(operation->Get_fa());
+        node.b = AddNode(operation->Get_fb());
+    } else if (type == typeid(ChFunction_Derive)) {
+        auto derive = std::static_pointer_cast<ChFunction_Derive>(function);
+        node.type = NodeType::DERIVE;
+        node.a = AddNode(derive->Get_fa());
+    }
+
+    if (node.type == NodeType::LEAF)
+        node.leaf = std::shared_ptr<ChFunction>(function->Clone());
+
+    m_nodes.push_back(node);
+    return (int)m_nodes.size() - 1;
+}
+
+int ChFunction_Compiled::GetNumLeaves() const {
+    return (int)std::count_if(m_nodes.begin(), m_nodes.end(),
+                              [](const Node& node) { return node.type == NodeType::LEAF; });
+}
+
+// Return the index of the first point at or after x (x must be strictly inside the range of the recorder points).
+size_t ChFunction_Compiled::FindPoint(int n, double x) const {
+    const Node& node = m_nodes[n];
+    // check the interval found at the previous evaluation, then the next one
+    for (size_t i = m_hints[n]; i <= m_hints[n] + 1; i++) {
+        if (i > node.begin && i < node.end && m_px[i - 1] < x && x <= m_px[i]) {
+            m_hints[n] = i;
+            return i;
+        }
+    }
+    size_t i = std::lower_bound(m_px.begin() + node.begin, m_px.begin() + node.end, x) - m_px.begin();
+    m_hints[n] = i;
+    return i;
+}
+
+// Return the segment containing x, or nullptr if there is none.
+const ChFunction_Compiled::Segment* ChFunction_Compiled::FindSegment(int n, double x) const {
+    const Node& node = m_nodes[n];
+    // check the segment found at the previous evaluation, then the next one
+    for (size_t i = m_hints[n]; i <= m_hints[n] + 1; i++) {
+        if (i >= node.begin && i < node.end && m_segments[i].t_start <= x && x < m_segments[i].t_end) {
+            m_hints[n] = i;
+            return &m_segments[i];
+        }
+    }
+    auto first = m_segments.begin() + node.begin;
+    auto last = m_segments.begin() + node.end;
+    auto iter = std::upper_bound(first, last, x, [](double val, const Segment& seg) { return val < seg.t_start; });
+    if (iter == first)
+        return nullptr;
+    --iter;
+    m_hints[n] = iter - m_segments.begin();
+    return (x < iter->t_end) ? &(*iter) : nullptr;
+}
+
+double ChFunction_Compiled::Eval(int n, double x) const {
+    const Node& node = m_nodes[n];
+    switch (node.type) {
+        case NodeType::CONSTANT:
+            return node.value;
+        case NodeType::RECORDER: {
+            if (node.begin == node.end)
+                return 0;
+            if (x <= m_px[node.begin])
+                return m_py[node.begin];
+            if (x >= m_px[node.end - 1])
+                return m_py[node.end - 1];
+            size_t i = FindPoint(n, x);
+            return ((x - m_px[i - 1]) * m_py[i] + (m_px[i] - x) * m_py[i - 1]) / (m_px[i] - m_px[i - 1]);
+        }
+        case NodeType::SEQUENCE: {
+            const Segment* seg = FindSegment(n, x);
+            if (!seg)
+                return 0;
+            double t = x - seg->t_start;
+            return Eval(seg->node, t) + seg->Iy + seg->Iydt * t + seg->Iydtdt * t * t;
+        }
+        case NodeType::OPERATION:
+            switch (node.op) {
+                case ChFunction_Operation::ChOP_ADD:
+                    return Eval(node.a, x) + Eval(node.b, x);
+                case ChFunction_Operation::ChOP_SUB:
+                    return Eval(node.a, x) - Eval(node.b, x);
+                case ChFunction_Operation::ChOP_MUL:
+                    return Eval(node.a, x) * Eval(node.b, x);
+                case ChFunction_Operation::ChOP_DIV:
+                    return Eval(node.a, x) / Eval(node.b, x);
+                case ChFunction_Operation::ChOP_POW:
+                    return pow(Eval(node.a, x), Eval(node.b, x));
+                case ChFunction_Operation::ChOP_MAX:
+                    return ChMax(Eval(node.a, x), Eval(node.b, x));
+                case ChFunction_Operation::ChOP_MIN:
+                    return ChMin(Eval(node.a, x), Eval(node.b, x));
+                case ChFunction_Operation::ChOP_MODULO:
+                    return fmod(Eval(node.a, x), Eval(node.b, x));
+                case ChFunction_Operation::ChOP_FABS:
+                    return fabs(Eval(node.a, x));
+                case ChFunction_Operation::ChOP_FUNCT:
+                    return Eval(node.a, Eval(node.b, x));
+                default:
+                    return 0;
+            }
+        case NodeType::DERIVE:
+            return EvalDx(node.a, x);
+        case NodeType::LEAF:
+            return node.leaf->Get_y(x);
+    }
+    return 0;
+}
+
+double ChFunction_Compiled::EvalDx(int n, double x) const {
+    const Node& node = m_nodes[n];
+    switch (node.type) {
+        case NodeType::CONSTANT:
+            return 0;
+        case NodeType::SEQUENCE: {
+            const Segment* seg = FindSegment(n, x);
+            if (!seg)
+                return 0;
+            double t = x - seg->t_start;
+            return EvalDx(seg->node, t) + seg->Iydt + seg->Iydtdt * t;
+        }
+        case NodeType::LEAF:
+            return node.leaf->Get_y_dx(x);
+        default:
+            // same numerical differentiation as ChFunction::Get_y_dx
+            return (Eval(n, x + BDF_STEP_LOW) - Eval(n, x)) / BDF_STEP_LOW;
+    }
+}
+
+double ChFunction_Compiled::EvalDxdx(int n, double x) const {
+    const Node& node = m_nodes[n];
+    switch (node.type) {
+        case NodeType::CONSTANT:
+            return 0;
+        case NodeType::SEQUENCE: {
+            const Segment* seg = FindSegment(n, x);
+            if (!seg)
+                return 0;
+            double t = x - seg->t_start;
+            return EvalDxdx(seg->node, t) + seg->Iydtdt;
+        }
+        case NodeType::LEAF:
+            return node.leaf->Get_y_dxdx(x);
+        default:
+            // same numerical differentiation as ChFunction::Get_y_dxdx
+            return (EvalDx(n, x + BDF_STEP_LOW) - EvalDx(n, x)) / BDF_STEP_LOW;
+    }
+}
+
+double ChFunction_Compiled::Get_y(double x) const {
+    return m_nodes.empty() ? 0 : Eval((int)m_nodes.size() - 1, x);
+}
+
+double ChFunction_Compiled::Get_y_dx(double x) const {
+    return m_nodes.empty() ? 0 : EvalDx((int)m_nodes.size() - 1, x);
+}
+
+double ChFunction_Compiled::Get_y_dxdx(double x) const {
+    return m_nodes.empty() ? 0 : EvalDxdx((int)m_nodes.size() - 1, x);
+}
+
+void ChFunction_Compiled::Get_y(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const {
+    y.resize(x.size());
+    for (int i = 0; i < x.size(); i++)
+        y(i) = Get_y(x(i));
+}
+
+void ChFunction_Compiled::Get_y_dx(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const {
+    y.resize(x.size());
+    for (int i = 0; i < x.size(); i++)
+        y(i) = Get_y_dx(x(i));
+}
+
+void ChFunction_Compiled::Get_y_dxdx(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const {
+    y.resize(x.size());
+    for (int i = 0; i < x.size(); i++)
+        y(i) = Get_y_dxdx(x(i));
+}
+
+void ChFunction_Compiled::Estimate_x_range(double& xmin, double& xmax) const {
+    xmin = m_xmin;
+    xmax = m_xmax;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CHFUNCT_COMPILED_H
+#define CHFUNCT_COMPILED_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/motion_functions/ChFunction_Base.h"
+#include "chrono/motion_functions/ChFunction_Operation.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_functions
+/// @{
+
+/// Compiled function:
+///
+/// a frozen, flattened copy of a tree of ChFunction objects, optimized for repeated evaluation.\n
+/// At construction, the given function is translated into an array of evaluation nodes:
+///   - ChFunction_Recorder points are stored in contiguous arrays and located with a binary search;
+///   - ChFunction_Sequence segments are stored in a contiguous array and located with a binary search;
+///   - ChFunction_Operation, ChFunction_Derive and ChFunction_Const nodes are evaluated directly, without virtual
+///     calls through shared pointers;
+///   - any other function is kept as a leaf (a private clone of the original function).
+///
+/// The compiled function returns the same values as the original one (up to round-off for x values coinciding with
+/// the points of a recorder function), including the numerical derivatives of functions which do not provide
+/// analytical ones. Later changes to the original function are not reflected in the compiled one: compile it again
+/// after modifying it.\n
+/// A compiled function can be used wherever a ChFunction is expected, e.g. as the motion law of a motor, or evaluated
+/// for many x values at once. As for ChFunction_Recorder, the point (or segment) found at the last evaluation is
+/// checked first, so that evaluations at consecutive, close x values do not require a search; for the same reason,
+/// a compiled function must not be evaluated concurrently from different threads.
+class ChApi ChFunction_Compiled : public ChFunction {
+  public:
+    ChFunction_Compiled();
+    ChFunction_Compiled(std::shared_ptr<ChFunction> function);
+    ChFunction_Compiled(const ChFunction_Compiled& other);
+    ~ChFunction_Compiled() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChFunction_Compiled* Clone() const override { return new ChFunction_Compiled(*this); }
+
+    /// Compile the given function, replacing the current one.
+    void Compile(std::shared_ptr<ChFunction> function);
+
+    virtual double Get_y(double x) const override;
+    virtual double Get_y_dx(double x) const override;
+    virtual double Get_y_dxdx(double x) const override;
+
+    /// Evaluate the function at all values in x.
+    void Get_y(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const;
+
+    /// Evaluate the function derivative at all values in x.
+    void Get_y_dx(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const;
+
+    /// Evaluate the function second derivative at all values in x.
+    void Get_y_dxdx(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const;
+
+    /// Return the number of evaluation nodes.
+    int GetNumNodes() const { return (int)m_nodes.size(); }
+
+    /// Return the number of nodes which are evaluated by calling the original function type.
+    int GetNumLeaves() const;
+
+    virtual void Estimate_x_range(double& xmin, double& xmax) const override;
+
+  private:
+    enum class NodeType {
+        CONSTANT,   ///< constant value
+        RECORDER,   ///< interpolation of points
+        SEQUENCE,   ///< sequence of segments
+        OPERATION,  ///< operation between two nodes
+        DERIVE,     ///< derivative of a node
+        LEAF        ///< generic function
+    };
+
+    struct Node {
+        NodeType type;
+        ChFunction_Operation::eChOperation op;  ///< operation type (OPERATION)
+        int a;                                  ///< first operand (OPERATION, DERIVE)
+        int b;                                  ///< second operand (OPERATION)
+        size_t begin;                           ///< first point or segment (RECORDER, SEQUENCE)
+        size_t end;                             ///< one past the last point or segment (RECORDER, SEQUENCE)
+        double value;                           ///< constant value (CONSTANT)
+        std::shared_ptr<ChFunction> leaf;       ///< function (LEAF)
+    };
+
+    struct Segment {
+        double t_start;
+        double t_end;
+        double Iy;
+        double Iydt;
+        double Iydtdt;
+        int node;
+    };
+
+    int AddNode(std::shared_ptr<ChFunction> function);
+    size_t FindPoint(int n, double x) const;
+    const Segment* FindSegment(int n, double x) const;
+
+    double Eval(int n, double x) const;
+    double EvalDx(int n, double x) const;
+    double EvalDxdx(int n, double x) const;
+
+    std::vector<Node> m_nodes;            ///< evaluation nodes (children before parents, root last)
+    std::vector<double> m_px;             ///< x values of the recorder points (sorted for each recorder)
+    std::vector<double> m_py;             ///< y values of the recorder points
+    std::vector<Segment> m_segments;      ///< segments of the sequences (sorted for each sequence)
+    mutable std::vector<size_t> m_hints;  ///< point or segment found at the last evaluation of each node
+    double m_xmin;                        ///< estimated argument range of the original function
+    double m_xmax;
+};
+
+/// @} chrono_functions
+
+}  // end namespace chrono
+
+#endif
@@ -115,6 +115,16 @@ void swap(ChAssembly& first, ChAssembly& second) {
     //// TODO: deal with all other member variables...
 }
 
+// Minimum number of items in a list for processing the list in parallel.
+// If enabled (see ChSystem::SetUseParallelUpdate), bodies, shafts, and links are processed in parallel by the per-item
+// passes over the assembly (Update, state gather and scatter, loading of the residual), using the number of Chrono
+// threads of the system. See ChPhysicsItem::Update for the related thread safety requirements.
+static const int min_parallel_items = 128;
+
+int ChAssembly::GetNumThreads() const {
+    return (system && system->GetUseParallelUpdate()) ? system->GetNumThreadsChrono() : 1;
+}
+
 void ChAssembly::Clear() {
     RemoveAllLinks();
     RemoveAllBodies();
@@ -633,17 +643,24 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
         bodylist[ip]->Update(ChTime, update_assets);
     }
-    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
         shaftlist[ip]->Update(ChTime, update_assets);
     }
     for (int ip = 0; ip < (int)otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->Update(ChTime, update_assets);
     }
-    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
         linklist[ip]->Update(ChTime, update_assets);
     }
     for (int ip = 0; ip < (int)meshlist.size(); ++ip) {
@@ -677,17 +694,33 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+    // Each item writes only in its own segments of x and v, but the time T is written by all items. Use a private
+    // copy of T in the parallel loops (the assembly time is returned in any case).
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
+        double t;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, t);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
+        double t;
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, t);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
+        double t;
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, t);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
@@ -715,13 +748,22 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+    int num_links = (int)linklist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
         else
             body->Update(T, full_update);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T, full_update);
         else
@@ -730,7 +772,9 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     for (auto& mesh : meshlist) {
         mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads) if (num_links > min_parallel_items)
+    for (int ip = 0; ip < num_links; ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
         else
@@ -907,11 +951,21 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+
+    // Bodies and shafts load only their own segment of R. Links may apply forces to the connected bodies, so they are
+    // processed sequentially.
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
@@ -934,11 +988,19 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
 ) {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+    int num_bodies = (int)bodylist.size();
+    int num_shafts = (int)shaftlist.size();
+
+#pragma omp parallel for num_threads(nthreads) if (num_bodies > min_parallel_items)
+    for (int ip = 0; ip < num_bodies; ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads) if (num_shafts > min_parallel_items)
+    for (int ip = 0; ip < num_shafts; ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c);
     }
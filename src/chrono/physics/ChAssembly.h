@@ -349,6 +349,9 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int ndoc_w_C;    ///< number of scalar constraints C, when using 3 rot. dof. per body (excluding unilaterals)
     int ndoc_w_D;    ///< number of scalar constraints D, when using 3 rot. dof. per body (only unilaterals)
 
+    /// Return the number of threads used in the per-item passes over bodies, shafts, and links.
+    int GetNumThreads() const;
+
     friend class ChSystem;
     friend class ChSystemMulticore;
     friend class ChSystemDistributed;
@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <cstdint>
+
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
@@ -35,7 +37,11 @@ ChContactContainerNSC::ChContactContainerNSC()
       n_added_666_6(0),
       n_added_666_333(0),
       n_added_666_666(0),
-      n_added_6_6_rolling(0) {}
+      n_added_6_6_rolling(0),
+      use_reaction_cache(false),
+      cache_preset(false) {
+    last_key = {nullptr, nullptr, -1};
+}
 
 ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {
     n_added_6_6 = 0;
@@ -49,6 +55,9 @@ ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
     n_added_666_333 = 0;
     n_added_666_666 = 0;
     n_added_6_6_rolling = 0;
+    use_reaction_cache = other.use_reaction_cache;
+    cache_preset = false;
+    last_key = {nullptr, nullptr, -1};
 }
 
 ChContactContainerNSC::~ChContactContainerNSC() {
@@ -60,137 +69,258 @@ void ChContactContainerNSC::Update(double mytime, bool update_assets) {
     ChContactContainer::Update(mytime, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
+template <class Tpool, class Tlist>
+void _RemoveAllContacts(Tpool& contactpool,
+                        Tlist& contactlist,
+                        std::vector<ChContactContainerNSC::ContactKey>& keys,
+                        int& n_added) {
+    contactpool.clear();
     contactlist.clear();
-    lastcontact = contactlist.begin();
+    keys.clear();
     n_added = 0;
 }
 
 void ChContactContainerNSC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+    _RemoveAllContacts(contactpool_6_6, contactlist_6_6, contactkeys_6_6, n_added_6_6);
+    _RemoveAllContacts(contactpool_6_3, contactlist_6_3, contactkeys_6_3, n_added_6_3);
+    _RemoveAllContacts(contactpool_3_3, contactlist_3_3, contactkeys_3_3, n_added_3_3);
+    _RemoveAllContacts(contactpool_333_3, contactlist_333_3, contactkeys_333_3, n_added_333_3);
+    _RemoveAllContacts(contactpool_333_6, contactlist_333_6, contactkeys_333_6, n_added_333_6);
+    _RemoveAllContacts(contactpool_333_333, contactlist_333_333, contactkeys_333_333, n_added_333_333);
+    _RemoveAllContacts(contactpool_666_3, contactlist_666_3, contactkeys_666_3, n_added_666_3);
+    _RemoveAllContacts(contactpool_666_6, contactlist_666_6, contactkeys_666_6, n_added_666_6);
+    _RemoveAllContacts(contactpool_666_333, contactlist_666_333, contactkeys_666_333, n_added_666_333);
+    _RemoveAllContacts(contactpool_666_666, contactlist_666_666, contactkeys_666_666, n_added_666_666);
+    _RemoveAllContacts(contactpool_6_6_rolling, contactlist_6_6_rolling, contactkeys_6_6_rolling, n_added_6_6_rolling);
+    cache_table.clear();
+    cache_preset = false;
+    last_key = {nullptr, nullptr, -1};
+}
+
+template <class Tlist>
+void _RewindContacts(Tlist& contactlist, std::vector<ChContactContainerNSC::ContactKey>& keys, int& n_added) {
+    contactlist.clear();
+    keys.clear();
+    n_added = 0;
 }
 
 void ChContactContainerNSC::BeginAddContact() {
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_333_3 = contactlist_333_3.begin();
-    n_added_333_3 = 0;
-
-    lastcontact_333_6 = contactlist_333_6.begin();
-    n_added_333_6 = 0;
-
-    lastcontact_333_333 = contactlist_333_333.begin();
-    n_added_333_333 = 0;
-
-    lastcontact_666_3 = contactlist_666_3.begin();
-    n_added_666_3 = 0;
-
-    lastcontact_666_6 = contactlist_666_6.begin();
-    n_added_666_6 = 0;
-
-    lastcontact_666_333 = contactlist_666_333.begin();
-    n_added_666_333 = 0;
-
-    lastcontact_666_666 = contactlist_666_666.begin();
-    n_added_666_666 = 0;
-
-    lastcontact_6_6_rolling = contactlist_6_6_rolling.begin();
-    n_added_6_6_rolling = 0;
+    // Save the reactions of the current contacts, before contact objects are reused (unless the reaction cache was
+    // explicitly loaded through SetReactionCache)
+    if (!cache_preset)
+        CacheReactions();
+    cache_preset = false;
+
+    _RewindContacts(contactlist_6_6, contactkeys_6_6, n_added_6_6);
+    _RewindContacts(contactlist_6_3, contactkeys_6_3, n_added_6_3);
+    _RewindContacts(contactlist_3_3, contactkeys_3_3, n_added_3_3);
+    _RewindContacts(contactlist_333_3, contactkeys_333_3, n_added_333_3);
+    _RewindContacts(contactlist_333_6, contactkeys_333_6, n_added_333_6);
+    _RewindContacts(contactlist_333_333, contactkeys_333_333, n_added_333_333);
+    _RewindContacts(contactlist_666_3, contactkeys_666_3, n_added_666_3);
+    _RewindContacts(contactlist_666_6, contactkeys_666_6, n_added_666_6);
+    _RewindContacts(contactlist_666_333, contactkeys_666_333, n_added_666_333);
+    _RewindContacts(contactlist_666_666, contactkeys_666_666, n_added_666_666);
+    _RewindContacts(contactlist_6_6_rolling, contactkeys_6_6_rolling, n_added_6_6_rolling);
+
+    last_key = {nullptr, nullptr, -1};
 }
 
 void ChContactContainerNSC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
+    // Nothing to do: contact objects that were not reused are kept in the pools
+}
+
+void ChContactContainerNSC::SetUseReactionCache(bool val) {
+    use_reaction_cache = val;
+    if (!val) {
+        cache_table.clear();
+        cache_preset = false;
     }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
+}
+
+// Hash function for contact keys (pointers and feature index are mixed, since pointers have low entropy in low bits).
+static size_t HashContactKey(const ChContactContainerNSC::ContactKey& key) {
+    uint64_t h = (uint64_t)(uintptr_t)key.shapeA;
+    h = h * 0x9E3779B97F4A7C15ULL ^ (uint64_t)(uintptr_t)key.shapeB;
+    h = h * 0x9E3779B97F4A7C15ULL ^ (uint64_t)key.feature;
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 32;
+    return (size_t)h;
+}
+
+static bool SameContactKey(const ChContactContainerNSC::ContactKey& k1, const ChContactContainerNSC::ContactKey& k2) {
+    return k1.shapeA == k2.shapeA && k1.shapeB == k2.shapeB && k1.feature == k2.feature;
+}
+
+static void _CacheReactions(const std::vector<ChContactContainerNSC::ContactKey>& keys,
+                     int stride,
+                     int& offset,
+                     std::vector<ChContactContainerNSC::CachedReaction>& table) {
+    size_t mask = table.size() - 1;
+    for (const auto& key : keys) {
+        size_t slot = HashContactKey(key) & mask;
+        while (table[slot].key.shapeA && !SameContactKey(table[slot].key, key))
+            slot = (slot + 1) & mask;
+        // Keep only the first occurrence of duplicated keys
+        if (!table[slot].key.shapeA) {
+            table[slot].key = key;
+            table[slot].offset = offset;
+            table[slot].stride = stride;
+        }
+        offset += stride;
     }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
+}
+
+void ChContactContainerNSC::CacheReactions() {
+    int n_contacts = GetNcontacts();
+    if (!use_reaction_cache || n_contacts == 0) {
+        cache_table.clear();
+        return;
     }
 
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
+    // Gather the reactions of all current contacts
+    cache_L.resize(GetDOC_d());
+    IntStateGatherReactions(0, cache_L);
+
+    // Fill the hash table (load factor at most 0.5), in the same order used in IntStateGatherReactions
+    size_t table_size = 16;
+    while (table_size < 2 * (size_t)n_contacts)
+        table_size *= 2;
+    CachedReaction empty;
+    empty.key = {nullptr, nullptr, -1};
+    empty.offset = 0;
+    empty.stride = 0;
+    cache_table.assign(table_size, empty);
+
+    int offset = 0;
+    _CacheReactions(contactkeys_6_6, 3, offset, cache_table);
+    _CacheReactions(contactkeys_6_3, 3, offset, cache_table);
+    _CacheReactions(contactkeys_3_3, 3, offset, cache_table);
+    _CacheReactions(contactkeys_333_3, 3, offset, cache_table);
+    _CacheReactions(contactkeys_333_6, 3, offset, cache_table);
+    _CacheReactions(contactkeys_333_333, 3, offset, cache_table);
+    _CacheReactions(contactkeys_666_3, 3, offset, cache_table);
+    _CacheReactions(contactkeys_666_6, 3, offset, cache_table);
+    _CacheReactions(contactkeys_666_333, 3, offset, cache_table);
+    _CacheReactions(contactkeys_666_666, 3, offset, cache_table);
+    _CacheReactions(contactkeys_6_6_rolling, 6, offset, cache_table);
+}
+
+static void _GetContactKeys(const std::vector<ChContactContainerNSC::ContactKey>& keys,
+                            int stride,
+                            std::vector<ChContactContainerNSC::ContactKey>& all_keys,
+                            std::vector<int>& all_strides) {
+    all_keys.insert(all_keys.end(), keys.begin(), keys.end());
+    all_strides.insert(all_strides.end(), keys.size(), stride);
+}
+
+void ChContactContainerNSC::GetContactKeys(std::vector<ContactKey>& keys, std::vector<int>& strides) const {
+    keys.clear();
+    strides.clear();
+    _GetContactKeys(contactkeys_6_6, 3, keys, strides);
+    _GetContactKeys(contactkeys_6_3, 3, keys, strides);
+    _GetContactKeys(contactkeys_3_3, 3, keys, strides);
+    _GetContactKeys(contactkeys_333_3, 3, keys, strides);
+    _GetContactKeys(contactkeys_333_6, 3, keys, strides);
+    _GetContactKeys(contactkeys_333_333, 3, keys, strides);
+    _GetContactKeys(contactkeys_666_3, 3, keys, strides);
+    _GetContactKeys(contactkeys_666_6, 3, keys, strides);
+    _GetContactKeys(contactkeys_666_333, 3, keys, strides);
+    _GetContactKeys(contactkeys_666_666, 3, keys, strides);
+    _GetContactKeys(contactkeys_6_6_rolling, 6, keys, strides);
+}
+
+void ChContactContainerNSC::SetReactionCache(const std::vector<ContactKey>& keys,
+                                             const std::vector<int>& strides,
+                                             const ChVectorDynamic<>& L) {
+    assert(keys.size() == strides.size());
+    cache_table.clear();
+    cache_preset = use_reaction_cache;
+    if (!use_reaction_cache || keys.empty())
+        return;
+
+    cache_L = L;
+
+    size_t table_size = 16;
+    while (table_size < 2 * keys.size())
+        table_size *= 2;
+    CachedReaction empty;
+    empty.key = {nullptr, nullptr, -1};
+    empty.offset = 0;
+    empty.stride = 0;
+    cache_table.assign(table_size, empty);
+
+    size_t mask = table_size - 1;
+    int offset = 0;
+    for (size_t i = 0; i < keys.size(); i++) {
+        size_t slot = HashContactKey(keys[i]) & mask;
+        while (cache_table[slot].key.shapeA && !SameContactKey(cache_table[slot].key, keys[i]))
+            slot = (slot + 1) & mask;
+        if (!cache_table[slot].key.shapeA) {
+            cache_table[slot].key = keys[i];
+            cache_table[slot].offset = offset;
+            cache_table[slot].stride = strides[i];
+        }
+        offset += strides[i];
     }
+    assert(offset == (int)L.size());
+}
+
+const ChContactContainerNSC::CachedReaction* ChContactContainerNSC::FindCachedReaction(const ContactKey& key) const {
+    if (cache_table.empty())
+        return nullptr;
+    size_t mask = cache_table.size() - 1;
+    size_t slot = HashContactKey(key) & mask;
+    while (cache_table[slot].key.shapeA) {
+        if (SameContactKey(cache_table[slot].key, key))
+            return &cache_table[slot];
+        slot = (slot + 1) & mask;
+    }
+    return nullptr;
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact list
-                           Titer& lastcontact,                       // last contact acquired
-                           int& n_added,                             // number of contacts inserted
-                           ChContactContainer* container,            // contact container
-                           Ta* objA,                                 // collidable object A
-                           Tb* objB,                                 // collidable object B
-                           const collision::ChCollisionInfo& cinfo,  // collision information
-                           const ChMaterialCompositeNSC& cmat        // composite material
+// Number of reactions of a contact object
+template <class Tcont>
+int _NumReactions(const Tcont* contact) {
+    return 3;
+}
+
+static int _NumReactions(const ChContactContainerNSC::ChContactNSCrolling_6_6* contact) {
+    return 6;
+}
+
+template <class Tpool, class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(Tpool& contactpool,                                    // contact pool
+                           std::vector<Tcont*>& contactlist,                      // active contacts
+                           std::vector<ChContactContainerNSC::ContactKey>& keys,  // keys of active contacts
+                           int& n_added,                                          // number of contacts inserted
+                           ChContactContainer* container,                         // contact container
+                           Ta* objA,                                              // collidable object A
+                           Tb* objB,                                              // collidable object B
+                           const collision::ChCollisionInfo& cinfo,               // collision information
+                           const ChMaterialCompositeNSC& cmat,                    // composite material
+                           const ChContactContainerNSC::ContactKey& key,          // contact key
+                           const ChContactContainerNSC::CachedReaction* cached,   // cached reactions (if any)
+                           const ChVectorDynamic<>& cache_L                       // cached reaction values
 ) {
-    if (lastcontact != contactlist.end()) {
+    Tcont* mc;
+    if (n_added < (int)contactpool.size()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
-        lastcontact++;
+        mc = &contactpool[n_added];
+        mc->Reset(objA, objB, cinfo, cmat);
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        contactpool.emplace_back(container, objA, objB, cinfo, cmat);
+        mc = &contactpool.back();
     }
+
+    // warm start with the reactions of the matching contact at the previous step
+    if (cached && cached->stride == _NumReactions(mc))
+        mc->ContIntStateScatterReactions(cached->offset, cache_L);
+
+    contactlist.push_back(mc);
+    keys.push_back(key);
     n_added++;
 }
 
@@ -212,10 +342,8 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& cinfo,
         return;
     }
 
-    // Create the composite material
-    ChMaterialCompositeNSC cmat(GetSystem()->composition_strategy.get(),
-                                std::static_pointer_cast<ChMaterialSurfaceNSC>(mat1),
-                                std::static_pointer_cast<ChMaterialSurfaceNSC>(mat2));
+    // Get the composite material (computed only once for each pair of materials)
+    ChMaterialCompositeNSC cmat(composite_table.GetComposite(GetSystem()->composition_strategy.get(), mat1, mat2));
 
     InsertContact(cinfo, cmat);
 }
@@ -237,10 +365,9 @@ void ChContactContainerNSC::AddContact(const collision::ChCollisionInfo& cinfo)
         return;
     }
 
-    // Create the composite material
-    ChMaterialCompositeNSC cmat(GetSystem()->composition_strategy.get(),
-                                std::static_pointer_cast<ChMaterialSurfaceNSC>(cinfo.shapeA->GetMaterial()),
-                                std::static_pointer_cast<ChMaterialSurfaceNSC>(cinfo.shapeB->GetMaterial()));
+    // Get the composite material (computed only once for each pair of materials)
+    ChMaterialCompositeNSC cmat(composite_table.GetComposite(
+        GetSystem()->composition_strategy.get(), cinfo.shapeA->GetMaterial(), cinfo.shapeB->GetMaterial()));
 
     // Check for a user-provided callback to modify the material
     if (GetAddContactCallback()) {
@@ -254,6 +381,19 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
+    // Identify the contact by the colliding shapes (or models, if shapes are not available) and by its index among the
+    // contacts reported for the same pair. Look for the same contact at the previous step, unless the collision
+    // system provides its own persistent reaction cache.
+    ContactKey key;
+    key.shapeA = cinfo.shapeA ? (const void*)cinfo.shapeA : (const void*)cinfo.modelA;
+    key.shapeB = cinfo.shapeB ? (const void*)cinfo.shapeB : (const void*)cinfo.modelB;
+    key.feature = (key.shapeA == last_key.shapeA && key.shapeB == last_key.shapeB) ? last_key.feature + 1 : 0;
+    last_key = key;
+
+    const CachedReaction* cached = nullptr;
+    if (use_reaction_cache && !cinfo.reaction_cache)
+        cached = FindCachedReaction(key);
+
     // CREATE THE CONTACTS
     //
     // Switch among the various cases of contacts: i.e. between a 6-dof variable and another 6-dof variable,
@@ -271,22 +411,22 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_3_3, contactlist_3_3, contactkeys_3_3, n_added_3_3, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactpool_6_3, contactlist_6_3, contactkeys_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactpool_333_3, contactlist_333_3, contactkeys_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactpool_666_3, contactlist_666_3, contactkeys_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat, key, cached, cache_L);
             }
         } break;
 
@@ -295,25 +435,25 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_6_3, contactlist_6_3, contactkeys_6_3, n_added_6_3, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6    ***NOTE: for body-body one could have rolling friction: ***
                 if (cmat.rolling_friction || cmat.spinning_friction) {
-                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this, objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactpool_6_6_rolling, contactlist_6_6_rolling, contactkeys_6_6_rolling, n_added_6_6_rolling, this, objA, objB, cinfo, cmat, key, cached, cache_L);
                 } else {
-                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactpool_6_6, contactlist_6_6, contactkeys_6_6, n_added_6_6, this, objA, objB, cinfo, cmat, key, cached, cache_L);
                 }
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactpool_333_6, contactlist_333_6, contactkeys_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactpool_666_6, contactlist_666_6, contactkeys_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat, key, cached, cache_L);
             }
         } break;
 
@@ -322,20 +462,20 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_333_3, contactlist_333_3, contactkeys_333_3, n_added_333_3, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_333_6, contactlist_333_6, contactkeys_333_6, n_added_333_6, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_333_333, contactlist_333_333, contactkeys_333_333, n_added_333_333, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactpool_666_333, contactlist_666_333, contactkeys_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat, key, cached, cache_L);
             }
         } break;
 
@@ -344,19 +484,19 @@ void ChContactContainerNSC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_666_3, contactlist_666_3, contactkeys_666_3, n_added_666_3, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_666_6, contactlist_666_6, contactkeys_666_6, n_added_666_6, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_666_333, contactlist_666_333, contactkeys_666_333, n_added_666_333, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactpool_666_666, contactlist_666_666, contactkeys_666_666, n_added_666_666, this, objA, objB, cinfo, cmat, key, cached, cache_L);
             }
         } break;
 
@@ -399,8 +539,8 @@ ChVector<> ChContactContainerNSC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(std::vector<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -413,8 +553,8 @@ void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::Repo
 }
 
 template <class Tcont>
-void _ReportAllContactsRolling(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsRolling(std::vector<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -445,11 +585,11 @@ void ChContactContainerNSC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 
 template <class Tcont>
 void _IntStateGatherReactions(unsigned int& coffset,
-                              std::list<Tcont*>& contactlist,
+                              std::vector<Tcont*>& contactlist,
                               const unsigned int off_L,
                               ChVectorDynamic<>& L,
                               const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
         coffset += stride;
@@ -474,11 +614,11 @@ void ChContactContainerNSC::IntStateGatherReactions(const unsigned int off_L, Ch
 
 template <class Tcont>
 void _IntStateScatterReactions(unsigned int& coffset,
-                               std::list<Tcont*>& contactlist,
+                               std::vector<Tcont*>& contactlist,
                                const unsigned int off_L,
                                const ChVectorDynamic<>& L,
                                const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
         coffset += stride;
@@ -503,14 +643,14 @@ void ChContactContainerNSC::IntStateScatterReactions(const unsigned int off_L, c
 
 template <class Tcont>
 void _IntLoadResidual_CqL(unsigned int& coffset,           // offset of the contacts
-                          std::list<Tcont*>& contactlist,  // list of contacts
+                          std::vector<Tcont*>& contactlist,  // list of contacts
                           const unsigned int off_L,        // offset in L multipliers
                           ChVectorDynamic<>& R,            // result: the R residual, R += c*Cq'*L
                           const ChVectorDynamic<>& L,      // the L vector
                           const double c,                  // a scaling factor
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
         coffset += stride;
@@ -538,7 +678,7 @@ void ChContactContainerNSC::IntLoadResidual_CqL(const unsigned int off_L,
 
 template <class Tcont>
 void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
-                          std::list<Tcont*>& contactlist,  // contact list
+                          std::vector<Tcont*>& contactlist,  // contact list
                           const unsigned int off,          // offset in Qc residual
                           ChVectorDynamic<>& Qc,           // result: the Qc residual, Qc += c*C
                           const double c,                  // a scaling factor
@@ -546,7 +686,7 @@ void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
                           double recovery_clamp,           // value for min/max clamping of c*C
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
         coffset += stride;
@@ -575,7 +715,7 @@ void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
 
 template <class Tcont>
 void _IntToDescriptor(unsigned int& coffset,
-                      std::list<Tcont*>& contactlist,
+                      std::vector<Tcont*>& contactlist,
                       const unsigned int off_v,
                       const ChStateDelta& v,
                       const ChVectorDynamic<>& R,
@@ -583,7 +723,7 @@ void _IntToDescriptor(unsigned int& coffset,
                       const ChVectorDynamic<>& L,
                       const ChVectorDynamic<>& Qc,
                       const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
         coffset += stride;
@@ -613,13 +753,13 @@ void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
 
 template <class Tcont>
 void _IntFromDescriptor(unsigned int& coffset,
-                        std::list<Tcont*>& contactlist,
+                        std::vector<Tcont*>& contactlist,
                         const unsigned int off_v,
                         ChStateDelta& v,
                         const unsigned int off_L,
                         ChVectorDynamic<>& L,
                         const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
         coffset += stride;
@@ -648,8 +788,8 @@ void ChContactContainerNSC::IntFromDescriptor(const unsigned int off_v,
 // SOLVER INTERFACES
 
 template <class Tcont>
-void _InjectConstraints(std::list<Tcont*>& contactlist, ChSystemDescriptor& mdescriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectConstraints(std::vector<Tcont*>& contactlist, ChSystemDescriptor& mdescriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->InjectConstraints(mdescriptor);
         ++itercontact;
@@ -671,8 +811,8 @@ void ChContactContainerNSC::InjectConstraints(ChSystemDescriptor& mdescriptor) {
 }
 
 template <class Tcont>
-void _ConstraintsBiReset(std::list<Tcont*>& contactlist) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiReset(std::vector<Tcont*>& contactlist) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiReset();
         ++itercontact;
@@ -694,8 +834,8 @@ void ChContactContainerNSC::ConstraintsBiReset() {
 }
 
 template <class Tcont>
-void _ConstraintsBiLoad_C(std::list<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiLoad_C(std::vector<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
         ++itercontact;
@@ -721,9 +861,9 @@ void ChContactContainerNSC::ConstraintsLoadJacobians() {
 }
 
 template <class Tcont>
-void _ConstraintsFetch_react(std::list<Tcont*>& contactlist, double factor) {
+void _ConstraintsFetch_react(std::vector<Tcont*>& contactlist, double factor) {
     // From constraints to react vector:
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsFetch_react(factor);
         ++itercontact;
@@ -15,19 +15,23 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
+#include <deque>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
 #include "chrono/physics/ChContactable.h"
+#include "chrono/physics/ChMaterialCompositeTable.h"
 
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
+/// Implemented using pools of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
 /// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
 /// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Contacts are identified across steps by the pair of colliding shapes and a feature index, so that the reactions of
+/// the previous step can be used as initial guess for the solver (warm start), see SetUseReactionCache().
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -43,19 +47,59 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     typedef ChContactNSCrolling<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSCrolling_6_6;
 
+    /// Key identifying a contact across time steps: the two colliding shapes (or collision models, if the shapes are
+    /// not available) and a feature index, i.e. the index of the contact among those reported for the same pair.
+    struct ContactKey {
+        const void* shapeA;
+        const void* shapeB;
+        int feature;
+    };
+
+    /// Entry in the reaction cache (open-addressing hash table).
+    struct CachedReaction {
+        ContactKey key;  ///< contact key (null shapeA marks an empty slot)
+        int offset;      ///< offset of the contact reactions in the cached reaction vector
+        int stride;      ///< number of reactions of the contact (3, or 6 for rolling contacts)
+    };
+
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
+    // Contact objects are stored in pools (chunked contiguous storage, with stable addresses) and are reused across
+    // steps. The lists hold the active contacts (the first n_added objects in each pool), with their keys.
+    std::deque<ChContactNSC_6_6, Eigen::aligned_allocator<ChContactNSC_6_6>> contactpool_6_6;
+    std::deque<ChContactNSC_6_3, Eigen::aligned_allocator<ChContactNSC_6_3>> contactpool_6_3;
+    std::deque<ChContactNSC_3_3, Eigen::aligned_allocator<ChContactNSC_3_3>> contactpool_3_3;
+    std::deque<ChContactNSC_333_3, Eigen::aligned_allocator<ChContactNSC_333_3>> contactpool_333_3;
+    std::deque<ChContactNSC_333_6, Eigen::aligned_allocator<ChContactNSC_333_6>> contactpool_333_6;
+    std::deque<ChContactNSC_333_333, Eigen::aligned_allocator<ChContactNSC_333_333>> contactpool_333_333;
+    std::deque<ChContactNSC_666_3, Eigen::aligned_allocator<ChContactNSC_666_3>> contactpool_666_3;
+    std::deque<ChContactNSC_666_6, Eigen::aligned_allocator<ChContactNSC_666_6>> contactpool_666_6;
+    std::deque<ChContactNSC_666_333, Eigen::aligned_allocator<ChContactNSC_666_333>> contactpool_666_333;
+    std::deque<ChContactNSC_666_666, Eigen::aligned_allocator<ChContactNSC_666_666>> contactpool_666_666;
+    std::deque<ChContactNSCrolling_6_6, Eigen::aligned_allocator<ChContactNSCrolling_6_6>> contactpool_6_6_rolling;
+
+    std::vector<ChContactNSC_6_6*> contactlist_6_6;
+    std::vector<ChContactNSC_6_3*> contactlist_6_3;
+    std::vector<ChContactNSC_3_3*> contactlist_3_3;
+    std::vector<ChContactNSC_333_3*> contactlist_333_3;
+    std::vector<ChContactNSC_333_6*> contactlist_333_6;
+    std::vector<ChContactNSC_333_333*> contactlist_333_333;
+    std::vector<ChContactNSC_666_3*> contactlist_666_3;
+    std::vector<ChContactNSC_666_6*> contactlist_666_6;
+    std::vector<ChContactNSC_666_333*> contactlist_666_333;
+    std::vector<ChContactNSC_666_666*> contactlist_666_666;
+    std::vector<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
+
+    std::vector<ContactKey> contactkeys_6_6;
+    std::vector<ContactKey> contactkeys_6_3;
+    std::vector<ContactKey> contactkeys_3_3;
+    std::vector<ContactKey> contactkeys_333_3;
+    std::vector<ContactKey> contactkeys_333_6;
+    std::vector<ContactKey> contactkeys_333_333;
+    std::vector<ContactKey> contactkeys_666_3;
+    std::vector<ContactKey> contactkeys_666_6;
+    std::vector<ContactKey> contactkeys_666_333;
+    std::vector<ContactKey> contactkeys_666_666;
+    std::vector<ContactKey> contactkeys_6_6_rolling;
 
     int n_added_6_6;
     int n_added_6_3;
@@ -69,18 +113,14 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     int n_added_666_666;
     int n_added_6_6_rolling;
 
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
+    bool use_reaction_cache;                  ///< carry over contact reactions from the previous step?
+    std::vector<CachedReaction> cache_table;  ///< hash table of the contacts of the previous step
+    ChVectorDynamic<> cache_L;                ///< reactions of the contacts of the previous step
+    ContactKey last_key;                      ///< key of the last inserted contact
+    bool cache_preset;                        ///< reaction cache loaded through SetReactionCache?
 
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    /// Composite materials of the material pairs encountered so far.
+    ChMaterialCompositeTable<ChMaterialSurfaceNSC, ChMaterialCompositeNSC> composite_table;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
@@ -102,8 +142,8 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
+    /// similar). Instead of simply deleting all the previous contacts, this optimized implementation caches their
+    /// reactions and rewinds the contact pools, so that previous contact objects are reused, to avoid too much
     /// allocation/deallocation.
     virtual void BeginAddContact() override;
 
@@ -120,9 +160,30 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void AddContact(const collision::ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). Contact objects that were not reused (if any) are kept in the pools for later steps.
     virtual void EndAddContact() override;
 
+    /// Enable/disable the reaction cache (default: false).
+    /// If enabled, the reactions of each new contact are initialized with those of the matching contact (same pair of
+    /// collision shapes and same feature index) of the previous step. This provides a good initial guess for
+    /// iterative solvers with warm start (see ChIterativeSolver::EnableWarmStart). Contacts that carry their own
+    /// persistent reaction cache (see ChCollisionInfo::reaction_cache) are not affected.
+    void SetUseReactionCache(bool val);
+
+    /// Return true if the reaction cache is enabled.
+    bool GetUseReactionCache() const { return use_reaction_cache; }
+
+    /// Get the keys and the number of reactions (3, or 6 for rolling contacts) of all current contacts, in the same
+    /// order used by IntStateGatherReactions.
+    void GetContactKeys(std::vector<ContactKey>& keys, std::vector<int>& strides) const;
+
+    /// Load the reaction cache with the given contacts, specified through their keys, number of reactions, and
+    /// reactions (stored consecutively in L). The next call to BeginAddContact uses this cache instead of the
+    /// reactions of the current contacts. This is used to restore the contact warm start from a checkpoint.
+    void SetReactionCache(const std::vector<ContactKey>& keys,
+                          const std::vector<int>& strides,
+                          const ChVectorDynamic<>& L);
+
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
     /// object.
     virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
@@ -197,6 +258,12 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
   private:
     void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat);
+
+    /// Store the reactions of the current contacts in the reaction cache.
+    void CacheReactions();
+
+    /// Find the cached reactions of the contact with given key. Return nullptr if not found.
+    const CachedReaction* FindCachedReaction(const ContactKey& key) const;
 };
 
 CH_CLASS_VERSION(ChContactContainerNSC, 0)
@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <functional>
+
 #include "chrono/physics/ChContactContainerSMC.h"
 #include "chrono/physics/ChSystemSMC.h"
 
@@ -33,7 +36,10 @@ ChContactContainerSMC::ChContactContainerSMC()
       n_added_666_3(0),
       n_added_666_6(0),
       n_added_666_333(0),
-      n_added_666_666(0) {}
+      n_added_666_666(0),
+      num_term_groups(0) {
+    term_group_start.push_back(0);
+}
 
 ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {
     n_added_3_3 = 0;
@@ -46,6 +52,8 @@ ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other)
     n_added_666_6 = 0;
     n_added_666_333 = 0;
     n_added_666_666 = 0;
+    num_term_groups = 0;
+    term_group_start.push_back(0);
 }
 
 ChContactContainerSMC::~ChContactContainerSMC() {
@@ -82,6 +90,11 @@ void ChContactContainerSMC::RemoveAllContacts() {
     _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
     _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
     //**TODO*** cont. roll.
+
+    force_terms.clear();
+    term_order.clear();
+    term_group_start.assign(1, 0);
+    num_term_groups = 0;
 }
 
 void ChContactContainerSMC::BeginAddContact() {
@@ -166,6 +179,125 @@ void ChContactContainerSMC::EndAddContact() {
     //    delete (*lastcontact_roll);
     //    lastcontact_roll = contactlist_roll.erase(lastcontact_roll);
     //}
+
+    // evaluate the forces of all contacts
+    EvaluateContactForces();
+}
+
+// Variables of a contactable object with a single variable. Return nullptr for contactables with more variables.
+template <class Tobj>
+ChVariables* _ContactableVariables(Tobj* obj) {
+    return nullptr;
+}
+
+static ChVariables* _ContactableVariables(ChContactable_1vars<3>* obj) {
+    return obj->GetVariables1();
+}
+
+static ChVariables* _ContactableVariables(ChContactable_1vars<6>* obj) {
+    return obj->GetVariables1();
+}
+
+template <class Tcont>
+void _EvaluateContactForces(std::list<Tcont*>& contactlist,
+                            std::vector<ChContactContainerSMC::ForceTerm>& terms,
+                            int& offset,
+                            int nthreads) {
+    std::vector<Tcont*> contacts(contactlist.begin(), contactlist.end());
+    int ncontacts = (int)contacts.size();
+
+#pragma omp parallel for num_threads(nthreads) if (ncontacts > 64)
+    for (int i = 0; i < ncontacts; i++) {
+        Tcont* contact = contacts[i];
+        contact->EvaluateForce();
+
+        // Force terms on objA (-force at p1) and objB (force at p2)
+        ChVector<> force = contact->GetContactForceAbs();
+
+        auto& termA = terms[2 * (offset + i) + 0];
+        termA.obj = contact->GetObjA()->IsContactActive() ? contact->GetObjA() : nullptr;
+        termA.vars = _ContactableVariables(contact->GetObjA());
+        termA.force = -force;
+        termA.point = contact->GetContactP1();
+
+        auto& termB = terms[2 * (offset + i) + 1];
+        termB.obj = contact->GetObjB()->IsContactActive() ? contact->GetObjB() : nullptr;
+        termB.vars = _ContactableVariables(contact->GetObjB());
+        termB.force = force;
+        termB.point = contact->GetContactP2();
+    }
+
+    offset += ncontacts;
+}
+
+void ChContactContainerSMC::EvaluateContactForces() {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+
+    // Evaluate all contact forces in parallel and store them in the flat array of force terms.
+    // Note: the order of force terms is the same as the order in which contact forces were loaded in the residual.
+    force_terms.resize(2 * GetNcontacts());
+    int offset = 0;
+    _EvaluateContactForces(contactlist_3_3, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_6_3, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_6_6, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_333_3, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_333_6, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_333_333, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_666_3, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_666_6, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_666_333, force_terms, offset, nthreads);
+    _EvaluateContactForces(contactlist_666_666, force_terms, offset, nthreads);
+
+    // Group the force terms by the variables they act on. Terms in the same group are loaded sequentially, in their
+    // original order, while different groups (acting on different variables) can be loaded in parallel. Terms acting
+    // on contactables with more variables (e.g., mesh triangles) are loaded sequentially, after all other terms.
+    // This ensures that the residual does not depend on the number of threads.
+    term_order.clear();
+    term_group_start.clear();
+    num_term_groups = 0;
+
+    int nterms = (int)force_terms.size();
+    for (int i = 0; i < nterms; i++) {
+        if (force_terms[i].obj)
+            term_order.push_back(i);
+    }
+
+    if (nthreads > 1) {
+        std::stable_sort(term_order.begin(), term_order.end(), [this](int i1, int i2) {
+            ChVariables* v1 = force_terms[i1].vars;
+            ChVariables* v2 = force_terms[i2].vars;
+            if (!v1 || !v2)
+                return v1 && !v2;
+            return std::less<ChVariables*>()(v1, v2);
+        });
+        for (int k = 0; k < (int)term_order.size(); k++) {
+            ChVariables* vars = force_terms[term_order[k]].vars;
+            if (!vars)
+                break;
+            if (k == 0 || vars != force_terms[term_order[k - 1]].vars)
+                term_group_start.push_back(k);
+        }
+    } else {
+        // Sequential loading: all terms on single-variable contactables form one group
+        std::stable_partition(term_order.begin(), term_order.end(),
+                              [this](int i) { return force_terms[i].vars != nullptr; });
+        int k = 0;
+        while (k < (int)term_order.size() && force_terms[term_order[k]].vars)
+            k++;
+        if (k > 0)
+            term_group_start.push_back(0);
+    }
+
+    num_term_groups = (int)term_group_start.size();
+
+    // End marker for parallel groups, followed by the sequential terms
+    int k = 0;
+    if (num_term_groups > 0) {
+        k = term_group_start.back();
+        while (k < (int)term_order.size() && force_terms[term_order[k]].vars)
+            k++;
+    }
+    term_group_start.push_back(k);
 }
 
 template <class Tcont, class Titer, class Ta, class Tb>
@@ -179,12 +311,12 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact
                            const ChMaterialCompositeSMC& cmat        // composite material
 ) {
     if (lastcontact != contactlist.end()) {
-        // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
+        // reuse old contacts (contact forces are evaluated later, see EvaluateContactForces)
+        (*lastcontact)->ResetGeometry(objA, objB, cinfo, cmat);
         lastcontact++;
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
+        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat, false);
         contactlist.push_back(mc);
         lastcontact = contactlist.end();
     }
@@ -213,10 +345,8 @@ void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo,
         return;
     }
 
-    // Create the composite material
-    ChMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(mat1),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(mat2));
+    // Get the composite material (computed only once for each pair of materials)
+    ChMaterialCompositeSMC cmat(composite_table.GetComposite(GetSystem()->composition_strategy.get(), mat1, mat2));
 
     InsertContact(cinfo, cmat);
 }
@@ -242,10 +372,9 @@ void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo)
         return;
     }
 
-    // Create the composite material
-    ChMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(cinfo.shapeA->GetMaterial()),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(cinfo.shapeB->GetMaterial()));
+    // Get the composite material (computed only once for each pair of materials)
+    ChMaterialCompositeSMC cmat(composite_table.GetComposite(
+        GetSystem()->composition_strategy.get(), cinfo.shapeA->GetMaterial(), cinfo.shapeB->GetMaterial()));
 
     // Check for a user-provided callback to modify the material
     if (GetAddContactCallback()) {
@@ -428,26 +557,24 @@ void ChContactContainerSMC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 
 // STATE INTERFACE
 
-template <class Tcont>
-void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, const double c) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContIntLoadResidual_F(R, c);
-        ++itercontact;
+void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    // Load the contact forces from the flat array of force terms (see EvaluateContactForces).
+    // Groups of terms act on different variables and are processed in parallel.
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic, 64) if (num_term_groups > 256)
+    for (int ig = 0; ig < num_term_groups; ig++) {
+        for (int k = term_group_start[ig]; k < term_group_start[ig + 1]; k++) {
+            const auto& term = force_terms[term_order[k]];
+            term.obj->ContactForceLoadResidual_F(term.force * c, term.point, R);
+        }
     }
-}
 
-void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
-    _IntLoadResidual_F(contactlist_3_3, R, c);
-    _IntLoadResidual_F(contactlist_6_3, R, c);
-    _IntLoadResidual_F(contactlist_6_6, R, c);
-    _IntLoadResidual_F(contactlist_333_3, R, c);
-    _IntLoadResidual_F(contactlist_333_6, R, c);
-    _IntLoadResidual_F(contactlist_333_333, R, c);
-    _IntLoadResidual_F(contactlist_666_3, R, c);
-    _IntLoadResidual_F(contactlist_666_6, R, c);
-    _IntLoadResidual_F(contactlist_666_333, R, c);
-    _IntLoadResidual_F(contactlist_666_666, R, c);
+    // Sequentially load terms acting on contactables with more variables
+    for (int k = term_group_start[num_term_groups]; k < (int)term_order.size(); k++) {
+        const auto& term = force_terms[term_order[k]];
+        term.obj->ContactForceLoadResidual_F(term.force * c, term.point, R);
+    }
 }
 
 template <class Tcont>
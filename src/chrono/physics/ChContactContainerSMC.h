@@ -22,11 +22,15 @@
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactSMC.h"
 #include "chrono/physics/ChContactable.h"
+#include "chrono/physics/ChMaterialCompositeTable.h"
 
 namespace chrono {
 
 /// Class representing a container of many smooth (penalty) contacts.
 /// Implemented using linked lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
+/// Contact forces are evaluated in parallel once all contacts were added, and stored in a flat array of force terms
+/// (two per contact). These are loaded in the system residual grouped by the variables they act on, so that results
+/// are deterministic and do not depend on the number of threads (see ChSystem::SetNumThreads).
 class ChApi ChContactContainerSMC : public ChContactContainer {
   public:
     typedef ChContactSMC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactSMC_3_3;
@@ -40,6 +44,14 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<3, 3, 3> > ChContactSMC_666_333;
     typedef ChContactSMC<ChContactable_3vars<6, 6, 6>, ChContactable_3vars<6, 6, 6> > ChContactSMC_666_666;
 
+    /// Contribution of a contact to the generalized forces of one of its two contactable objects.
+    struct ForceTerm {
+        ChContactable* obj;  ///< contactable object (nullptr if not contact-active)
+        ChVariables* vars;   ///< variables of the contactable (nullptr for contactables with more variables)
+        ChVector<> force;    ///< contact force on the contactable (absolute frame)
+        ChVector<> point;    ///< application point (absolute frame)
+    };
+
   protected:
     std::list<ChContactSMC_3_3*> contactlist_3_3;
     std::list<ChContactSMC_6_3*> contactlist_6_3;
@@ -63,6 +75,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     int n_added_666_333;
     int n_added_666_666;
 
+    /// Composite materials of the material pairs encountered so far.
+    ChMaterialCompositeTable<ChMaterialSurfaceSMC, ChMaterialCompositeSMC> composite_table;
+
     std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
     std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
     std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
@@ -76,6 +91,11 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    std::vector<ForceTerm> force_terms;  ///< force terms of all contacts (2 per contact, in contact order)
+    std::vector<int> term_order;         ///< indices of active force terms, grouped by variables
+    std::vector<int> term_group_start;   ///< start of each group in term_order (plus start of sequential terms)
+    int num_term_groups;                 ///< number of groups of force terms that can be loaded in parallel
+
   public:
     ChContactContainerSMC();
     ChContactContainerSMC(const ChContactContainerSMC& other);
@@ -112,7 +132,8 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void AddContact(const collision::ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any), then
+    /// evaluates all contact forces (in parallel).
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -153,6 +174,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
   private:
     void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeSMC& cmat);
+
+    /// Evaluate the forces of all contacts and fill the array of force terms.
+    void EvaluateContactForces();
 };
 
 CH_CLASS_VERSION(ChContactContainerSMC, 0)
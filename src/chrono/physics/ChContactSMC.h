@@ -51,8 +51,9 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChMatrixDynamic<double> m_R;  ///< R = dQ/dv
     };
 
-    ChVector<> m_force;        ///< contact force on objB
-    ChContactJacobian* m_Jac;  ///< contact Jacobian data
+    ChVector<> m_force;            ///< contact force on objB
+    ChContactJacobian* m_Jac;      ///< contact Jacobian data
+    ChMaterialCompositeSMC m_mat;  ///< composite material for contact pair
 
   public:
     ChContactSMC() : m_Jac(NULL) {}
@@ -61,10 +62,14 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
                  Ta* mobjA,                                ///< collidable object A
                  Tb* mobjB,                                ///< collidable object B
                  const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
-                 const ChMaterialCompositeSMC& mat         ///< composite material
+                 const ChMaterialCompositeSMC& mat,        ///< composite material
+                 bool evaluate = true                      ///< if false, defer force evaluation (see EvaluateForce)
                  )
         : ChContactTuple<Ta, Tb>(mcontainer, mobjA, mobjB, cinfo), m_Jac(NULL) {
-        Reset(mobjA, mobjB, cinfo, mat);
+        if (evaluate)
+            Reset(mobjA, mobjB, cinfo, mat);
+        else
+            ResetGeometry(mobjA, mobjB, cinfo, mat);
     }
 
     ~ChContactSMC() { delete m_Jac; }
@@ -88,6 +93,17 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
                Tb* mobjB,                                ///< collidable object B
                const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
                const ChMaterialCompositeSMC& mat         ///< composite material
+    ) {
+        ResetGeometry(mobjA, mobjB, cinfo, mat);
+        EvaluateForce();
+    }
+
+    /// Reinitialize the geometric information and the material of this contact for reuse, without evaluating the
+    /// contact force. EvaluateForce() must be called before the contact force is used.
+    void ResetGeometry(Ta* mobjA,                                ///< collidable object A
+                       Tb* mobjB,                                ///< collidable object B
+                       const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
+                       const ChMaterialCompositeSMC& mat         ///< composite material
     ) {
         // Reset geometric information
         this->Reset_cinfo(mobjA, mobjB, cinfo);
@@ -95,18 +111,26 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        m_mat = mat;
+        m_force = VNULL;
+    }
+
+    /// Evaluate the contact force (and its Jacobians, if stiff contact is enabled) at the current states of the two
+    /// contactable objects. This function only modifies data of this contact object, so it can be called concurrently
+    /// for different contacts.
+    void EvaluateForce() {
         // Calculate contact force.
         m_force = CalculateForce(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 m_mat                                        // composite material for contact pair
         );
 
         // Set up and compute Jacobian matrices.
         if (static_cast<ChSystemSMC*>(this->container->GetSystem())->GetStiffContact()) {
             CreateJacobians();
-            CalculateJacobians(mat);
+            CalculateJacobians(m_mat);
         }
     }
 
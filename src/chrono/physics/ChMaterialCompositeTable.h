@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CH_MATERIAL_COMPOSITE_TABLE_H
+#define CH_MATERIAL_COMPOSITE_TABLE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChMaterialSurface.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_physics
+/// @{
+
+/// Cache of composite materials, indexed by the (unordered) pair of material identifiers.\n
+/// A composite material is computed the first time a pair of materials is encountered and then reused for all
+/// subsequent contacts between the same two materials. A cached composite is recomputed if the revision of either
+/// material or of the composition strategy changed since it was computed (see ChMaterialSurface::Modified).\n
+/// The composite is always computed with the material with the smaller identifier first; this assumes symmetric
+/// combination laws (see ChMaterialCompositionStrategy).\n
+/// Not thread safe.
+template <class Tmaterial, class Tcomposite>
+class ChMaterialCompositeTable {
+  public:
+    ChMaterialCompositeTable() : m_num_entries(0) {}
+
+    /// Return the composite material for the given pair of materials (both of type Tmaterial).
+    /// The returned reference is only valid until the next call.
+    const Tcomposite& GetComposite(ChMaterialCompositionStrategy* strategy,
+                                   const std::shared_ptr<ChMaterialSurface>& mat1,
+                                   const std::shared_ptr<ChMaterialSurface>& mat2) {
+        const auto& lo = mat1->GetIdentifier() <= mat2->GetIdentifier() ? mat1 : mat2;
+        const auto& hi = mat1->GetIdentifier() <= mat2->GetIdentifier() ? mat2 : mat1;
+
+        if (2 * (m_num_entries + 1) > m_entries.size())
+            Grow();
+
+        Entry& entry = m_entries[Find(lo->GetIdentifier(), hi->GetIdentifier())];
+        if (entry.id_lo < 0) {
+            entry.id_lo = lo->GetIdentifier();
+            entry.id_hi = hi->GetIdentifier();
+            m_num_entries++;
+        } else if (entry.strategy == strategy && entry.strategy_revision == strategy->GetRevision() &&
+                   entry.revision_lo == lo->GetRevision() && entry.revision_hi == hi->GetRevision()) {
+            return entry.composite;
+        }
+
+        entry.strategy = strategy;
+        entry.strategy_revision = strategy->GetRevision();
+        entry.revision_lo = lo->GetRevision();
+        entry.revision_hi = hi->GetRevision();
+        entry.composite =
+            Tcomposite(strategy, std::static_pointer_cast<Tmaterial>(lo), std::static_pointer_cast<Tmaterial>(hi));
+        return entry.composite;
+    }
+
+    /// Return the number of cached material pairs.
+    size_t GetNumPairs() const { return m_num_entries; }
+
+    /// Discard all cached composite materials.
+    void Clear() {
+        m_entries.clear();
+        m_num_entries = 0;
+    }
+
+  private:
+    struct Entry {
+        int id_lo = -1;  ///< identifier of first material (-1 for an empty slot)
+        int id_hi = -1;  ///< identifier of second material
+        uint64_t revision_lo = 0;
+        uint64_t revision_hi = 0;
+        ChMaterialCompositionStrategy* strategy = nullptr;
+        uint64_t strategy_revision = 0;
+        Tcomposite composite;
+    };
+
+    // Return the slot holding the given pair, or the empty slot where it should be inserted.
+    size_t Find(int id_lo, int id_hi) const {
+        size_t mask = m_entries.size() - 1;
+        uint64_t h = ((uint64_t)(uint32_t)id_lo << 32 | (uint32_t)id_hi) * 0x9E3779B97F4A7C15ull;
+        size_t i = (size_t)(h >> 32) & mask;
+        while (m_entries[i].id_lo >= 0 && (m_entries[i].id_lo != id_lo || m_entries[i].id_hi != id_hi))
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    // Double the table capacity (a power of 2) and re-insert all entries.
+    void Grow() {
+        std::vector<Entry> old(m_entries.size() ? 2 * m_entries.size() : 16);
+        old.swap(m_entries);
+        for (auto& entry : old) {
+            if (entry.id_lo >= 0)
+                m_entries[Find(entry.id_lo, entry.id_hi)] = entry;
+        }
+    }
+
+    std::vector<Entry> m_entries;
+    size_t m_num_entries;
+};
+
+/// @} chrono_physics
+
+}  // end namespace chrono
+
+#endif
@@ -13,7 +13,10 @@
 // =============================================================================
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <mutex>
+#include <vector>
 
 #include "chrono/physics/ChMaterialSurface.h"
 #include "chrono/physics/ChMaterialSurfaceSMC.h"
@@ -24,14 +27,55 @@ namespace chrono {
 
 // -----------------------------------------------------------------------------
 
+namespace {
+
+// Registry of material identifiers. Identifiers of deleted materials are recycled, so that identifiers stay compact.
+struct IdentifierRegistry {
+    std::mutex mutex;
+    int next = 0;
+    std::vector<int> free_list;
+};
+
+IdentifierRegistry& GetIdentifierRegistry() {
+    static IdentifierRegistry registry;
+    return registry;
+}
+
+int AcquireIdentifier() {
+    IdentifierRegistry& registry = GetIdentifierRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (registry.free_list.empty())
+        return registry.next++;
+    int id = registry.free_list.back();
+    registry.free_list.pop_back();
+    return id;
+}
+
+void ReleaseIdentifier(int id) {
+    IdentifierRegistry& registry = GetIdentifierRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.free_list.push_back(id);
+}
+
+// Revision numbers shared by materials and composition strategies (starting at 1, so that 0 is never a valid one).
+uint64_t NewRevision() {
+    static std::atomic<uint64_t> revision(0);
+    return ++revision;
+}
+
+}  // end anonymous namespace
+
 ChMaterialSurface::ChMaterialSurface()
     : static_friction(0.6f),
       sliding_friction(0.6f),
       rolling_friction(0),
       spinning_friction(0),
-      restitution(0.4f) {}
+      restitution(0.4f),
+      m_identifier(AcquireIdentifier()),
+      m_revision(NewRevision()) {}
 
-ChMaterialSurface::ChMaterialSurface(const ChMaterialSurface& other) {
+ChMaterialSurface::ChMaterialSurface(const ChMaterialSurface& other)
+    : m_identifier(AcquireIdentifier()), m_revision(NewRevision()) {
     static_friction = other.static_friction;
     sliding_friction = other.sliding_friction;
     rolling_friction = other.rolling_friction;
@@ -39,6 +83,25 @@ ChMaterialSurface::ChMaterialSurface(const ChMaterialSurface& other) {
     restitution = other.restitution;
 }
 
+ChMaterialSurface::~ChMaterialSurface() {
+    ReleaseIdentifier(m_identifier);
+}
+
+ChMaterialSurface& ChMaterialSurface::operator=(const ChMaterialSurface& other) {
+    // the identifier is not copied
+    static_friction = other.static_friction;
+    sliding_friction = other.sliding_friction;
+    rolling_friction = other.rolling_friction;
+    spinning_friction = other.spinning_friction;
+    restitution = other.restitution;
+    Modified();
+    return *this;
+}
+
+void ChMaterialSurface::Modified() {
+    m_revision = NewRevision();
+}
+
 void ChMaterialSurface::SetFriction(float val) {
     SetSfriction(val);
     SetKfriction(val);
@@ -66,6 +129,7 @@ void ChMaterialSurface::ArchiveIN(ChArchiveIn& marchive) {
     marchive >> CHNVP(rolling_friction);
     marchive >> CHNVP(spinning_friction);
     marchive >> CHNVP(restitution);
+    Modified();
 }
 
 std::shared_ptr<ChMaterialSurface> ChMaterialSurface::DefaultMaterial(ChContactMethod contact_method) {
@@ -78,4 +142,8 @@ std::shared_ptr<ChMaterialSurface> ChMaterialSurface::DefaultMaterial(ChContactM
     return nullptr;
 }
 
+// -----------------------------------------------------------------------------
+
+ChMaterialCompositionStrategy::ChMaterialCompositionStrategy() : m_revision(NewRevision()) {}
+
 }  // end namespace chrono
@@ -16,6 +16,7 @@
 #define CH_MATERIAL_SURFACE_H
 
 #include <algorithm>
+#include <cstdint>
 
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/serialization/ChArchive.h"
@@ -31,7 +32,7 @@ enum class ChContactMethod {
 /// Base class for specifying material properties for contact force generation.
 class ChApi ChMaterialSurface {
   public:
-    virtual ~ChMaterialSurface() {}
+    virtual ~ChMaterialSurface();
 
     /// "Virtual" copy constructor.
     virtual ChMaterialSurface* Clone() const = 0;
@@ -40,44 +41,65 @@ class ChApi ChMaterialSurface {
 
     /// Static sliding friction coefficient.
     /// Usually in 0..1 range, rarely above. Default 0.6.
-    void SetSfriction(float val) { static_friction = val; }
+    void SetSfriction(float val) { static_friction = val; Modified(); }
     float GetSfriction() const { return static_friction; }
 
     /// Kinetic sliding friction coefficient.
-    void SetKfriction(float val) { sliding_friction = val; }
+    void SetKfriction(float val) { sliding_friction = val; Modified(); }
     float GetKfriction() const { return sliding_friction; }
 
     /// Set both static friction and kinetic friction at once, with same value.
     void SetFriction(float val);
 
     /// Rolling friction coefficient. Usually around 1E-3. Default 0.
-    void SetRollingFriction(float val) { rolling_friction = val; }
+    void SetRollingFriction(float val) { rolling_friction = val; Modified(); }
     float GetRollingFriction() const { return rolling_friction; }
 
     /// Spinning friction coefficient. Usually around 1E-3. Default 0.
-    void SetSpinningFriction(float val) { spinning_friction = val; }
+    void SetSpinningFriction(float val) { spinning_friction = val; Modified(); }
     float GetSpinningFriction() const { return spinning_friction; }
 
     /// Normal coefficient of restitution. In the range [0,1]. Default 0.
-    void SetRestitution(float val) { restitution = val; }
+    void SetRestitution(float val) { restitution = val; Modified(); }
     float GetRestitution() const { return restitution; }
 
+    /// Return the identifier of this material.
+    /// Identifiers are small non-negative integers, unique among all existing materials (the identifier of a deleted
+    /// material is reused by materials created later). They are used to index data cached per material pair (see
+    /// ChMaterialCompositeTable).
+    int GetIdentifier() const { return m_identifier; }
+
+    /// Return the revision number of the material properties.
+    /// Revision numbers are unique over all materials; a new one is assigned whenever a property is changed through
+    /// one of the Set functions.
+    uint64_t GetRevision() const { return m_revision; }
+
     virtual void ArchiveOUT(ChArchiveOut& marchive);
     virtual void ArchiveIN(ChArchiveIn& marchive);
 
     /// Construct and return a contact material of the specified type with default properties.
     static std::shared_ptr<ChMaterialSurface> DefaultMaterial(ChContactMethod contact_method);
 
-    // Properties common to both NSC and SMC materials
+  protected:
+    ChMaterialSurface();
+    ChMaterialSurface(const ChMaterialSurface& other);
+    ChMaterialSurface& operator=(const ChMaterialSurface& other);
+
+    /// Mark the material properties as modified, so that any data derived from them is recomputed.
+    /// Derived classes must call this whenever they change a material property.
+    void Modified();
+
+    // Properties common to both NSC and SMC materials.
+    // These are only accessible through the Set/Get functions, so that every change is tracked (see GetRevision).
     float static_friction;    ///< Static coefficient of friction
     float sliding_friction;   ///< Kinetic coefficient of friction
     float rolling_friction;   ///< Rolling coefficient of friction
     float spinning_friction;  ///< Spinning coefficient of friction
     float restitution;        ///< Coefficient of restitution
 
-  protected:
-    ChMaterialSurface();
-    ChMaterialSurface(const ChMaterialSurface& other);
+  private:
+    int m_identifier;     ///< material identifier (not copied)
+    uint64_t m_revision;  ///< revision number of the material properties
 };
 
 CH_CLASS_VERSION(ChMaterialSurface, 0)
@@ -91,11 +113,17 @@ class ChApi ChMaterialComposite {
 /// Base class for material composition strategy.
 /// Implements the default combination laws for coefficients of friction, cohesion, compliance, etc.
 /// Derived classes can override one or more of these combination laws.
-/// Enabling the use of a customized composition strategy is system type-dependent.
+/// Enabling the use of a customized composition strategy is system type-dependent.\n
+/// Combination laws must be symmetric in their two arguments, since composite materials are cached per unordered pair
+/// of materials (see ChMaterialCompositeTable).
 class ChApi ChMaterialCompositionStrategy {
   public:
+    ChMaterialCompositionStrategy();
     virtual ~ChMaterialCompositionStrategy() {}
 
+    /// Return the revision number of this strategy (unique over all strategies and materials).
+    uint64_t GetRevision() const { return m_revision; }
+
     virtual float CombineFriction(float a1, float a2) const { return std::min<float>(a1, a2); }
     virtual float CombineCohesion(float a1, float a2) const { return std::min<float>(a1, a2); }
     virtual float CombineRestitution(float a1, float a2) const { return std::min<float>(a1, a2); }
@@ -105,6 +133,9 @@ class ChApi ChMaterialCompositionStrategy {
     virtual float CombineAdhesionMultiplier(float a1, float a2) const { return std::min<float>(a1, a2); }
     virtual float CombineStiffnessCoefficient(float a1, float a2) const { return (a1 + a2) / 2; }
     virtual float CombineDampingCoefficient(float a1, float a2) const { return (a1 + a2) / 2; }
+
+  private:
+    uint64_t m_revision;
 };
 
 }  // end namespace chrono
@@ -72,6 +72,7 @@ void ChMaterialSurfaceNSC::ArchiveIN(ChArchiveIn& marchive) {
     marchive >> CHNVP(complianceT);
     marchive >> CHNVP(complianceRoll);
     marchive >> CHNVP(complianceSpin);
+    Modified();
 }
 
 // -----------------------------------------------------------------------------
@@ -92,18 +93,18 @@ ChMaterialCompositeNSC::ChMaterialCompositeNSC()
 ChMaterialCompositeNSC::ChMaterialCompositeNSC(ChMaterialCompositionStrategy* strategy,
                                                std::shared_ptr<ChMaterialSurfaceNSC> mat1,
                                                std::shared_ptr<ChMaterialSurfaceNSC> mat2) {
-    static_friction = strategy->CombineFriction(mat1->static_friction, mat2->static_friction);
-    sliding_friction = strategy->CombineFriction(mat1->sliding_friction, mat2->sliding_friction);
-    restitution = strategy->CombineRestitution(mat1->restitution, mat2->restitution);
-    cohesion = strategy->CombineCohesion(mat1->cohesion, mat2->cohesion);
-    dampingf = strategy->CombineDamping(mat1->dampingf, mat2->dampingf);
-    compliance = strategy->CombineCompliance(mat1->compliance, mat2->compliance);
-    complianceT = strategy->CombineCompliance(mat1->complianceT, mat2->complianceT);
-
-    rolling_friction = strategy->CombineFriction(mat1->rolling_friction, mat2->rolling_friction);
-    spinning_friction = strategy->CombineFriction(mat1->spinning_friction, mat2->spinning_friction);
-    complianceRoll = strategy->CombineCompliance(mat1->complianceRoll , mat2->complianceRoll);
-    complianceSpin = strategy->CombineCompliance(mat1->complianceSpin , mat2->complianceSpin);
+    static_friction = strategy->CombineFriction(mat1->GetSfriction(), mat2->GetSfriction());
+    sliding_friction = strategy->CombineFriction(mat1->GetKfriction(), mat2->GetKfriction());
+    restitution = strategy->CombineRestitution(mat1->GetRestitution(), mat2->GetRestitution());
+    cohesion = strategy->CombineCohesion(mat1->GetCohesion(), mat2->GetCohesion());
+    dampingf = strategy->CombineDamping(mat1->GetDampingF(), mat2->GetDampingF());
+    compliance = strategy->CombineCompliance(mat1->GetCompliance(), mat2->GetCompliance());
+    complianceT = strategy->CombineCompliance(mat1->GetComplianceT(), mat2->GetComplianceT());
+
+    rolling_friction = strategy->CombineFriction(mat1->GetRollingFriction(), mat2->GetRollingFriction());
+    spinning_friction = strategy->CombineFriction(mat1->GetSpinningFriction(), mat2->GetSpinningFriction());
+    complianceRoll = strategy->CombineCompliance(mat1->GetComplianceRolling(), mat2->GetComplianceRolling());
+    complianceSpin = strategy->CombineCompliance(mat1->GetComplianceSpinning(), mat2->GetComplianceSpinning());
 }
 
 }  // end namespace chrono
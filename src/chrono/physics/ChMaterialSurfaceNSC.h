@@ -41,36 +41,36 @@ class ChApi ChMaterialSurfaceNSC : public ChMaterialSurface {
     virtual ChContactMethod GetContactMethod() const override { return ChContactMethod::NSC; }
 
     /// The cohesion max. force for normal pulling traction in contacts. Measuring unit: N. Default 0.
-    float GetCohesion() { return cohesion; }
-    void SetCohesion(float mval) { cohesion = mval; }
+    float GetCohesion() const { return cohesion; }
+    void SetCohesion(float mval) { cohesion = mval; Modified(); }
 
     /// The damping in contact, as a factor 'f': damping is a multiple of stiffness [K], that is: [R]=f*[K]
     /// Measuring unit: time, s. Default 0.
-    float GetDampingF() { return dampingf; }
-    void SetDampingF(float mval) { dampingf = mval; }
+    float GetDampingF() const { return dampingf; }
+    void SetDampingF(float mval) { dampingf = mval; Modified(); }
 
     /// Compliance of the contact, in normal direction.
     /// It is the inverse of the stiffness [K] , so for zero value one has a perfectly rigid contact.
     /// Measuring unit: m/N. Default 0.
-    float GetCompliance() { return compliance; }
-    void SetCompliance(float mval) { compliance = mval; }
+    float GetCompliance() const { return compliance; }
+    void SetCompliance(float mval) { compliance = mval; Modified(); }
 
     /// Compliance of the contact, in tangential direction.
     /// Measuring unit: m/N. Default 0.
-    float GetComplianceT() { return complianceT; }
-    void SetComplianceT(float mval) { complianceT = mval; }
+    float GetComplianceT() const { return complianceT; }
+    void SetComplianceT(float mval) { complianceT = mval; Modified(); }
 
     /// Rolling compliance of the contact, if using a nonzero rolling friction.
     /// (If there is no rolling friction, this has no effect.)
     /// Measuring unit: rad/Nm. Default 0.
-    float GetComplianceRolling() { return complianceRoll; }
-    void SetComplianceRolling(float mval) { complianceRoll = mval; }
+    float GetComplianceRolling() const { return complianceRoll; }
+    void SetComplianceRolling(float mval) { complianceRoll = mval; Modified(); }
 
     /// Spinning compliance of the contact, if using a nonzero rolling friction.
     /// (If there is no spinning friction, this has no effect.)
     /// Measuring unit: rad/Nm. Default 0.
-    float GetComplianceSpinning() { return complianceSpin; }
-    void SetComplianceSpinning(float mval) { complianceSpin = mval; }
+    float GetComplianceSpinning() const { return complianceSpin; }
+    void SetComplianceSpinning(float mval) { complianceSpin = mval; Modified(); }
 
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
@@ -78,6 +78,7 @@ class ChApi ChMaterialSurfaceNSC : public ChMaterialSurface {
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 
+  protected:
     float cohesion;
     float dampingf;
     float compliance;
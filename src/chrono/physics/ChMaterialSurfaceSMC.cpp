@@ -85,6 +85,7 @@ void ChMaterialSurfaceSMC::ArchiveIN(ChArchiveIn& marchive) {
     marchive >> CHNVP(kt);
     marchive >> CHNVP(gn);
     marchive >> CHNVP(gt);
+    Modified();
 }
 
 // -----------------------------------------------------------------------------
@@ -107,26 +108,26 @@ ChMaterialCompositeSMC::ChMaterialCompositeSMC()
 ChMaterialCompositeSMC::ChMaterialCompositeSMC(ChMaterialCompositionStrategy* strategy,
                                                std::shared_ptr<ChMaterialSurfaceSMC> mat1,
                                                std::shared_ptr<ChMaterialSurfaceSMC> mat2) {
-    float inv_E = (1 - mat1->poisson_ratio * mat1->poisson_ratio) / mat1->young_modulus +
-                  (1 - mat2->poisson_ratio * mat2->poisson_ratio) / mat2->young_modulus;
-    float inv_G = 2 * (2 - mat1->poisson_ratio) * (1 + mat1->poisson_ratio) / mat1->young_modulus +
-                  2 * (2 - mat2->poisson_ratio) * (1 + mat2->poisson_ratio) / mat2->young_modulus;
+    float inv_E = (1 - mat1->GetPoissonRatio() * mat1->GetPoissonRatio()) / mat1->GetYoungModulus() +
+                  (1 - mat2->GetPoissonRatio() * mat2->GetPoissonRatio()) / mat2->GetYoungModulus();
+    float inv_G = 2 * (2 - mat1->GetPoissonRatio()) * (1 + mat1->GetPoissonRatio()) / mat1->GetYoungModulus() +
+                  2 * (2 - mat2->GetPoissonRatio()) * (1 + mat2->GetPoissonRatio()) / mat2->GetYoungModulus();
 
     E_eff = 1 / inv_E;
     G_eff = 1 / inv_G;
 
-    mu_eff = strategy->CombineFriction(mat1->static_friction, mat2->static_friction);
-    muRoll_eff = strategy->CombineFriction(mat1->rolling_friction, mat2->rolling_friction);
-    muSpin_eff = strategy->CombineFriction(mat1->spinning_friction, mat2->spinning_friction);
-    cr_eff = strategy->CombineRestitution(mat1->restitution, mat2->restitution);
-    adhesion_eff = strategy->CombineCohesion(mat1->constant_adhesion, mat2->constant_adhesion);
-    adhesionMultDMT_eff = strategy->CombineAdhesionMultiplier(mat1->adhesionMultDMT, mat2->adhesionMultDMT);
-    adhesionSPerko_eff = strategy->CombineAdhesionMultiplier(mat1->adhesionSPerko, mat2->adhesionSPerko);
-
-    kn = strategy->CombineStiffnessCoefficient(mat1->kn, mat2->kn);
-    kt = strategy->CombineStiffnessCoefficient(mat1->kt, mat2->kt);
-    gn = strategy->CombineDampingCoefficient(mat1->gn, mat2->gn);
-    gt = strategy->CombineDampingCoefficient(mat1->gt, mat2->gt);
+    mu_eff = strategy->CombineFriction(mat1->GetSfriction(), mat2->GetSfriction());
+    muRoll_eff = strategy->CombineFriction(mat1->GetRollingFriction(), mat2->GetRollingFriction());
+    muSpin_eff = strategy->CombineFriction(mat1->GetSpinningFriction(), mat2->GetSpinningFriction());
+    cr_eff = strategy->CombineRestitution(mat1->GetRestitution(), mat2->GetRestitution());
+    adhesion_eff = strategy->CombineCohesion(mat1->GetAdhesion(), mat2->GetAdhesion());
+    adhesionMultDMT_eff = strategy->CombineAdhesionMultiplier(mat1->GetAdhesionMultDMT(), mat2->GetAdhesionMultDMT());
+    adhesionSPerko_eff = strategy->CombineAdhesionMultiplier(mat1->GetAdhesionSPerko(), mat2->GetAdhesionSPerko());
+
+    kn = strategy->CombineStiffnessCoefficient(mat1->GetKn(), mat2->GetKn());
+    kt = strategy->CombineStiffnessCoefficient(mat1->GetKt(), mat2->GetKt());
+    gn = strategy->CombineDampingCoefficient(mat1->GetGn(), mat2->GetGn());
+    gt = strategy->CombineDampingCoefficient(mat1->GetGt(), mat2->GetGt());
 }
 
 }  // end namespace chrono
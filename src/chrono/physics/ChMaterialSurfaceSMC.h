@@ -33,15 +33,15 @@ class ChApi ChMaterialSurfaceSMC : public ChMaterialSurface {
     virtual ChContactMethod GetContactMethod() const override { return ChContactMethod::SMC; }
 
     /// Young's modulus.
-    void SetYoungModulus(float val) { young_modulus = val; }
+    void SetYoungModulus(float val) { young_modulus = val; Modified(); }
     float GetYoungModulus() const { return young_modulus; }
 
     // Poisson ratio.
-    void SetPoissonRatio(float val) { poisson_ratio = val; }
+    void SetPoissonRatio(float val) { poisson_ratio = val; Modified(); }
     float GetPoissonRatio() const { return poisson_ratio; }
 
     /// Constant cohesion force.
-    void SetAdhesion(float val) { constant_adhesion = val; }
+    void SetAdhesion(float val) { constant_adhesion = val; Modified(); }
     float GetAdhesion() const { return constant_adhesion; }
 
     /// Adhesion multiplier in the Derjaguin-Muller-Toporov model.
@@ -53,7 +53,7 @@ class ChApi ChMaterialSurfaceSMC : public ChMaterialSurface {
     /// given the equilibrium penetration distance, y_eq,
     ///    adhesionMultDMT = 4.0 / 3.0 * E_eff * powf(y_eq, 1.5)
     /// </pre>
-    void SetAdhesionMultDMT(float val) { adhesionMultDMT = val; }
+    void SetAdhesionMultDMT(float val) { adhesionMultDMT = val; Modified(); }
     float GetAdhesionMultDMT() const { return adhesionMultDMT; }
 
 	/// Coefficient for Perko adhesion model.
@@ -64,14 +64,14 @@ class ChApi ChMaterialSurfaceSMC : public ChMaterialSurface {
     /// For lunar regolith, 
     ///    adhesionSPerko = 3.6e-2 * S^2
     /// </pre>
-    void SetAdhesionSPerko(float val) { adhesionSPerko = val; }
+    void SetAdhesionSPerko(float val) { adhesionSPerko = val; Modified(); }
     float GetAdhesionSPerko() const { return adhesionSPerko; }
 
     /// Stiffness and damping coefficients
-    void SetKn(float val) { kn = val; }
-    void SetKt(float val) { kt = val; }
-    void SetGn(float val) { gn = val; }
-    void SetGt(float val) { gt = val; }
+    void SetKn(float val) { kn = val; Modified(); }
+    void SetKt(float val) { kt = val; Modified(); }
+    void SetGn(float val) { gn = val; Modified(); }
+    void SetGt(float val) { gt = val; Modified(); }
 
     float GetKn() const { return kn; }
     float GetKt() const { return kt; }
@@ -87,6 +87,7 @@ class ChApi ChMaterialSurfaceSMC : public ChMaterialSurface {
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 
+  protected:
     float young_modulus;      ///< Young's modulus (elastic modulus)
     float poisson_ratio;      ///< Poisson ratio
     float constant_adhesion;  ///< Constant adhesion force, when constant adhesion model is used
@@ -132,6 +132,14 @@ class ChApi ChPhysicsItem : public ChObj {
     /// because they might need to update inner states, forces, springs, etc.
     /// This base version, by default, simply updates the item's time,
     /// and update the asset tree, if any.
+    ///
+    /// Thread safety: if parallel updates are enabled (see ChSystem::SetUseParallelUpdate, disabled by default),
+    /// the containing ChAssembly calls Update, IntStateGather, and IntStateScatter concurrently for different bodies,
+    /// then for different shafts, then for different links (IntLoadResidual_F and IntLoadResidual_Mv are called
+    /// concurrently for bodies and shafts only). Implementations for these items must then only modify data owned by
+    /// the item (including its markers, forces, and assets) and only read data of other items. Shared objects (e.g.,
+    /// assets or functions used by several items) must be safe to use concurrently. Meshes and other physics items
+    /// are always processed sequentially.
     virtual void Update(double mytime, bool update_assets = true);
 
     /// As above, but does not require updating of time-dependent
@@ -25,11 +25,13 @@
 #include "chrono/solver/ChSolverPJacobi.h"
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORColored.h"
 #include "chrono/solver/ChSolverPSSOR.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/utils/ChProfiler.h"
+#include "chrono/utils/ChTracer.h"
 
 using namespace chrono::collision;
 
@@ -59,6 +61,9 @@ ChSystem::ChSystem()
       tol_force(-1),
       maxiter(6),
       use_sleeping(false),
+      use_parallel_update(false),
+      use_islands(false),
+      num_islands(0),
       min_bounce_speed(0.15),
       max_penetration_recovery_speed(0.6),
       stepcount(0),
@@ -123,6 +128,9 @@ ChSystem::ChSystem(const ChSystem& other) {
     max_penetration_recovery_speed = other.max_penetration_recovery_speed;
     SetSolverType(other.GetSolverType());
     use_sleeping = other.use_sleeping;
+    use_parallel_update = other.use_parallel_update;
+    use_islands = other.use_islands;
+    num_islands = 0;
 
     ncontacts = other.ncontacts;
 
@@ -277,6 +285,9 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::APGD:
             solver = chrono_types::make_shared<ChSolverAPGD>();
             break;
+        case ChSolver::Type::PSOR_COLORED:
+            solver = chrono_types::make_shared<ChSolverPSORColored>();
+            break;
         case ChSolver::Type::GMRES:
             solver = chrono_types::make_shared<ChSolverGMRES>();
             break;
@@ -663,6 +674,7 @@ void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& mdescriptor) {
 
 void ChSystem::Setup() {
     CH_PROFILE("Setup");
+    CH_TRACE_ZONE("ChSystem::Setup");
 
     timer_setup.start();
 
@@ -750,6 +762,7 @@ void ChSystem::Update(double mytime, bool update_assets) {
 
 void ChSystem::Update(bool update_assets) {
     CH_PROFILE("Update");
+    CH_TRACE_ZONE("ChSystem::Update");
 
     if (!is_initialized)
         SetupInitial();
@@ -1067,6 +1080,7 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
                                     bool force_setup              // if true, call the solver's Setup() function
 ) {
     CH_PROFILE("StateSolveCorrection");
+    CH_TRACE_ZONE("ChSystem::StateSolveCorrection");
 
     if (force_state_scatter)
         StateScatter(x, v, T, full_update);
@@ -1127,7 +1141,12 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // Solve the problem
     // The solution is scattered in the provided system descriptor
     timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
+    descriptor->SetNumThreads(nthreads_chrono);
+    num_islands = 0;
+    if (use_islands && islands.Solve(*descriptor, *GetSolver(), nthreads_chrono))
+        num_islands = islands.GetNumIslands();
+    else
+        GetSolver()->Solve(*descriptor);
     timer_ls_solve.stop();
 
     // Dv and L vectors  <-- sparse solver structures
@@ -1264,6 +1283,7 @@ int ChSystem::GetNcontacts() {
 
 double ChSystem::ComputeCollisions() {
     CH_PROFILE("ComputeCollisions");
+    CH_TRACE_ZONE("ChSystem::ComputeCollisions");
 
     double mretC = 0.0;
 
@@ -1282,6 +1302,7 @@ double ChSystem::ComputeCollisions() {
     // for ChBody and ChParticles is used always.
     {
         CH_PROFILE("ReportContacts");
+        CH_TRACE_ZONE("ChSystem::ReportContacts");
 
         collision_system->ReportContacts(contact_container.get());
 
@@ -1410,6 +1431,8 @@ void ChSystem::DumpSystemMatrices(bool save_M, bool save_K, bool save_R, bool sa
 // -----------------------------------------------------------------------------
 
 int ChSystem::DoStepDynamics(double step_size) {
+    CH_TRACE_ZONE("ChSystem::DoStepDynamics");
+
     if (!is_initialized)
         SetupInitial();
 
@@ -1424,6 +1447,7 @@ int ChSystem::DoStepDynamics(double step_size) {
 
 bool ChSystem::Integrate_Y() {
     CH_PROFILE("Integrate_Y");
+    CH_TRACE_ZONE("ChSystem::Integrate_Y");
 
     ResetTimers();
 
@@ -1471,6 +1495,7 @@ bool ChSystem::Integrate_Y() {
     // PERFORM TIME STEP HERE!
     {
         CH_PROFILE("Advance");
+        CH_TRACE_ZONE("ChSystem::Advance");
         timer_advance.start();
         timestepper->Advance(step);
         timer_advance.stop();
@@ -32,6 +32,7 @@
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChDescriptorIslands.h"
 #include "chrono/solver/ChSolver.h"
 #include "chrono/timestepper/ChAssemblyAnalysis.h"
 #include "chrono/timestepper/ChIntegrable.h"
@@ -236,8 +237,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in SCM deformable terrain calculations, and in parallel solvers
+    ///                           (e.g. ChSolverPSORColored).
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -735,6 +737,31 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Enable/disable solving independent sub-problems (simulation islands) separately (default: false).
+    /// If enabled, at each solve the bodies are grouped in islands connected by joints and contacts (fixed and
+    /// sleeping bodies do not connect islands) and the islands are solved concurrently, using the number of threads
+    /// set with SetNumThreads and one clone of the system solver per thread. Islands whose bodies are all sleeping
+    /// (see SetUseSleeping) are skipped entirely. The result matches the solution of the whole problem within the solver
+    /// tolerance. This is only used with solvers that support cloning (iterative VI solvers, see ChSolver::Clone);
+    /// otherwise, or if there is a single island, the problem is solved as a whole.
+    void SetUseIslands(bool val) { use_islands = val; }
+
+    /// Tell if the system solves simulation islands separately.
+    bool GetUseIslands() const { return use_islands; }
+
+    /// Enable/disable processing bodies, shafts, and links in parallel in the per-item passes over the assembly
+    /// (Update, state gather and scatter, loading of the residual), using the number of threads set with SetNumThreads
+    /// (default: false). Only lists with more than a minimum number of items are processed in parallel.
+    /// Enable this only if the Update functions of all bodies, shafts, and links (including user-defined items, their
+    /// assets and functions, which may be shared between items) can safely run concurrently. See ChPhysicsItem::Update.
+    void SetUseParallelUpdate(bool val) { use_parallel_update = val; }
+
+    /// Tell if the per-item passes over the assembly are processed in parallel.
+    bool GetUseParallelUpdate() const { return use_parallel_update; }
+
+    /// Return the number of islands solved separately during the last solve (0 if the problem was solved as a whole).
+    int GetNumIslands() const { return num_islands; }
+
   private:
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
@@ -780,6 +807,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Reset to 0 the total number of time steps.
     void ResetStepcount() { stepcount = 0; }
 
+    /// Set the total number of time steps (e.g., when restarting from a checkpoint).
+    void SetStepcount(size_t count) { stepcount = count; }
+
     /// Return the number of calls to the solver's Solve() function.
     /// This counter is reset at each timestep.
     int GetSolverCallsCount() const { return solvecount; }
@@ -945,6 +975,12 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
 
+    bool use_parallel_update;  ///< if true, process bodies, shafts, and links in parallel in the assembly passes
+
+    bool use_islands;             ///< if true, solve independent sub-problems separately
+    int num_islands;              ///< number of islands solved separately in the last solve
+    ChDescriptorIslands islands;  ///< decomposition of the system descriptor in islands
+
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< system descriptor
     std::shared_ptr<ChSolver> solver;                ///< solver for DVI or DAE problem
 
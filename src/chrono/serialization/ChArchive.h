@@ -21,6 +21,7 @@
 #include <unordered_set>
 #include <memory>
 #include <algorithm>
+#include <type_traits>
 
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChStream.h"
@@ -747,6 +748,18 @@ private:
 };
 
 
+/// Trait for types that can be serialized as raw memory blocks when stored in contiguous arrays (std::vector, C++
+/// fixed-size arrays, Eigen matrices), by archives that support it (see ChArchiveOut::out_block).
+/// The raw bytes of such types must be identical to what their element-by-element serialization writes in a binary
+/// archive, so that the archive format does not depend on how arrays were written. This holds for arithmetic types
+/// other than bool. Types made only of arithmetic data (see ChVector, ChQuaternion) can specialize this trait, setting
+/// 'version_type' to the class whose version is written by their ArchiveOUT function.
+template <class T>
+struct ChArchiveBlock {
+    static const bool value = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value;
+    typedef void version_type;
+};
+
 ///
 /// This is a base class for archives with pointers to shared objects 
 ///
@@ -894,9 +907,32 @@ class  ChArchiveOut : public ChArchive {
       virtual void out_array_between (ChValue& bVal, size_t msize) = 0;
       virtual void out_array_end (ChValue& bVal, size_t msize) = 0;
 
+        // for arrays of plain data (optional, see ChArchiveBlock): return true if raw memory blocks can be stored
+        // with out_block, between out_array_pre and out_array_end
+      virtual bool out_block_enabled() { return false; }
+      virtual void out_block(const char* data, size_t nbytes) {}
+
 
       //---------------------------------------------------
 
+        /// Return true if arrays of T can be serialized with out_block_data.
+      template<class T>
+      bool out_block_possible() {
+          if (!ChArchiveBlock<T>::value || !this->out_block_enabled())
+              return false;
+          // versions written for each element cannot be packed in a block
+          return !use_versions || cluster_class_versions || std::is_void<typename ChArchiveBlock<T>::version_type>::value;
+      }
+
+        /// Serialize 'msize' elements at 'data' as a raw memory block (see out_block_possible).
+      template<class T>
+      void out_block_data(const T* data, size_t msize) {
+          if (msize == 0)
+              return;
+          this->VersionWriteBlock((typename ChArchiveBlock<T>::version_type*)nullptr);
+          this->out_block((const char*)data, msize * sizeof(T));
+      }
+
            // trick to wrap enum mappers:
       template<class T>
       void out     (ChNameValue< ChEnumMapper<T> > bVal) {
@@ -910,6 +946,11 @@ class  ChArchiveOut : public ChArchive {
           size_t arraysize = sizeof(bVal.value())/sizeof(T);
           ChValueSpecific<T[N]> specVal(bVal.value(), bVal.name(), bVal.flags());
           this->out_array_pre( specVal, arraysize);
+          if (this->out_block_possible<T>()) {
+              this->out_block_data(bVal.value(), arraysize);
+              this->out_array_end(specVal, arraysize);
+              return;
+          }
           for (size_t i = 0; i<arraysize; ++i)
           {
               char buffer[20];
@@ -926,6 +967,11 @@ class  ChArchiveOut : public ChArchive {
       void out     (ChNameValue< std::vector<T> > bVal) {
           ChValueSpecific< std::vector<T> > specVal(bVal.value(), bVal.name(), bVal.flags());
           this->out_array_pre( specVal, bVal.value().size());
+          if (this->out_block_possible<T>()) {
+              this->out_block_data(bVal.value().data(), bVal.value().size());
+              this->out_array_end(specVal, bVal.value().size());
+              return;
+          }
           for (size_t i = 0; i<bVal.value().size(); ++i)
           {
               char buffer[20];
@@ -1087,6 +1133,10 @@ class  ChArchiveOut : public ChArchive {
       
   protected:
 
+      template<class T>
+      void VersionWriteBlock(T*) { this->VersionWrite<T>(); }
+      void VersionWriteBlock(void*) {}
+
       virtual void out_version(int mver, const std::type_info& mtype) {
           if (use_versions) {
               const char* class_name = "";
@@ -1205,8 +1255,31 @@ class  ChArchiveIn : public ChArchive {
       virtual void in_array_between (const char* name) = 0;
       virtual void in_array_end (const char* name) = 0;
 
+        // for arrays of plain data (optional, see ChArchiveBlock): return true if raw memory blocks can be loaded
+        // with in_block, between in_array_pre and in_array_end
+      virtual bool in_block_enabled() { return false; }
+      virtual void in_block(char* data, size_t nbytes) {}
+
       //---------------------------------------------------
 
+        /// Return true if arrays of T can be deserialized with in_block_data.
+      template<class T>
+      bool in_block_possible() {
+          if (!ChArchiveBlock<T>::value || !this->in_block_enabled())
+              return false;
+          // versions written for each element cannot be packed in a block
+          return !use_versions || cluster_class_versions || std::is_void<typename ChArchiveBlock<T>::version_type>::value;
+      }
+
+        /// Deserialize 'msize' elements to 'data' from a raw memory block (see in_block_possible).
+      template<class T>
+      void in_block_data(T* data, size_t msize) {
+          if (msize == 0)
+              return;
+          this->VersionReadBlock((typename ChArchiveBlock<T>::version_type*)nullptr);
+          this->in_block((char*)data, msize * sizeof(T));
+      }
+
            // trick to wrap enum mappers:
       template<class T>
       void in     (ChNameValue< ChEnumMapper<T> > bVal) {
@@ -1220,6 +1293,11 @@ class  ChArchiveIn : public ChArchive {
           size_t arraysize;
           this->in_array_pre(bVal.name(), arraysize);
           if (arraysize != sizeof(bVal.value())/sizeof(T) ) {throw (ChExceptionArchive( "Size of [] saved array does not match size of receiver array " + std::string(bVal.name()) + "."));}
+          if (this->in_block_possible<T>()) {
+              this->in_block_data(bVal.value(), arraysize);
+              this->in_array_end(bVal.name());
+              return;
+          }
           for (size_t i = 0; i<arraysize; ++i)
           {
               char idname[20];
@@ -1240,6 +1318,11 @@ class  ChArchiveIn : public ChArchive {
           size_t arraysize;
           this->in_array_pre(bVal.name(), arraysize);
           bVal.value().resize(arraysize);
+          if (this->in_block_possible<T>()) {
+              this->in_block_data(bVal.value().data(), arraysize);
+              this->in_array_end(bVal.name());
+              return;
+          }
           for (size_t i = 0; i<arraysize; ++i)
           {
               char idname[20];
@@ -1376,6 +1459,10 @@ class  ChArchiveIn : public ChArchive {
       }
 
   protected:
+      template<class T>
+      void VersionReadBlock(T*) { this->VersionRead<T>(); }
+      void VersionReadBlock(void*) {}
+
       virtual int in_version(const std::type_info& mtype) {
             int mver;
             const char* class_name = "";
@@ -19,7 +19,10 @@
 namespace chrono {
 
 ///
-/// This is a class for serializing to binary archives
+/// This is a class for serializing to binary archives.
+/// Arrays of plain data (see ChArchiveBlock), such as std::vector<double>, std::vector<ChVector<>> or Eigen matrices,
+/// are written as single memory blocks. The resulting archive is identical to the one obtained by writing their
+/// elements one by one.
 ///
 
 class  ChArchiveOutBinary : public ChArchiveOut {
@@ -27,10 +30,15 @@ class  ChArchiveOutBinary : public ChArchiveOut {
 
       ChArchiveOutBinary( ChStreamOutBinary& mostream) {
           ostream = &mostream;
+          // blocks are written in the byte order of the machine, while binary streams are little endian
+          use_blocks = !mostream.IsBigEndianMachine();
       };
 
       virtual ~ChArchiveOutBinary() {};
 
+      /// Enable or disable writing arrays of plain data as memory blocks (enabled by default).
+      void SetUseBlocks(bool val) { use_blocks = val && !ostream->IsBigEndianMachine(); }
+
       virtual void out     (ChNameValue<bool> bVal) {
             (*ostream) << bVal.value();
       }
@@ -71,6 +79,11 @@ class  ChArchiveOutBinary : public ChArchiveOut {
       virtual void out_array_between (ChValue& bVal, size_t msize) {}
       virtual void out_array_end (ChValue& bVal, size_t msize) {}
 
+      virtual bool out_block_enabled() { return use_blocks; }
+      virtual void out_block(const char* data, size_t nbytes) {
+            ostream->RawOutput(data, nbytes);
+      }
+
 
         // for custom c++ objects:
       virtual void out     (ChValue& bVal, bool tracked, size_t obj_ID) {
@@ -105,6 +118,7 @@ class  ChArchiveOutBinary : public ChArchiveOut {
 
   protected:
       ChStreamOutBinary* ostream;
+      bool use_blocks;
 };
 
 
@@ -112,7 +126,9 @@ class  ChArchiveOutBinary : public ChArchiveOut {
 
 
 ///
-/// This is a class for serializing from binary archives
+/// This is a class for serializing from binary archives.
+/// Arrays of plain data (see ChArchiveBlock) are read as single memory blocks. For large archives, use a
+/// ChStreamInBinaryMappedFile as input stream, so that these blocks are copied directly from the file mapping.
 ///
 
 class  ChArchiveInBinary : public ChArchiveIn {
@@ -120,10 +136,15 @@ class  ChArchiveInBinary : public ChArchiveIn {
 
       ChArchiveInBinary( ChStreamInBinary& mistream) {
           istream = &mistream;
+          // blocks are read in the byte order of the machine, while binary streams are little endian
+          use_blocks = !mistream.IsBigEndianMachine();
       };
 
       virtual ~ChArchiveInBinary() {};
 
+      /// Enable or disable reading arrays of plain data as memory blocks (enabled by default).
+      void SetUseBlocks(bool val) { use_blocks = val && !istream->IsBigEndianMachine(); }
+
       virtual void in     (ChNameValue<bool> bVal) {
             (*istream) >> bVal.value();
       }
@@ -163,6 +184,11 @@ class  ChArchiveInBinary : public ChArchiveIn {
       virtual void in_array_between (const char* name) {}
       virtual void in_array_end (const char* name) {}
 
+      virtual bool in_block_enabled() { return use_blocks; }
+      virtual void in_block(char* data, size_t nbytes) {
+            istream->RawInput(data, nbytes);
+      }
+
         //  for custom c++ objects:
       virtual void in     (ChNameValue<ChFunctorArchiveIn> bVal) {
           if (bVal.flags() & NVP_TRACK_OBJECT){
@@ -220,6 +246,7 @@ class  ChArchiveInBinary : public ChArchiveIn {
 
   protected:
       ChStreamInBinary* istream;
+      bool use_blocks;
 };
 
 }  // end namespace chrono
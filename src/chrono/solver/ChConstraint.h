@@ -15,12 +15,17 @@
 #ifndef CHCONSTRAINT_H
 #define CHCONSTRAINT_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
 
+class ChPackedConstraints;
+class ChVariables;
+
 /// Modes for constraint
 enum eChConstraintMode {
     CONSTRAINT_FREE = 0,        ///< the constraint does not enforce anything
@@ -280,6 +285,16 @@ class ChApi ChConstraint {
     /// Same as Build_Cq, but puts the _transposed_ jacobian row as a column.
     virtual void Build_CqT(ChSparseMatrix& storage, int inscol) = 0;
 
+    /// Append the jacobian portions [Cq_i] and the auxiliary [Eq_i]=[invM]*[Cq_i]' portions of this constraint, one
+    /// block per active ChVariable, to the flat storage used by solvers that iterate on packed constraints.
+    /// Return false if this constraint cannot be packed (default), in which case solvers use the non-packed path.
+    virtual bool PackJacobian(ChPackedConstraints& storage) { return false; }
+
+    /// Append to the given list the ChVariables objects referenced by this constraint.
+    /// Return false if this constraint does not provide this information (default). This is used to partition a
+    /// ChSystemDescriptor in independent sub-problems (see ChDescriptorIslands).
+    virtual bool AppendVariables(std::vector<ChVariables*>& vars) const { return false; }
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(int moff) { offset = moff; }
 
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChConstraintNgeneric.h"
+#include "chrono/solver/ChPackedConstraints.h"
 
 namespace chrono {
 
@@ -134,6 +135,14 @@ void ChConstraintNgeneric::Build_CqT(ChSparseMatrix& storage, int inscol) {
     }
 }
 
+bool ChConstraintNgeneric::PackJacobian(ChPackedConstraints& storage) {
+    for (size_t i = 0; i < variables.size(); ++i) {
+        if (variables[i]->IsActive())
+            storage.AddBlock(variables[i]->GetOffset(), variables[i]->Get_ndof(), Cq[i].data(), Eq[i].data());
+    }
+    return true;
+}
+
 void ChConstraintNgeneric::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChConstraintNgeneric>();
@@ -102,6 +102,15 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     virtual void Build_Cq(ChSparseMatrix& storage, int insrow) override;
     virtual void Build_CqT(ChSparseMatrix& storage, int inscol) override;
 
+    /// Append the jacobian portions of this constraint to the flat storage used by packed solvers.
+    virtual bool PackJacobian(ChPackedConstraints& storage) override;
+
+    /// Append the constrained variable objects to the given list.
+    virtual bool AppendVariables(std::vector<ChVariables*>& vars) const override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+        return true;
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChConstraintThree.h"
+#include "chrono/solver/ChPackedConstraints.h"
 
 namespace chrono {
 
@@ -39,6 +40,22 @@ ChConstraintThree& ChConstraintThree::operator=(const ChConstraintThree& other)
     return *this;
 }
 
+bool ChConstraintThree::PackJacobian(ChPackedConstraints& storage) {
+    if (variables_a->IsActive()) {
+        storage.AddBlock(variables_a->GetOffset(), variables_a->Get_ndof(), Get_Cq_a().data(), Get_Eq_a().data());
+    }
+
+    if (variables_b->IsActive()) {
+        storage.AddBlock(variables_b->GetOffset(), variables_b->Get_ndof(), Get_Cq_b().data(), Get_Eq_b().data());
+    }
+
+    if (variables_c->IsActive()) {
+        storage.AddBlock(variables_c->GetOffset(), variables_c->Get_ndof(), Get_Cq_c().data(), Get_Eq_c().data());
+    }
+
+    return true;
+}
+
 void ChConstraintThree::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChConstraintThree>();
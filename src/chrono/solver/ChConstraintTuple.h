@@ -16,6 +16,7 @@
 #define CHCONSTRAINTTUPLE_H
 
 #include "chrono/solver/ChConstraint.h"
+#include "chrono/solver/ChPackedConstraints.h"
 #include "chrono/solver/ChVariables.h"
 
 namespace chrono {
@@ -122,6 +123,15 @@ class ChConstraintTuple_1vars {
         if (variables->IsActive())
             PasteMatrix(storage, Cq.transpose(), variables->GetOffset(), inscol);
     }
+
+    void PackJacobian(ChPackedConstraints& storage) {
+        if (variables->IsActive())
+            storage.AddBlock(variables->GetOffset(), T::nvars1, Cq.data(), Eq.data());
+    }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables);
+    }
 };
 
 /// Case of tuple with reference to 2 ChVariable objects:
@@ -263,6 +273,18 @@ class ChConstraintTuple_2vars {
         if (variables_2->IsActive())
             PasteMatrix(storage, Cq_2.transpose(), variables_2->GetOffset(), inscol);
     }
+
+    void PackJacobian(ChPackedConstraints& storage) {
+        if (variables_1->IsActive())
+            storage.AddBlock(variables_1->GetOffset(), T::nvars1, Cq_1.data(), Eq_1.data());
+        if (variables_2->IsActive())
+            storage.AddBlock(variables_2->GetOffset(), T::nvars2, Cq_2.data(), Eq_2.data());
+    }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+    }
 };
 
 /// Case of tuple with reference to 3 ChVariable objects:
@@ -444,6 +466,21 @@ class ChConstraintTuple_3vars {
         if (variables_3->IsActive())
             PasteMatrix(storage, Cq_3.transpose(), variables_3->GetOffset(), inscol);
     }
+
+    void PackJacobian(ChPackedConstraints& storage) {
+        if (variables_1->IsActive())
+            storage.AddBlock(variables_1->GetOffset(), T::nvars1, Cq_1.data(), Eq_1.data());
+        if (variables_2->IsActive())
+            storage.AddBlock(variables_2->GetOffset(), T::nvars2, Cq_2.data(), Eq_2.data());
+        if (variables_3->IsActive())
+            storage.AddBlock(variables_3->GetOffset(), T::nvars3, Cq_3.data(), Eq_3.data());
+    }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+    }
 };
 
 
@@ -666,6 +703,24 @@ class ChConstraintTuple_4vars {
         if (variables_4->IsActive())
             PasteMatrix(storage, Cq_4.transpose(), variables_4->GetOffset(), inscol);
     }
+
+    void PackJacobian(ChPackedConstraints& storage) {
+        if (variables_1->IsActive())
+            storage.AddBlock(variables_1->GetOffset(), T::nvars1, Cq_1.data(), Eq_1.data());
+        if (variables_2->IsActive())
+            storage.AddBlock(variables_2->GetOffset(), T::nvars2, Cq_2.data(), Eq_2.data());
+        if (variables_3->IsActive())
+            storage.AddBlock(variables_3->GetOffset(), T::nvars3, Cq_3.data(), Eq_3.data());
+        if (variables_4->IsActive())
+            storage.AddBlock(variables_4->GetOffset(), T::nvars4, Cq_4.data(), Eq_4.data());
+    }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+        vars.push_back(variables_4);
+    }
 };
 
 /// This is a set of 'helper' classes that make easier to manage the templated
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChConstraintTwo.h"
+#include "chrono/solver/ChPackedConstraints.h"
 
 namespace chrono {
 
@@ -37,6 +38,18 @@ ChConstraintTwo& ChConstraintTwo::operator=(const ChConstraintTwo& other) {
     return *this;
 }
 
+bool ChConstraintTwo::PackJacobian(ChPackedConstraints& storage) {
+    if (variables_a->IsActive()) {
+        storage.AddBlock(variables_a->GetOffset(), variables_a->Get_ndof(), Get_Cq_a().data(), Get_Eq_a().data());
+    }
+
+    if (variables_b->IsActive()) {
+        storage.AddBlock(variables_b->GetOffset(), variables_b->Get_ndof(), Get_Cq_b().data(), Get_Eq_b().data());
+    }
+
+    return true;
+}
+
 void ChConstraintTwo::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChConstraintTwo>();
@@ -72,6 +72,9 @@ class ChApi ChConstraintTwoGenericBoxed : public ChConstraintTwoGeneric {
     /// violation of the constraint, considering inequalities, etc.
     virtual double Violation(double mc_i) override;
 
+    /// Boxed constraints are not supported by packed solvers (custom projection).
+    virtual bool PackJacobian(ChPackedConstraints& storage) override { return false; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -123,6 +123,20 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_a.Build_CqT(storage, inscol);
         tuple_b.Build_CqT(storage, inscol);
     }
+
+    /// Append the jacobian portions of this constraint to the flat storage used by packed solvers.
+    virtual bool PackJacobian(ChPackedConstraints& storage) override {
+        tuple_a.PackJacobian(storage);
+        tuple_b.PackJacobian(storage);
+        return true;
+    }
+
+    /// Append the variable objects of both tuples to the given list.
+    virtual bool AppendVariables(std::vector<ChVariables*>& vars) const override {
+        tuple_a.AppendVariables(vars);
+        tuple_b.AppendVariables(vars);
+        return true;
+    }
 };
 
 }  // end namespace chrono
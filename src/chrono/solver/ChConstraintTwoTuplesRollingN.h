@@ -108,6 +108,10 @@ class ChApi ChConstraintTwoTuplesRollingN : public ChConstraintTwoTuples<Ta, Tb>
     /// Set pointer to normal contact component
     void SetNormalConstraint(ChConstraintTwoTuplesContactN<Ta, Tb>* mconstr) { constraint_N = mconstr; }
 
+    /// Rolling friction constraints are not supported by packed solvers (the projection also modifies the
+    /// multiplier of the normal contact component).
+    virtual bool PackJacobian(ChPackedConstraints& storage) override { return false; }
+
     /// For iterative solvers: project the value of a possible
     /// 'l_i' value of constraint reaction onto admissible set.
     /// This projection will also modify the l_i values of the two
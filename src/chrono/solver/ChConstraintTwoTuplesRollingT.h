@@ -59,6 +59,9 @@ class ChApi ChConstraintTwoTuplesRollingT : public ChConstraintTwoTuples<Ta, Tb>
 
     /// The constraint is satisfied?
     virtual double Violation(double mc_i) override { return 0.0; }
+
+    /// Rolling friction constraints are not supported by packed solvers.
+    virtual bool PackJacobian(ChPackedConstraints& storage) override { return false; }
 };
 
 }  // end namespace chrono
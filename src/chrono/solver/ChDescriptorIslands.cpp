@@ -0,0 +1,194 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <numeric>
+
+#include "chrono/solver/ChDescriptorIslands.h"
+#include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+
+ChDescriptorIslands::ChDescriptorIslands() : m_num_islands(0), m_max_violation(0), m_max_iterations(0) {}
+
+int ChDescriptorIslands::FindRoot(int i) {
+    // Path halving
+    while (m_parent[i] != i) {
+        m_parent[i] = m_parent[m_parent[i]];
+        i = m_parent[i];
+    }
+    return i;
+}
+
+void ChDescriptorIslands::Join(int i, int j) {
+    int ri = FindRoot(i);
+    int rj = FindRoot(j);
+    // Always keep the lowest index as root, so that the partition does not depend on the joining order
+    if (ri < rj)
+        m_parent[rj] = ri;
+    else if (rj < ri)
+        m_parent[ri] = rj;
+}
+
+bool ChDescriptorIslands::Build(ChSystemDescriptor& sysd) {
+    m_num_islands = 0;
+
+    std::vector<ChVariables*>& vvariables = sysd.GetVariablesList();
+    std::vector<ChConstraint*>& vconstraints = sysd.GetConstraintsList();
+    std::vector<ChKblock*>& vstiffness = sysd.GetKblocksList();
+
+    // Index the active variables by their offset in the global 'q' vector
+    int n_q = 0;
+    for (auto var : vvariables) {
+        if (var->IsActive())
+            n_q = std::max(n_q, var->GetOffset() + var->Get_ndof());
+    }
+    m_var_at.assign(n_q, -1);
+    int n_v = 0;
+    for (auto var : vvariables) {
+        if (var->IsActive())
+            m_var_at[var->GetOffset()] = n_v++;
+    }
+    m_parent.resize(n_v);
+    std::iota(m_parent.begin(), m_parent.end(), 0);
+
+    // Join the active variables of each active constraint.
+    // Record, for each constraint, the first active variable it acts on (-1 if none).
+    std::vector<int> con_var(vconstraints.size(), -1);
+    for (size_t ic = 0; ic < vconstraints.size(); ic++) {
+        if (!vconstraints[ic]->IsActive())
+            continue;
+        m_vars.clear();
+        if (!vconstraints[ic]->AppendVariables(m_vars))
+            return false;
+        for (auto var : m_vars) {
+            if (!var || !var->IsActive())
+                continue;
+            int iv = m_var_at[var->GetOffset()];
+            if (con_var[ic] < 0)
+                con_var[ic] = iv;
+            else
+                Join(con_var[ic], iv);
+        }
+    }
+
+    // Join the active variables of each stiffness block
+    std::vector<int> kbl_var(vstiffness.size(), -1);
+    for (size_t ik = 0; ik < vstiffness.size(); ik++) {
+        auto kblock = dynamic_cast<ChKblockGeneric*>(vstiffness[ik]);
+        if (!kblock)
+            return false;
+        for (unsigned int k = 0; k < kblock->GetNvars(); k++) {
+            auto var = kblock->GetVariableN(k);
+            if (!var->IsActive())
+                continue;
+            int iv = m_var_at[var->GetOffset()];
+            if (kbl_var[ik] < 0)
+                kbl_var[ik] = iv;
+            else
+                Join(kbl_var[ik], iv);
+        }
+    }
+
+    // Number the islands in the order of their first variable
+    m_island_of.assign(n_v, -1);
+    for (int iv = 0; iv < n_v; iv++) {
+        int root = FindRoot(iv);
+        if (m_island_of[root] < 0)
+            m_island_of[root] = m_num_islands++;
+    }
+
+    // Fill the island descriptors, preserving the relative order of items in the original descriptor
+    while ((int)m_islands.size() < m_num_islands)
+        m_islands.push_back(std::unique_ptr<ChSystemDescriptor>(new ChSystemDescriptor));
+    for (int i = 0; i < m_num_islands; i++)
+        m_islands[i]->BeginInsertion();
+    m_island_nq.assign(m_num_islands, 0);
+
+    for (auto var : vvariables) {
+        if (!var->IsActive())
+            continue;
+        int island = m_island_of[FindRoot(m_var_at[var->GetOffset()])];
+        m_islands[island]->InsertVariables(var);
+        m_island_nq[island] += var->Get_ndof();
+    }
+    m_unassigned.clear();
+    for (size_t ic = 0; ic < vconstraints.size(); ic++) {
+        if (con_var[ic] >= 0)
+            m_islands[m_island_of[FindRoot(con_var[ic])]]->InsertConstraint(vconstraints[ic]);
+        else if (vconstraints[ic]->IsActive())
+            m_unassigned.push_back(vconstraints[ic]);
+    }
+    for (size_t ik = 0; ik < vstiffness.size(); ik++) {
+        if (kbl_var[ik] >= 0)
+            m_islands[m_island_of[FindRoot(kbl_var[ik])]]->InsertKblock(vstiffness[ik]);
+    }
+
+    return true;
+}
+
+bool ChDescriptorIslands::Solve(ChSystemDescriptor& sysd, const ChSolver& solver, int nthreads) {
+    std::unique_ptr<ChSolver> master(solver.Clone());
+    if (!master)
+        return false;
+
+    if (!Build(sysd) || m_num_islands < 2)
+        return false;
+
+    // One solver per thread; each thread solves its islands sequentially
+    nthreads = std::max(1, std::min(nthreads, m_num_islands));
+    std::vector<std::unique_ptr<ChSolver>> solvers(nthreads);
+    solvers[0] = std::move(master);
+    for (int it = 1; it < nthreads; it++)
+        solvers[it].reset(solver.Clone());
+
+    double c_a = sysd.GetMassFactor();
+    bool use_packed = sysd.UsePackedConstraints();
+
+    std::vector<double> violation(m_num_islands, 0.0);
+    std::vector<int> iterations(m_num_islands, 0);
+
+    // Islands do not share any variable or constraint, so they can be processed concurrently.
+    // Setting up an island descriptor overwrites the offsets of its variables and constraints with island-local ones.
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (int i = 0; i < m_num_islands; i++) {
+        ChSystemDescriptor& island = *m_islands[i];
+        ChSolver& island_solver = *solvers[ChOMP::GetThreadNum()];
+        island.SetMassFactor(c_a);
+        island.SetUsePackedConstraints(use_packed);
+        island.SetNumThreads(1);
+        island.EndInsertion();
+        violation[i] = island_solver.Solve(island);
+        if (auto iterative = dynamic_cast<ChIterativeSolver*>(&island_solver))
+            iterations[i] = iterative->GetIterations();
+    }
+
+    // Restore the offsets in the global vectors
+    sysd.UpdateCountsAndOffsets();
+
+    // Constraints not assigned to any island act on inactive variables only and cannot transmit any force
+    for (auto con : m_unassigned) {
+        con->Set_l_i(0);
+        con->Project();
+    }
+
+    m_max_violation = *std::max_element(violation.begin(), violation.end());
+    m_max_iterations = *std::max_element(iterations.begin(), iterations.end());
+
+    return true;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CH_DESCRIPTOR_ISLANDS_H
+#define CH_DESCRIPTOR_ISLANDS_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/solver/ChSolver.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Decomposition of a ChSystemDescriptor in independent sub-problems (simulation islands).\n
+/// Two active ChVariables objects belong to the same island if they are coupled, directly or through other variables,
+/// by an active constraint (joints, contacts) or by a stiffness block. Inactive variables (e.g. those of fixed or
+/// sleeping bodies) do not couple anything, so that separate piles of objects resting on the same fixed ground end up
+/// in different islands. Constraints acting only on inactive variables (e.g. between sleeping bodies at rest) are not
+/// assigned to any island; since they cannot transmit any force, their multipliers are set to zero by the solve.\n
+/// Each island is stored in its own ChSystemDescriptor, referencing the same variable and constraint objects as the
+/// original descriptor (in the same relative order), and the islands are solved concurrently with clones of the
+/// system solver (see ChSolver::Clone).
+class ChApi ChDescriptorIslands {
+  public:
+    ChDescriptorIslands();
+
+    ~ChDescriptorIslands() {}
+
+    /// Partition the given descriptor in islands.
+    /// The variable offsets in the descriptor must be up to date (see ChSystemDescriptor::UpdateCountsAndOffsets).
+    /// Return false if some active constraint or stiffness block does not report the variables it acts on (see
+    /// ChConstraint::AppendVariables), in which case no islands are built.
+    bool Build(ChSystemDescriptor& sysd);
+
+    /// Build the islands of the given descriptor and solve them concurrently, using clones of the given solver and the
+    /// specified number of threads. Islands are solved in parallel with one thread each; the descriptor settings
+    /// (mass factor, use of packed constraints) are propagated to all islands.
+    /// On return, the variable and constraint offsets of the original descriptor are restored.
+    /// Return false (and do nothing) if the problem cannot be decomposed, if it has fewer than two islands, or if the
+    /// solver cannot be cloned; in this case, the caller should solve the original descriptor.
+    bool Solve(ChSystemDescriptor& sysd, const ChSolver& solver, int nthreads);
+
+    /// Return the number of islands found during the last call to Build().
+    int GetNumIslands() const { return m_num_islands; }
+
+    /// Access the descriptor of the i-th island.
+    ChSystemDescriptor& GetIsland(int i) { return *m_islands[i]; }
+
+    /// Return the number of active variables of the i-th island.
+    int GetIslandNumVariables(int i) const { return m_island_nq[i]; }
+
+    /// Return the maximum constraint violation over all islands, as reported by the solvers during the last Solve().
+    double GetMaxViolation() const { return m_max_violation; }
+
+    /// Return the maximum number of iterations performed on an island during the last Solve().
+    /// This is only available for iterative solvers (0 otherwise).
+    int GetMaxIterations() const { return m_max_iterations; }
+
+  private:
+    int FindRoot(int i);
+    void Join(int i, int j);
+
+    int m_num_islands;                                           ///< number of islands found by the last Build()
+    std::vector<std::unique_ptr<ChSystemDescriptor>> m_islands;  ///< island descriptors (reused across calls)
+    std::vector<int> m_island_nq;                                ///< number of active variables, per island
+
+    std::vector<int> m_parent;                ///< union-find forest, over the active variables
+    std::vector<int> m_var_at;                ///< index of active variable, per offset in the global 'q' vector
+    std::vector<int> m_island_of;             ///< island index, per root of the union-find forest
+    std::vector<ChVariables*> m_vars;         ///< scratch list of constraint variables
+    std::vector<ChConstraint*> m_unassigned;  ///< active constraints without active variables
+
+    double m_max_violation;
+    int m_max_iterations;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -12,13 +12,97 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/utils/ChTracer.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
 
 namespace chrono {
 
+// -----------------------------------------------------------------------------
+
+// Utility class for recording and replaying the matrix entries written by variables, stiffness blocks, and
+// constraints. Derived from ChSparseMatrix so that it can be passed to the Build_M, Build_K, Build_Cq, and Build_CqT
+// functions, it does not store any values itself but redirects all writes to a given compressed (CSR) matrix.
+// - In record mode, the CSR value slot of each entry is located (by binary search in the corresponding row) and
+//   appended to a list of slots.
+// - In replay mode, the entries written by one object are checked against the recorded slots and their values are
+//   stored in a buffer, at the position of the corresponding entry.
+class ChSparseSlotWriter : public ChSparseMatrix {
+  public:
+    ChSparseSlotWriter(const ChSparseMatrix& target)
+        : m_outer(target.outerIndexPtr()), m_inner(target.innerIndexPtr()), m_failed(false) {}
+
+    // Set record mode, appending the slots and overwrite flags to the given vectors.
+    void Record(std::vector<int>* slots, std::vector<char>* overwrite) {
+        m_rec_slots = slots;
+        m_rec_overwrite = overwrite;
+        m_replay = false;
+    }
+
+    // Set replay mode for an object with recorded entries [start, end).
+    void Replay(const int* slots, const char* overwrite, double* values, int start, int end) {
+        m_slots = slots;
+        m_overwrite = overwrite;
+        m_values = values;
+        m_current = start;
+        m_end = end;
+        m_replay = true;
+    }
+
+    // Return true if the current object wrote exactly its recorded entries.
+    bool ReplayComplete() const { return m_current == m_end; }
+
+    // Return true if some entry did not match the recorded structure.
+    bool Failed() const { return m_failed; }
+
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        if (m_replay) {
+            if (m_current >= m_end) {
+                m_failed = true;
+                return;
+            }
+            int slot = m_slots[m_current];
+            if (slot < m_outer[row] || slot >= m_outer[row + 1] || m_inner[slot] != col ||
+                m_overwrite[m_current] != (char)overwrite) {
+                m_failed = true;
+                return;
+            }
+            m_values[m_current++] = val;
+        } else {
+            const int* first = m_inner + m_outer[row];
+            const int* last = m_inner + m_outer[row + 1];
+            const int* it = std::lower_bound(first, last, col);
+            if (it == last || *it != col) {
+                m_failed = true;
+                return;
+            }
+            m_rec_slots->push_back((int)(it - m_inner));
+            m_rec_overwrite->push_back((char)overwrite);
+        }
+    }
+
+  private:
+    const int* m_outer;
+    const int* m_inner;
+    bool m_replay;
+    bool m_failed;
+
+    std::vector<int>* m_rec_slots;
+    std::vector<char>* m_rec_overwrite;
+
+    const int* m_slots;
+    const char* m_overwrite;
+    double* m_values;
+    int m_current;
+    int m_end;
+};
+
+// -----------------------------------------------------------------------------
+
 ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
@@ -30,7 +114,15 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_cached_assembly_call(0),
+      m_use_cache(false),
+      m_cache_valid(false) {}
+
+void ChDirectSolverLS::UseCachedAssembly(bool val) {
+    m_use_cache = val;
+    m_cache_valid = false;
+}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
@@ -40,12 +132,27 @@ void ChDirectSolverLS::ResetTimers() {
 }
 
 bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChDirectSolverLS::Setup");
+
     m_timer_setup_assembly.start();
 
     // Calculate problem size.
     // Note that ChSystemDescriptor::UpdateCountsAndOffsets was already called at the beginning of the step.
     m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
 
+    // If enabled and up to date, use the assembly cache. If the problem structure changed, invalidate the cache and
+    // fall back to the default assembly (forcing an update of the sparsity pattern).
+    bool cached = false;
+    if (m_use_cache && m_cache_valid && !m_force_update && m_mat.rows() == m_dim) {
+        cached = AssembleFromCache(sysd);
+        if (cached) {
+            m_cached_assembly_call++;
+        } else {
+            m_cache_valid = false;
+            m_force_update = true;
+        }
+    }
+
     // If use of the sparsity pattern learner is enabled, call it if:
     // (a) an explicit update was requested (by default this is true at the first call), or
     // (b) the sparsity pattern is not locked and so has to be re-evaluated at each call
@@ -64,25 +171,32 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         GetLog() << "  pattern locked? " << m_lock << "\n";
         GetLog() << "  CALL learner:   " << call_learner << "\n";
         GetLog() << "  CALL reserve:   " << call_reserve << "\n";
+        GetLog() << "  cached assembly: " << cached << "\n";
     }
 
-    if (call_learner) {
-        ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
-        sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
-        sparsity_pattern.Apply(m_mat);
-        m_force_update = false;
-    } else if (call_reserve) {
-        double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
-        m_mat.resize(m_dim, m_dim);
-        m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+    if (!cached) {
+        if (call_learner) {
+            ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
+            sysd.ConvertToMatrixForm(&sparsity_pattern, nullptr);
+            sparsity_pattern.Apply(m_mat);
+            m_force_update = false;
+        } else if (call_reserve) {
+            double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
+            m_mat.resize(m_dim, m_dim);
+            m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
+        }
+
+        // Let the system descriptor load the current matrix
+        sysd.ConvertToMatrixForm(&m_mat, nullptr);
+
+        // Allow the matrix to be compressed
+        m_mat.makeCompressed();
+
+        // Record the value slots for use in subsequent calls
+        if (m_use_cache)
+            RecordAssemblyCache(sysd);
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.ConvertToMatrixForm(&m_mat, nullptr);
-
-    // Allow the matrix to be compressed
-    m_mat.makeCompressed();
-
     m_timer_setup_assembly.stop();
 
     // Let the concrete solver perform the facorization
@@ -109,6 +223,8 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChDirectSolverLS::Solve");
+
     // Assemble the problem right-hand side vector
     m_timer_solve_assembly.start();
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
@@ -142,6 +258,148 @@ double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
 }
 
 
+// Collect the active variables and constraints, in the order used by ChSystemDescriptor::ConvertToMatrixForm.
+static void CollectActiveItems(ChSystemDescriptor& sysd,
+                               std::vector<ChVariables*>& variables,
+                               std::vector<ChConstraint*>& constraints) {
+    variables.clear();
+    for (auto var : sysd.GetVariablesList()) {
+        if (var->IsActive())
+            variables.push_back(var);
+    }
+    constraints.clear();
+    for (auto con : sysd.GetConstraintsList()) {
+        if (con->IsActive())
+            constraints.push_back(con);
+    }
+}
+
+void ChDirectSolverLS::RecordAssemblyCache(ChSystemDescriptor& sysd) {
+    std::vector<ChVariables*> variables;
+    std::vector<ChConstraint*> constraints;
+    CollectActiveItems(sysd, variables, constraints);
+    auto& kblocks = sysd.GetKblocksList();
+
+    int n_v = (int)variables.size();
+    int n_k = (int)kblocks.size();
+    int n_c = (int)constraints.size();
+    int n_q = m_dim - n_c;
+    double c_a = sysd.GetMassFactor();
+
+    m_cache_items = {n_v, n_k, n_c};
+    m_item_start.clear();
+    m_item_start.reserve(n_v + n_k + n_c + 1);
+    m_entry_slot.clear();
+    m_entry_overwrite.clear();
+
+    // Replay, serially, all matrix writes (same order as in ChSystemDescriptor::ConvertToMatrixForm)
+    ChSparseSlotWriter writer(m_mat);
+    writer.Record(&m_entry_slot, &m_entry_overwrite);
+
+    for (int i = 0; i < n_v; i++) {
+        m_item_start.push_back((int)m_entry_slot.size());
+        variables[i]->Build_M(writer, variables[i]->GetOffset(), variables[i]->GetOffset(), c_a);
+    }
+    for (int i = 0; i < n_k; i++) {
+        m_item_start.push_back((int)m_entry_slot.size());
+        kblocks[i]->Build_K(writer, true);
+    }
+    for (int i = 0; i < n_c; i++) {
+        m_item_start.push_back((int)m_entry_slot.size());
+        constraints[i]->Build_Cq(writer, n_q + i);
+        constraints[i]->Build_CqT(writer, n_q + i);
+        writer.SetElement(n_q + i, n_q + i, constraints[i]->Get_cfm_i());
+    }
+    m_item_start.push_back((int)m_entry_slot.size());
+
+    if (writer.Failed()) {
+        m_cache_valid = false;
+        return;
+    }
+
+    // Invert the entry->slot map (counting sort, stable so that entries are processed in assembly order)
+    int nnz = (int)m_mat.nonZeros();
+    int n_entries = (int)m_entry_slot.size();
+    m_slot_entry_start.assign(nnz + 1, 0);
+    for (int e = 0; e < n_entries; e++)
+        m_slot_entry_start[m_entry_slot[e] + 1]++;
+    for (int s = 0; s < nnz; s++)
+        m_slot_entry_start[s + 1] += m_slot_entry_start[s];
+    std::vector<int> pos(m_slot_entry_start.begin(), m_slot_entry_start.end() - 1);
+    m_slot_entries.resize(n_entries);
+    for (int e = 0; e < n_entries; e++)
+        m_slot_entries[pos[m_entry_slot[e]]++] = e;
+
+    m_entry_value.resize(n_entries);
+    m_cache_valid = true;
+}
+
+bool ChDirectSolverLS::AssembleFromCache(ChSystemDescriptor& sysd) {
+    std::vector<ChVariables*> variables;
+    std::vector<ChConstraint*> constraints;
+    CollectActiveItems(sysd, variables, constraints);
+    auto& kblocks = sysd.GetKblocksList();
+
+    int n_v = (int)variables.size();
+    int n_k = (int)kblocks.size();
+    int n_c = (int)constraints.size();
+    if (n_v != m_cache_items[0] || n_k != m_cache_items[1] || n_c != m_cache_items[2])
+        return false;
+
+    int n_q = m_dim - n_c;
+    double c_a = sysd.GetMassFactor();
+    int nthreads = sysd.GetNumThreads();
+    int n_items = n_v + n_k + n_c;
+    bool failed = false;
+
+    // Evaluate all matrix entries in parallel over variables, stiffness blocks, and constraints.
+    // Each object writes its entries in its own segment of the value buffer.
+#pragma omp parallel num_threads(nthreads) reduction(|| : failed)
+    {
+        ChSparseSlotWriter writer(m_mat);
+
+#pragma omp for schedule(dynamic, 16)
+        for (int i = 0; i < n_items; i++) {
+            writer.Replay(m_entry_slot.data(), m_entry_overwrite.data(), m_entry_value.data(), m_item_start[i],
+                          m_item_start[i + 1]);
+            if (i < n_v) {
+                auto var = variables[i];
+                var->Build_M(writer, var->GetOffset(), var->GetOffset(), c_a);
+            } else if (i < n_v + n_k) {
+                kblocks[i - n_v]->Build_K(writer, true);
+            } else {
+                int ic = i - n_v - n_k;
+                constraints[ic]->Build_Cq(writer, n_q + ic);
+                constraints[ic]->Build_CqT(writer, n_q + ic);
+                writer.SetElement(n_q + ic, n_q + ic, constraints[ic]->Get_cfm_i());
+            }
+            failed = failed || !writer.ReplayComplete();
+        }
+
+        failed = failed || writer.Failed();
+    }
+
+    if (failed)
+        return false;
+
+    // Load the matrix values, in parallel over value slots.
+    // Entries are processed in assembly order, so that the result is identical to the default assembly.
+    int nnz = (int)m_mat.nonZeros();
+    double* values = m_mat.valuePtr();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int s = 0; s < nnz; s++) {
+        double val = 0;
+        for (int k = m_slot_entry_start[s]; k < m_slot_entry_start[s + 1]; k++) {
+            int e = m_slot_entries[k];
+            val = m_entry_overwrite[e] ? m_entry_value[e] : val + m_entry_value[e];
+        }
+        values[s] = val;
+    }
+
+    return true;
+}
+
 bool ChDirectSolverLS::SetupCurrent() {
     m_timer_setup_assembly.start();
 
@@ -15,6 +15,8 @@
 #ifndef CH_DIRECTSOLVER_LS_H
 #define CH_DIRECTSOLVER_LS_H
 
+#include <vector>
+
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
@@ -56,6 +58,14 @@ to a fully dense matrix). This value is used if the sparsity pattern learner is
 space for matrix indices and nonzeros.
 See #SetSparsityEstimate();
 
+Finally, for problems with a fixed matrix structure (e.g., FEA meshes with constant topology), the \e cached assembly
+option records, at the first assembly, the location in the CSR value array of every matrix entry written by the
+variables, stiffness blocks (ChKblock), and constraints. Subsequent calls to Setup then only evaluate the entries (in
+parallel over these objects) and scatter them directly in the existing matrix buffers, bypassing the sparse matrix
+insertion logic. If a change in the problem structure is detected, the matrix is assembled and the cache recorded
+again.\n
+See #UseCachedAssembly();
+
 <br>
 
 <div class="ce-warning">
@@ -92,6 +102,12 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable cached matrix assembly (default: false).\n
+    /// If enabled, the CSR value slots of all matrix entries are recorded at the first assembly and reused in
+    /// subsequent calls to Setup, as long as the structure of the problem does not change. The result is identical to
+    /// the one obtained with the default assembly. Enable this option together with the sparsity pattern lock.
+    void UseCachedAssembly(bool val);
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -128,6 +144,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Return the number of calls to the solver's Setup function.
     int GetNumSolveCalls() const { return m_solve_call; }
 
+    /// Return the number of calls to the solver's Setup function in which the matrix was assembled from the cache.
+    int GetNumCachedAssemblyCalls() const { return m_cached_assembly_call; }
+
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
 
@@ -192,6 +211,13 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Typically, direct solvers only require the matrix for their #Setup() phase.
     virtual bool SolveRequiresMatrix() const override { return false; }
 
+    /// Record the CSR value slots of all entries written in the (already assembled and compressed) problem matrix.
+    void RecordAssemblyCache(ChSystemDescriptor& sysd);
+
+    /// Assemble the problem matrix using the cached value slots.
+    /// Return false if the structure of the problem changed since the cache was recorded.
+    bool AssembleFromCache(ChSystemDescriptor& sysd);
+
     ChSparseMatrix m_mat;           ///< problem matrix
     int m_dim;                      ///< problem size
     MatrixSymmetryType m_symmetry;  ///< symmetry of problem matrix
@@ -199,8 +225,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChVectorDynamic<double> m_rhs;  ///< right-hand side vector
     ChVectorDynamic<double> m_sol;  ///< solution vector
 
-    int m_solve_call;  ///< counter for calls to Solve
-    int m_setup_call;  ///< counter for calls to Setup
+    int m_solve_call;            ///< counter for calls to Solve
+    int m_setup_call;            ///< counter for calls to Setup
+    int m_cached_assembly_call;  ///< counter for calls to Setup with cached matrix assembly
 
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
@@ -210,6 +237,17 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
 
+    bool m_use_cache;    ///< use cached matrix assembly?
+    bool m_cache_valid;  ///< is the assembly cache up to date?
+
+    std::vector<int> m_cache_items;         ///< number of active variables, stiffness blocks, and active constraints
+    std::vector<int> m_item_start;          ///< index of first entry, per object (plus end marker)
+    std::vector<int> m_entry_slot;          ///< index in the CSR value array, per entry
+    std::vector<char> m_entry_overwrite;    ///< entry overwrites (rather than adds to) the current value?
+    std::vector<double> m_entry_value;      ///< entry values, filled at each cached assembly
+    std::vector<int> m_slot_entry_start;    ///< index of first entry in m_slot_entries, per value slot (plus end marker)
+    std::vector<int> m_slot_entries;        ///< entries contributing to each value slot, in assembly order
+
     ChTimer<> m_timer_setup_assembly;    ///< timer for matrix assembly
     ChTimer<> m_timer_setup_solvercall;  ///< timer for factorization
     ChTimer<> m_timer_solve_assembly;    ///< timer for RHS assembly
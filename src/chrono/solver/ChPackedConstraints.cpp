@@ -0,0 +1,184 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/solver/ChPackedConstraints.h"
+#include "chrono/solver/ChConstraintTwoTuplesContactN.h"
+
+namespace chrono {
+
+void ChPackedConstraints::Clear() {
+    b.clear();
+    cfm.clear();
+    g.clear();
+    l.clear();
+    projection.clear();
+    friction.clear();
+    cohesion.clear();
+    constraints.clear();
+    block_start.clear();
+    block_offset.clear();
+    block_ndof.clear();
+    block_data.clear();
+    jac_Cq.clear();
+    jac_Eq.clear();
+}
+
+void ChPackedConstraints::AddBlock(int var_offset, int ndof, const double* Cq, const double* Eq) {
+    if (ndof == 0)
+        return;
+    block_offset.push_back(var_offset);
+    block_ndof.push_back(ndof);
+    block_data.push_back((int)jac_Cq.size());
+    jac_Cq.insert(jac_Cq.end(), Cq, Cq + ndof);
+    jac_Eq.insert(jac_Eq.end(), Eq, Eq + ndof);
+}
+
+bool ChPackedConstraints::Pack(std::vector<ChConstraint*>& mconstraints) {
+    Clear();
+
+    // Note: containers are cleared but keep their capacity, so that re-packing at each step does not reallocate.
+    block_start.push_back(0);
+
+    int i_friction_comp = 0;
+
+    for (auto constraint : mconstraints) {
+        if (!constraint->IsActive())
+            continue;
+
+        ProjectionType ptype = ProjectionType::NONE;
+        double mu = 0;
+        double coh = 0;
+
+        switch (constraint->GetMode()) {
+            case CONSTRAINT_UNILATERAL:
+                if (i_friction_comp != 0)
+                    return false;
+                ptype = ProjectionType::UNILATERAL;
+                break;
+            case CONSTRAINT_FRIC:
+                // Frictional contacts are (n,u,v) triplets, with the normal component first
+                if (i_friction_comp == 0) {
+                    auto contact = dynamic_cast<ChConstraintTwoTuplesContactNall*>(constraint);
+                    if (!contact)
+                        return false;
+                    ptype = ProjectionType::FRICTION_N;
+                    mu = contact->GetFrictionCoefficient();
+                    coh = contact->GetCohesion();
+                } else {
+                    ptype = ProjectionType::FRICTION_T;
+                }
+                i_friction_comp = (i_friction_comp + 1) % 3;
+                break;
+            default:
+                if (i_friction_comp != 0)
+                    return false;
+                break;
+        }
+
+        if (!constraint->PackJacobian(*this))
+            return false;
+        block_start.push_back((int)block_offset.size());
+
+        constraints.push_back(constraint);
+        b.push_back(constraint->Get_b_i());
+        cfm.push_back(constraint->Get_cfm_i());
+        g.push_back(constraint->Get_g_i());
+        l.push_back(constraint->Get_l_i());
+        projection.push_back(ptype);
+        friction.push_back(mu);
+        cohesion.push_back(coh);
+    }
+
+    // Incomplete friction triplet
+    if (i_friction_comp != 0)
+        return false;
+
+    return true;
+}
+
+void ChPackedConstraints::Project(int ic) {
+    switch (projection[ic]) {
+        case ProjectionType::UNILATERAL:
+            if (l[ic] < 0.)
+                l[ic] = 0.;
+            return;
+        case ProjectionType::FRICTION_N:
+            break;
+        default:
+            return;
+    }
+
+    // Anitescu-Tasora projection on cone generator and polar cone
+    // (same as ChConstraintTwoTuplesContactN::Project, on the packed n,u,v triplet)
+
+    double& l_n = l[ic];
+    double& l_u = l[ic + 1];
+    double& l_v = l[ic + 2];
+    double mu = friction[ic];
+    double coh = cohesion[ic];
+
+    double f_n = l_n + coh;
+
+    // no friction? project to axis of upper cone
+    if (mu == 0) {
+        l_u = 0;
+        l_v = 0;
+        if (f_n < 0)
+            l_n = 0;
+        return;
+    }
+
+    double f_u = l_u;
+    double f_v = l_v;
+
+    double mu2 = mu * mu;
+    double f_n2 = f_n * f_n;
+    double f_t2 = (f_v * f_v + f_u * f_u);
+
+    // inside lower cone or close to origin? reset normal, u, v to zero!
+    if ((f_n <= 0 && f_t2 < f_n2 / mu2) || (f_n < 1e-14 && f_n > -1e-14)) {
+        l_n = 0;
+        l_u = 0;
+        l_v = 0;
+        return;
+    }
+
+    // inside upper cone? keep untouched!
+    if (f_t2 < f_n2 * mu2)
+        return;
+
+    // project orthogonally to generator segment of upper cone
+    double f_t = std::sqrt(f_t2);
+    double f_n_proj = (f_t * mu + f_n) / (mu2 + 1);
+    double f_t_proj = f_n_proj * mu;
+    double tproj_div_t = f_t_proj / f_t;
+
+    l_n = f_n_proj - coh;
+    l_u = tproj_div_t * f_u;
+    l_v = tproj_div_t * f_v;
+}
+
+void ChPackedConstraints::FromConstraints() {
+    for (size_t ic = 0; ic < constraints.size(); ic++)
+        l[ic] = constraints[ic]->Get_l_i();
+}
+
+void ChPackedConstraints::ToConstraints() const {
+    for (size_t ic = 0; ic < constraints.size(); ic++)
+        constraints[ic]->Set_l_i(l[ic]);
+}
+
+}  // end namespace chrono
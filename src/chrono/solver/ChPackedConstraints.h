@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CH_PACKED_CONSTRAINTS_H
+#define CH_PACKED_CONSTRAINTS_H
+
+#include <vector>
+
+#include "chrono/solver/ChConstraint.h"
+#include "chrono/solver/ChVariables.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Flat, structure-of-arrays storage of the active constraints in a ChSystemDescriptor.
+/// All jacobian rows [Cq_i] and the auxiliary [Eq_i]=[invM]*[Cq_i]' columns are stored in two contiguous buffers, split
+/// in blocks (one per constrained ChVariables object), each block addressing a segment of a global vector 'q' of
+/// variables. The scalar constraint data (b_i, cfm_i, g_i, l_i) and the projection type are also stored in contiguous
+/// arrays, with the three components (n,u,v) of a frictional contact always stored consecutively.
+///
+/// This allows PSOR-like solvers (ChSolverPSOR, ChSolverPSSOR, ChSolverPJacobi) to iterate over the constraints without
+/// virtual calls. The packed data is produced by ChSystemDescriptor::PackConstraints(), see also
+/// ChSystemDescriptor::SetUsePackedConstraints().
+class ChApi ChPackedConstraints {
+  public:
+    /// Projection applied to the multipliers of a packed constraint.
+    enum class ProjectionType : char {
+        NONE,          ///< bilateral constraint, no projection
+        UNILATERAL,    ///< unilateral constraint, l_i >= 0
+        FRICTION_N,    ///< normal component of a frictional contact (projects the n,u,v triplet on the friction cone)
+        FRICTION_T     ///< tangential component of a frictional contact (projected by its normal component)
+    };
+
+    ChPackedConstraints() {}
+
+    /// Clear all packed data.
+    void Clear();
+
+    /// Pack all active constraints in the given list.
+    /// The variable offsets (see ChVariables::GetOffset) must be up to date and the auxiliary data of all constraints
+    /// (g_i and [Eq_i], see ChConstraint::Update_auxiliary) must have been already computed.
+    /// Return false if some active constraint cannot be packed (see ChConstraint::PackJacobian); in this case the
+    /// packed data must not be used.
+    bool Pack(std::vector<ChConstraint*>& constraints);
+
+    /// Append a jacobian block for the constraint currently being packed.
+    /// This function is called by the implementations of ChConstraint::PackJacobian.
+    void AddBlock(int var_offset, int ndof, const double* Cq, const double* Eq);
+
+    /// Return the number of packed (active) scalar constraints.
+    int GetNumConstraints() const { return (int)l.size(); }
+
+    /// Return the constraint object corresponding to the i-th packed constraint.
+    ChConstraint* GetConstraint(int ic) const { return constraints[ic]; }
+
+    /// Return the range [first, last) of the jacobian blocks of the i-th packed constraint.
+    void GetBlockRange(int ic, int& first, int& last) const {
+        first = block_start[ic];
+        last = block_start[ic + 1];
+    }
+
+    /// Return the offset in the global 'q' vector of the variables of the given jacobian block.
+    int GetBlockOffset(int ib) const { return block_offset[ib]; }
+
+    /// Compute the product [Cq_i]*q for the i-th packed constraint.
+    double Compute_Cq_q(int ic, const ChVectorDynamic<>& q) const {
+        double ret = 0;
+        for (int ib = block_start[ic]; ib < block_start[ic + 1]; ib++) {
+            const double* Cq = &jac_Cq[block_data[ib]];
+            const double* qv = q.data() + block_offset[ib];
+            for (int k = 0; k < block_ndof[ib]; k++)
+                ret += Cq[k] * qv[k];
+        }
+        return ret;
+    }
+
+    /// Increment q += [Eq_i]*deltal for the i-th packed constraint.
+    void Increment_q(int ic, double deltal, ChVectorDynamic<>& q) const {
+        for (int ib = block_start[ic]; ib < block_start[ic + 1]; ib++) {
+            const double* Eq = &jac_Eq[block_data[ib]];
+            double* qv = q.data() + block_offset[ib];
+            for (int k = 0; k < block_ndof[ib]; k++)
+                qv[k] += Eq[k] * deltal;
+        }
+    }
+
+    /// Return the violation of the i-th packed constraint, given its residual (see ChConstraint::Violation).
+    double Violation(int ic, double mc_i) const {
+        if (projection[ic] == ProjectionType::UNILATERAL && mc_i > 0.)
+            return 0.;
+        return mc_i;
+    }
+
+    /// Project the multiplier of the i-th packed constraint onto its admissible set (see ChConstraint::Project).
+    /// For the normal component of a frictional contact, the triplet (ic, ic+1, ic+2) is projected on the friction
+    /// cone. Tangential components of frictional contacts are left untouched.
+    void Project(int ic);
+
+    /// Load the multipliers l_i from the constraint objects.
+    void FromConstraints();
+
+    /// Store the multipliers l_i back into the constraint objects.
+    void ToConstraints() const;
+
+    std::vector<double> b;                   ///< known terms b_i
+    std::vector<double> cfm;                 ///< constraint force mixing terms cfm_i
+    std::vector<double> g;                   ///< g_i = [Cq_i]*[invM_i]*[Cq_i]' (+cfm_i)
+    std::vector<double> l;                   ///< multipliers l_i
+    std::vector<ProjectionType> projection;  ///< projection type, per constraint
+    std::vector<double> friction;            ///< friction coefficient (normal contact components only)
+    std::vector<double> cohesion;            ///< cohesion (normal contact components only)
+
+  private:
+    std::vector<ChConstraint*> constraints;  ///< packed constraints
+    std::vector<int> block_start;            ///< index of first block, per constraint (plus one end marker)
+    std::vector<int> block_offset;           ///< offset in global 'q' vector, per block
+    std::vector<int> block_ndof;             ///< number of variables, per block
+    std::vector<int> block_data;             ///< index in the jac_Cq and jac_Eq buffers, per block
+    std::vector<double> jac_Cq;              ///< contiguous buffer of jacobian blocks [Cq_i]
+    std::vector<double> jac_Eq;              ///< contiguous buffer of auxiliary blocks [Eq_i]=[invM]*[Cq_i]'
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -54,6 +54,8 @@ class ChApi ChSolver {
         BICGSTAB,  ///< Bi-conjugate gradient stabilized
         // Other
         CUSTOM,
+        // Iterative VI solvers (appended to preserve the values of existing enumerators)
+        PSOR_COLORED,  ///< Projected SOR with graph coloring (parallel)
     };
 
     virtual ~ChSolver() {}
@@ -61,6 +63,11 @@ class ChApi ChSolver {
     /// Return type of the solver.
     virtual Type GetType() const { return Type::CUSTOM; }
 
+    /// "Virtual" copy constructor.
+    /// Return a new solver with the same settings as this one, or nullptr if this solver cannot be cloned (default).
+    /// Cloned solvers are used to solve independent sub-problems concurrently (see ChDescriptorIslands).
+    virtual ChSolver* Clone() const { return nullptr; }
+
     /// Indicate whether or not the Solve() phase requires an up-to-date problem matrix.
     /// Typically, direct solvers only need the matrix for the Setup() phase. However, iterative solvers likely require
     /// the matrix to perform the necessary matrix-vector operations.
@@ -17,6 +17,7 @@
 
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -49,6 +50,7 @@ ChSolverADMM::ChSolverADMM(std::shared_ptr<ChDirectSolverLS> my_LS_engine) :
 
 
 double ChSolverADMM::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverADMM::Solve");
 
     switch (this->acceleration) {
     case AdmmAcceleration::BASIC:
@@ -292,6 +294,8 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     */
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE_ZONE("ChSolverADMM::Iteration");
+
         // diagnostic
         l_old = l;
         z_old = z;
@@ -697,6 +701,7 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     */
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE_ZONE("ChSolverADMM::Iteration");
 
         // diagnostic
         l_old = l;
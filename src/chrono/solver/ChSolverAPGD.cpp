@@ -15,6 +15,7 @@
 #include "chrono/solver/ChSolverAPGD.h"
 
 #include "chrono/core/ChStream.h"
+#include "chrono/utils/ChTracer.h"
 
 #include <iostream>
 #include <sstream>
@@ -72,6 +73,8 @@ double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
 }
 
 double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverAPGD::Solve");
+
     bool verbose = false;
     const std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     const std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
@@ -155,6 +158,8 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
 
     // (7) for k := 0 to N_max
     for (m_iterations = 0; m_iterations < m_max_iterations; m_iterations++) {
+        CH_TRACE_ZONE("ChSolverAPGD::Iteration");
+
         // (8) g = N * y_k - r
         // (9) gamma_(k+1) = ProjectionOperator(y_k - t_k * g)
         sysd.ShurComplementProduct(g, y);  // g = N * y
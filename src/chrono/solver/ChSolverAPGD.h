@@ -32,6 +32,9 @@ class ChApi ChSolverAPGD : public ChIterativeSolverVI {
 
     ~ChSolverAPGD() {}
 
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverAPGD* Clone() const override { return new ChSolverAPGD(*this); }
+
     virtual Type GetType() const override { return Type::APGD; }
 
     /// Performs the solution of the problem.
@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChSolverBB.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -23,6 +24,8 @@ CH_FACTORY_REGISTER(ChSolverBB)
 ChSolverBB::ChSolverBB() : n_armijo(10), max_armijo_backtrace(3), lastgoodres(1e30) {}
 
 double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverBB::Solve");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -157,6 +160,8 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     std::vector<double> f_hist;
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE_ZONE("ChSolverBB::Iteration");
+
         // Dg = Di*g;
         mDg = mg;
         if (m_use_precond)
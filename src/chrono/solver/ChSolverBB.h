@@ -34,6 +34,9 @@ class ChApi ChSolverBB : public ChIterativeSolverVI {
 
     ~ChSolverBB() {}
 
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverBB* Clone() const override { return new ChSolverBB(*this); }
+
     virtual Type GetType() const override { return Type::BARZILAIBORWEIN; }
 
     /// Performs the solution of the problem.
@@ -12,8 +12,11 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChSolverPJacobi.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -25,6 +28,8 @@ ChSolverPJacobi::ChSolverPJacobi() : maxviolation(0) {
 }
 
 double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPJacobi::Solve");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -57,6 +62,10 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
         }
     }
 
+    // Use flat constraint data if requested (and if supported by all active constraints)
+    if (sysd.UsePackedConstraints() && sysd.PackConstraints())
+        return SolvePacked(sysd);
+
     // 2)  Compute, for all items with variables, the initial guess for
     //     still unconstrained system:
 
@@ -80,6 +89,8 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
     delta_gammas.resize(mconstraints.size());
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE_ZONE("ChSolverPJacobi::Iteration");
+
         // The iteration on all constraints
         //
 
@@ -187,4 +198,141 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
     return maxviolation;
 }
 
+double ChSolverPJacobi::SolvePacked(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPJacobi::SolvePacked");
+
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+    ChPackedConstraints& pc = sysd.GetPackedConstraints();
+    const int nc = pc.GetNumConstraints();
+
+    double maxdeltalambda = 0;
+    int i_friction_comp = 0;
+    double old_lambda_friction[3];
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system, then gather all variables in a single vector
+
+    for (unsigned int iv = 0; iv < mvariables.size(); iv++)
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
+
+    ChVectorDynamic<> q;
+    sysd.FromVariablesToVector(q);
+
+    // 3)  If no warm start, simply resets initial lagrangians to zero.
+    if (!m_warm_start) {
+        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+            mconstraints[ic]->Set_l_i(0.);
+        std::fill(pc.l.begin(), pc.l.end(), 0.);
+    }
+
+    // 4)  Perform the iteration loops
+    //
+
+    std::vector<double> delta_gammas;
+    delta_gammas.resize(nc);
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE_ZONE("ChSolverPJacobi::Iteration");
+
+        maxviolation = 0;
+        maxdeltalambda = 0;
+
+        for (int ic = 0; ic < nc; ic++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = pc.Compute_Cq_q(ic, q) + pc.b[ic] + pc.cfm[ic] * pc.l[ic];
+
+            // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+            double candidate_violation = fabs(pc.Violation(ic, mresidual));
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / pc.g[ic]) * (-mresidual);
+
+            if (pc.projection[ic] == ChPackedConstraints::ProjectionType::FRICTION_N ||
+                pc.projection[ic] == ChPackedConstraints::ProjectionType::FRICTION_T) {
+                candidate_violation = 0;
+
+                // update:   lambda += delta_lambda;
+                old_lambda_friction[i_friction_comp] = pc.l[ic];
+                pc.l[ic] = old_lambda_friction[i_friction_comp] + deltal;
+                i_friction_comp++;
+
+                if (i_friction_comp == 1)
+                    candidate_violation = fabs(ChMin(0.0, mresidual));
+
+                if (i_friction_comp == 3) {
+                    pc.Project(ic - 2);  // the N normal component will take care of N,U,V
+                    double new_lambda_0 = pc.l[ic - 2];
+                    double new_lambda_1 = pc.l[ic - 1];
+                    double new_lambda_2 = pc.l[ic - 0];
+                    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                    if (m_shlambda != 1.0) {
+                        new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
+                        new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
+                        new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
+                        pc.l[ic - 2] = new_lambda_0;
+                        pc.l[ic - 1] = new_lambda_1;
+                        pc.l[ic - 0] = new_lambda_2;
+                    }
+                    delta_gammas[ic - 2] = new_lambda_0 - old_lambda_friction[0];
+                    delta_gammas[ic - 1] = new_lambda_1 - old_lambda_friction[1];
+                    delta_gammas[ic - 0] = new_lambda_2 - old_lambda_friction[2];
+
+                    if (this->record_violation_history) {
+                        maxdeltalambda = ChMax(maxdeltalambda, fabs(delta_gammas[ic - 2]));
+                        maxdeltalambda = ChMax(maxdeltalambda, fabs(delta_gammas[ic - 1]));
+                        maxdeltalambda = ChMax(maxdeltalambda, fabs(delta_gammas[ic - 0]));
+                    }
+                    i_friction_comp = 0;
+                }
+            } else {
+                // update:   lambda += delta_lambda;
+                double old_lambda = pc.l[ic];
+                pc.l[ic] = old_lambda + deltal;
+
+                // If new lagrangian multiplier does not satisfy inequalities, project
+                // it into an admissible orthant (or, in general, onto an admissible set)
+                pc.Project(ic);
+
+                // After projection, the lambda may have changed a bit..
+                double new_lambda = pc.l[ic];
+
+                // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                if (m_shlambda != 1.0) {
+                    new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+                    pc.l[ic] = new_lambda;
+                }
+
+                delta_gammas[ic] = new_lambda - old_lambda;
+
+                if (this->record_violation_history)
+                    maxdeltalambda = ChMax(maxdeltalambda, fabs(delta_gammas[ic]));
+            }
+
+            maxviolation = ChMax(maxviolation, fabs(candidate_violation));
+        }
+
+        // Now, after all deltas are updated, sweep through all constraints and increment  q += [invM][Cq]'* delta_l
+        for (int ic = 0; ic < nc; ic++)
+            pc.Increment_q(ic, delta_gammas[ic], q);
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+    }
+
+    // 5)  Scatter the results back to variables and constraints
+    sysd.FromVectorToVariables(q);
+    pc.ToConstraints();
+
+    return maxviolation;
+}
+
 }  // end namespace chrono
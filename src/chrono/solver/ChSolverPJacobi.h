@@ -33,6 +33,9 @@ class ChApi ChSolverPJacobi : public ChIterativeSolverVI {
 
     ~ChSolverPJacobi() {}
 
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverPJacobi* Clone() const override { return new ChSolverPJacobi(*this); }
+
     virtual Type GetType() const override { return Type::PJACOBI; }
 
     /// Performs the solution of the problem.
@@ -45,6 +48,10 @@ class ChApi ChSolverPJacobi : public ChIterativeSolverVI {
     virtual double GetError() const override { return maxviolation; }
 
   private:
+    /// Solve using the packed constraint data of the system descriptor.
+    /// See ChSystemDescriptor::SetUsePackedConstraints.
+    double SolvePacked(ChSystemDescriptor& sysd);
+
     double maxviolation;
 };
 
@@ -14,6 +14,7 @@
 
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -26,6 +27,8 @@ ChSolverPMINRES::ChSolverPMINRES()
       r_proj_resid(1e30) {}
 
 double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPMINRES::Solve");
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -166,6 +169,8 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     std::vector<double> f_hist;
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE_ZONE("ChSolverPMINRES::Iteration");
+
         // MNp = Mi*Np; % = Mi*N*p                  %% -- Precond
         if (m_use_precond)
             mMNp = mNp.array() * mDi.array();
@@ -283,6 +288,8 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
 //////////////////////////////////////////////////////////////////////////////
 
 double ChSolverPMINRES::Solve_SupportingStiffness(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPMINRES::Solve_SupportingStiffness");
+
     m_iterations = 0;
 
     // Allocate auxiliary vectors;
@@ -374,6 +381,8 @@ double ChSolverPMINRES::Solve_SupportingStiffness(ChSystemDescriptor& sysd) {
     //
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE_ZONE("ChSolverPMINRES::Iteration");
+
         // MZp = Mi*Zp; % = Mi*Z*p                  %% -- Precond
         if (m_use_precond)
             mMZp = mZp.array() * mDi.array();
@@ -41,6 +41,9 @@ ChSolverPMINRES : public ChIterativeSolverVI {
 
     ~ChSolverPMINRES() {}
 
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverPMINRES* Clone() const override { return new ChSolverPMINRES(*this); }
+
     virtual Type GetType() const override { return Type::PMINRES; }
 
     /// Performs the solution of the problem.
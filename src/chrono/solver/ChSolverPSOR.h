@@ -33,6 +33,9 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
 
     ~ChSolverPSOR() {}
 
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverPSOR* Clone() const override { return new ChSolverPSOR(*this); }
+
     virtual Type GetType() const override { return Type::PSOR; }
 
     /// Performs the solution of the problem.
@@ -44,8 +47,13 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     /// For the PSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
-  private:
+  protected:
     double maxviolation;
+
+  private:
+    /// Solve using the packed constraint data of the system descriptor.
+    /// See ChSystemDescriptor::SetUsePackedConstraints.
+    double SolvePacked(ChSystemDescriptor& sysd);
 };
 
 /// @} chrono_solver
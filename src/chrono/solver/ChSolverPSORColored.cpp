@@ -0,0 +1,273 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include "chrono/solver/ChSolverPSORColored.h"
+#include "chrono/core/ChMathematics.h"
+#include "chrono/utils/ChTracer.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORColored)
+
+// Maximum number of colors processed in parallel. Constraint groups that cannot be assigned one of these colors are
+// processed sequentially after all colors.
+static const int MAX_COLORS = 63;
+
+ChSolverPSORColored::ChSolverPSORColored() {}
+
+void ChSolverPSORColored::ColorConstraints(const ChPackedConstraints& pc, int n_q) {
+    const int nc = pc.GetNumConstraints();
+
+    // Greedy (first fit) coloring. Each variable keeps a bit mask of the colors of the constraint groups acting on it.
+    m_var_mask.assign(n_q, 0);
+
+    std::vector<int> group_first;
+    std::vector<int> group_color;
+    std::vector<int> color_count(MAX_COLORS + 1, 0);
+
+    for (int ic = 0; ic < nc;) {
+        int size = (pc.projection[ic] == ChPackedConstraints::ProjectionType::FRICTION_N) ? 3 : 1;
+
+        uint64_t used = 0;
+        for (int k = ic; k < ic + size; k++) {
+            int first, last;
+            pc.GetBlockRange(k, first, last);
+            for (int ib = first; ib < last; ib++)
+                used |= m_var_mask[pc.GetBlockOffset(ib)];
+        }
+
+        int color = MAX_COLORS;
+        for (int c = 0; c < MAX_COLORS; c++) {
+            if (!(used & (uint64_t(1) << c))) {
+                color = c;
+                break;
+            }
+        }
+
+        if (color < MAX_COLORS) {
+            for (int k = ic; k < ic + size; k++) {
+                int first, last;
+                pc.GetBlockRange(k, first, last);
+                for (int ib = first; ib < last; ib++)
+                    m_var_mask[pc.GetBlockOffset(ib)] |= (uint64_t(1) << color);
+            }
+        }
+
+        group_first.push_back(ic);
+        group_color.push_back(color);
+        color_count[color]++;
+        ic += size;
+    }
+
+    // With first fit coloring, the used colors are always 0...n-1 (plus possibly the overflow color).
+    int num_colors = 0;
+    while (num_colors < MAX_COLORS && color_count[num_colors] > 0)
+        num_colors++;
+
+    // Sort groups by color (counting sort, stable so that the order within a color follows the constraint order).
+    std::vector<int> start(MAX_COLORS + 2, 0);
+    for (int c = 0; c <= MAX_COLORS; c++)
+        start[c + 1] = start[c] + color_count[c];
+
+    m_color_start.assign(start.begin(), start.begin() + num_colors + 1);
+
+    m_groups.resize(group_first.size());
+    for (size_t ig = 0; ig < group_first.size(); ig++)
+        m_groups[start[group_color[ig]]++] = group_first[ig];
+
+    m_violation.assign(m_groups.size(), 0);
+    m_deltalambda.assign(m_groups.size(), 0);
+}
+
+void ChSolverPSORColored::SolveGroup(ChPackedConstraints& pc,
+                                     int ic,
+                                     ChVectorDynamic<>& q,
+                                     double& violation,
+                                     double& deltalambda) {
+    if (pc.projection[ic] == ChPackedConstraints::ProjectionType::FRICTION_N) {
+        // Frictional contact: update the n,u,v multipliers, then project them all at once on the friction cone
+        double old_lambda[3];
+        double residual_n = 0;
+        for (int k = 0; k < 3; k++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = pc.Compute_Cq_q(ic + k, q) + pc.b[ic + k] + pc.cfm[ic + k] * pc.l[ic + k];
+            if (k == 0)
+                residual_n = mresidual;
+
+            // update:   lambda += delta_lambda, with delta_lambda = -(omega/g_i) * c_i
+            old_lambda[k] = pc.l[ic + k];
+            pc.l[ic + k] = old_lambda[k] + (m_omega / pc.g[ic + k]) * (-mresidual);
+        }
+
+        pc.Project(ic);
+
+        deltalambda = 0;
+        for (int k = 0; k < 3; k++) {
+            double new_lambda = pc.l[ic + k];
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[k];
+                pc.l[ic + k] = new_lambda;
+            }
+            double true_delta = new_lambda - old_lambda[k];
+            pc.Increment_q(ic + k, true_delta, q);
+            deltalambda = ChMax(deltalambda, fabs(true_delta));
+        }
+
+        violation = fabs(ChMin(0.0, residual_n));
+        return;
+    }
+
+    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+    double mresidual = pc.Compute_Cq_q(ic, q) + pc.b[ic] + pc.cfm[ic] * pc.l[ic];
+
+    // update:   lambda += delta_lambda, with delta_lambda = -(omega/g_i) * c_i
+    double old_lambda = pc.l[ic];
+    pc.l[ic] = old_lambda + (m_omega / pc.g[ic]) * (-mresidual);
+
+    // If new lagrangian multiplier does not satisfy inequalities, project it into an admissible set
+    pc.Project(ic);
+    double new_lambda = pc.l[ic];
+
+    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+    if (m_shlambda != 1.0) {
+        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+        pc.l[ic] = new_lambda;
+    }
+
+    double true_delta = new_lambda - old_lambda;
+    pc.Increment_q(ic, true_delta, q);
+
+    violation = fabs(pc.Violation(ic, mresidual));
+    deltalambda = fabs(true_delta);
+}
+
+double ChSolverPSORColored::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE_ZONE("ChSolverPSORColored::Solve");
+
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+    int nthreads = sysd.GetNumThreads();
+
+    m_iterations = 0;
+    maxviolation = 0;
+    double maxdeltalambda = 0.;
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+    //
+    int j_friction_comp = 0;
+    double gi_values[3];
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+            gi_values[j_friction_comp] = mconstraints[ic]->Get_g_i();
+            j_friction_comp++;
+            if (j_friction_comp == 3) {
+                double average_g_i = (gi_values[0] + gi_values[1] + gi_values[2]) / 3.0;
+                mconstraints[ic - 2]->Set_g_i(average_g_i);
+                mconstraints[ic - 1]->Set_g_i(average_g_i);
+                mconstraints[ic - 0]->Set_g_i(average_g_i);
+                j_friction_comp = 0;
+            }
+        }
+    }
+
+    // Pack the active constraints in flat arrays. If not possible, fall back to the sequential algorithm.
+    if (!sysd.PackConstraints())
+        return ChSolverPSOR::Solve(sysd);
+
+    ChPackedConstraints& pc = sysd.GetPackedConstraints();
+    const int nc = pc.GetNumConstraints();
+    const int nv = (int)mvariables.size();
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system, then gather all variables in a single vector
+#pragma omp parallel for num_threads(nthreads)
+    for (int iv = 0; iv < nv; iv++) {
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->Compute_invMb_v(mvariables[iv]->Get_qb(), mvariables[iv]->Get_fb());  // q = [M]'*fb
+    }
+
+    ChVectorDynamic<> q;
+    int n_q = sysd.FromVariablesToVector(q);
+
+    // 3)  Add the effect of initial (guessed) lagrangian reactions, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    if (m_warm_start) {
+        for (int ic = 0; ic < nc; ic++)
+            pc.Increment_q(ic, pc.l[ic], q);
+    } else {
+        for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+            mconstraints[ic]->Set_l_i(0.);
+        std::fill(pc.l.begin(), pc.l.end(), 0.);
+    }
+
+    // Color the constraint graph
+    ColorConstraints(pc, n_q);
+    const int num_colors = GetNumColors();
+    const int num_groups = (int)m_groups.size();
+
+    // 4)  Perform the iteration loops
+    //
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE_ZONE("ChSolverPSORColored::Iteration");
+
+        // Sweep all colors, processing in parallel the constraint groups with same color
+        for (int color = 0; color < num_colors; color++) {
+            int start = m_color_start[color];
+            int end = m_color_start[color + 1];
+#pragma omp parallel for num_threads(nthreads) if (end - start > 64)
+            for (int ig = start; ig < end; ig++) {
+                SolveGroup(pc, m_groups[ig], q, m_violation[ig], m_deltalambda[ig]);
+            }
+        }
+
+        // Sequential sweep over the groups that could not be colored
+        for (int ig = m_color_start[num_colors]; ig < num_groups; ig++) {
+            SolveGroup(pc, m_groups[ig], q, m_violation[ig], m_deltalambda[ig]);
+        }
+
+        maxviolation = 0;
+        maxdeltalambda = 0;
+        for (int ig = 0; ig < num_groups; ig++) {
+            maxviolation = ChMax(maxviolation, m_violation[ig]);
+            maxdeltalambda = ChMax(maxdeltalambda, m_deltalambda[ig]);
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+
+    }  // end iteration loop
+
+    // 5)  Scatter the results back to variables and constraints
+    sysd.FromVectorToVariables(q);
+    pc.ToConstraints();
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,78 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_COLORED_H
+#define CHSOLVER_PSOR_COLORED_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono/solver/ChSolverPSOR.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// A parallel iterative solver based on projective fixed point method, with overrelaxation and immediate variable
+/// update as in SOR methods, where the constraints are processed in a graph-colored order.\n
+/// At each solve, the constraint graph (variables as nodes, constraints as edges) is greedily colored so that no two
+/// constraints with the same color share a variable. Each color is then swept in parallel with OpenMP, using the number
+/// of threads set through ChSystem::SetNumThreads. The three components of a frictional contact are always processed
+/// together. Since the update order differs from the one of ChSolverPSOR, the iterates are not identical to those of
+/// the sequential solver, but the convergence behavior is the same. Results do not depend on the number of threads.\n
+/// This solver works on the packed constraint data of the system descriptor (see ChPackedConstraints); if some active
+/// constraint does not support packing, the solver falls back to the sequential ChSolverPSOR algorithm.\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORColored : public ChSolverPSOR {
+  public:
+    ChSolverPSORColored();
+
+    ~ChSolverPSORColored() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverPSORColored* Clone() const override { return new ChSolverPSORColored(*this); }
+
+    virtual Type GetType() const override { return Type::PSOR_COLORED; }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the number of colors used in the last solve.
+    int GetNumColors() const { return (int)m_color_start.size() - 1; }
+
+  private:
+    /// Color the constraint graph of the packed constraints.
+    /// Fills the list of constraint groups (single constraints or friction triplets) sorted by color.
+    void ColorConstraints(const ChPackedConstraints& pc, int n_q);
+
+    /// Process one constraint group: update its multipliers and the variables it acts on.
+    /// Return the maximum violation and the maximum change of multipliers in the group.
+    void SolveGroup(ChPackedConstraints& pc, int ic, ChVectorDynamic<>& q, double& violation, double& deltalambda);
+
+    std::vector<int> m_groups;          ///< index of the first packed constraint of each group, sorted by color
+    std::vector<int> m_color_start;     ///< index in m_groups of the first group of each color (plus end marker)
+    std::vector<double> m_violation;    ///< maximum violation, per group
+    std::vector<double> m_deltalambda;  ///< maximum change in multipliers, per group
+    std::vector<uint64_t> m_var_mask;   ///< colors already used by each variable (indexed by variable offset)
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -38,6 +38,9 @@ ChSolverPSSOR : public ChIterativeSolverVI {
 
     ~ChSolverPSSOR() {}
 
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverPSSOR* Clone() const override { return new ChSolverPSSOR(*this); }
+
     virtual Type GetType() const override { return Type::PSSOR; }
 
     /// Performs the solution of the problem.
@@ -50,6 +53,10 @@ ChSolverPSSOR : public ChIterativeSolverVI {
     virtual double GetError() const override { return maxviolation; }
 
   private:
+    /// Solve using the packed constraint data of the system descriptor.
+    /// See ChSystemDescriptor::SetUsePackedConstraints.
+    double SolvePacked(ChSystemDescriptor& sysd);
+
     double maxviolation;
 };
 
@@ -25,7 +25,7 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor() : c_a(1.0), use_packed(false), num_threads(1), n_q(0), n_c(0), freeze_count(false) {
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
@@ -99,6 +99,10 @@ void ChSystemDescriptor::UpdateCountsAndOffsets() {
     freeze_count = true;
 }
 
+bool ChSystemDescriptor::PackConstraints() {
+    return vpacked.Pack(vconstraints);
+}
+
 void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
                                              ChSparseMatrix* H,
                                              ChSparseMatrix* E,
@@ -19,6 +19,7 @@
 
 #include "chrono/solver/ChConstraint.h"
 #include "chrono/solver/ChKblock.h"
+#include "chrono/solver/ChPackedConstraints.h"
 #include "chrono/solver/ChVariables.h"
 
 namespace chrono {
@@ -77,6 +78,11 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  // coefficient form M mass matrices in vvariables
 
+    bool use_packed;              ///< if true, PSOR-like solvers work on packed constraint data
+    ChPackedConstraints vpacked;  ///< flat (structure-of-arrays) copy of the active constraints
+
+    int num_threads;  ///< number of threads that solvers may use
+
   private:
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
@@ -146,6 +152,32 @@ class ChApi ChSystemDescriptor {
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual double GetMassFactor() { return c_a; }
 
+    /// Enable/disable the use of packed constraint data in PSOR-like solvers (default: false).
+    /// If enabled, ChSolverPSOR, ChSolverPSSOR and ChSolverPJacobi copy all active constraints into contiguous
+    /// structure-of-arrays buffers (see ChPackedConstraints) at the beginning of each solve, and then iterate over
+    /// these buffers without virtual calls. Results are the same as with the default mode. If some active
+    /// constraint does not support packing (for example rolling friction or boxed constraints), solvers silently
+    /// fall back to the default mode.
+    void SetUsePackedConstraints(bool val) { use_packed = val; }
+
+    /// Return true if PSOR-like solvers should use packed constraint data.
+    bool UsePackedConstraints() const { return use_packed; }
+
+    /// Pack all active constraints into the flat storage returned by GetPackedConstraints().
+    /// Must be called after the auxiliary data of the constraints is updated (see ChConstraint::Update_auxiliary).
+    /// Return false if some active constraint cannot be packed.
+    virtual bool PackConstraints();
+
+    /// Access the packed constraint data (valid only after a successful call to PackConstraints()).
+    ChPackedConstraints& GetPackedConstraints() { return vpacked; }
+
+    /// Set the number of threads that solvers may use (default: 1).
+    /// This is set by the owning system before each solve, see ChSystem::SetNumThreads.
+    void SetNumThreads(int nthreads) { num_threads = nthreads; }
+
+    /// Return the number of threads that solvers may use.
+    int GetNumThreads() const { return num_threads; }
+
     // DATA <-> MATH.VECTORS FUNCTIONS
 
     /// Get a vector with all the 'fb' known terms ('forces'etc.) associated to all variables,
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -73,6 +74,8 @@ CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 // Euler explicit timestepper.
 // This performs the typical  y_new = y+ dy/dt * dt integration with Euler formula.
 void ChTimestepperEulerExpl::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerExpl::Advance");
+
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -109,6 +112,8 @@ CH_FACTORY_REGISTER(ChTimestepperEulerExplIIorder)
 //    v_new = v + a * dt
 // integration with Euler formula.
 void ChTimestepperEulerExplIIorder::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerExplIIorder::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -147,6 +152,8 @@ CH_FACTORY_REGISTER(ChTimestepperEulerSemiImplicit)
 //    x_new = x + v_new * dt
 // integration with Euler semi-implicit formula.
 void ChTimestepperEulerSemiImplicit::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerSemiImplicit::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -180,6 +187,8 @@ CH_FACTORY_REGISTER(ChTimestepperRungeKuttaExpl)
 
 // Performs a step of a 4th order explicit Runge-Kutta integration scheme.
 void ChTimestepperRungeKuttaExpl::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperRungeKuttaExpl::Advance");
+
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -226,6 +235,8 @@ CH_FACTORY_REGISTER(ChTimestepperHeun)
 
 // Performs a step of a Heun explicit integrator. It is like a 2nd Runge Kutta.
 void ChTimestepperHeun::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperHeun::Advance");
+
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -269,6 +280,8 @@ CH_FACTORY_REGISTER(ChTimestepperLeapfrog)
 // Suggestion: use the ChTimestepperEulerSemiImplicit, it gives
 // the same accuracy with a bit of faster performance.
 void ChTimestepperLeapfrog::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperLeapfrog::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -301,11 +314,61 @@ void ChTimestepperLeapfrog::Advance(const double dt) {
 
 // -----------------------------------------------------------------------------
 
+bool ChImplicitIterativeTimestepper::NewtonMatrixUpdateRequired(double h, int nv, int nc) {
+    // Reset the contraction rate monitor for the new step
+    newton_norm = -1;
+    jacobian_fresh = false;
+
+    if (!jacobian_reuse || jacobian_age == 0 || jacobian_age >= jacobian_max_steps)
+        return true;
+
+    // The Newton matrix depends on the step size (through the factors of M, dF/dv, and dF/dx)
+    if (h != jacobian_h || nv != jacobian_nv || nc != jacobian_nc)
+        return true;
+
+    jacobian_age++;
+    return false;
+}
+
+void ChImplicitIterativeTimestepper::NewtonMatrixUpdated(double h, int nv, int nc) {
+    jacobian_age = 1;
+    jacobian_fresh = true;
+    jacobian_h = h;
+    jacobian_nv = nv;
+    jacobian_nc = nc;
+    newton_norm = -1;
+    numsetups_total++;
+}
+
+void ChImplicitIterativeTimestepper::NewtonSolveDone(bool setup, bool setup_without_reuse, double h, int nv, int nc) {
+    numsolves++;
+    if (setup) {
+        numsetups++;
+        NewtonMatrixUpdated(h, nv, nc);
+    } else if (setup_without_reuse) {
+        numsetups_saved++;
+    }
+}
+
+bool ChImplicitIterativeTimestepper::NewtonContractionSlow(double update_norm) {
+    bool slow = false;
+    if (newton_norm > 0) {
+        newton_rate = update_norm / newton_norm;
+        slow = jacobian_reuse && !jacobian_fresh && newton_rate > jacobian_max_rate;
+    }
+    newton_norm = update_norm;
+    return slow;
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 
 // Performs a step of Euler implicit for II order systems
 void ChTimestepperEulerImplicit::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicit::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -337,6 +400,9 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    // Without reuse of the Newton matrix across steps, the solver's Setup is called at each iteration
+    bool call_setup = NewtonMatrixUpdateRequired(dt, mintegrable->GetNcoords_v(), mintegrable->GetNconstr());
+
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R.setZero();
@@ -361,12 +427,15 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
+        // Without reuse, the solver's Setup is called at each iteration
         numiters++;
-        numsetups++;
-        numsolves++;
+        NewtonSolveDone(call_setup, true, dt, mintegrable->GetNcoords_v(), mintegrable->GetNconstr());
+
+        // Update the Newton matrix at each iteration, unless reusing it and the iteration converges fast enough
+        call_setup = !jacobian_reuse || NewtonContractionSlow(Dv.norm());
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -399,6 +468,8 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitLinearized)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the typical Anitescu stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicitLinearized::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -469,6 +540,8 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitProjected)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the Tasora stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperEulerImplicitProjected::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -562,6 +635,8 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidal)
 // order in constraint reactions. Use damped HHT or damped Newmark for
 // more advanced options.
 void ChTimestepperTrapezoidal::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperTrapezoidal::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -657,6 +732,8 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized)
 
 // Performs a step of trapezoidal implicit linearized for II order systems
 void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperTrapezoidalLinearized::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -737,6 +814,8 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized2)
 // Performs a step of trapezoidal implicit linearized for II order systems
 //*** SIMPLIFIED VERSION -DOES NOT WORK - PREFER ChTimestepperTrapezoidalLinearized
 void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperTrapezoidalLinearized2::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -822,6 +901,8 @@ void ChTimestepperNewmark::SetGammaBeta(double mgamma, double mbeta) {
 
 // Performs a step of Newmark constrained implicit for II order DAE systems
 void ChTimestepperNewmark::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperNewmark::Advance");
+
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -856,7 +937,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
-    bool call_setup = true;
+    bool call_setup = NewtonMatrixUpdateRequired(dt, mintegrable->GetNcoords_v(), mintegrable->GetNconstr());
 
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -893,14 +974,14 @@ void ChTimestepperNewmark::Advance(const double dt) {
             call_setup                      // force a call to the solver's Setup() function
         );
 
+        // Without reuse, the solver's Setup is called at the first iteration (at each iteration with full Newton)
         numiters++;
-        numsolves++;
-        if (call_setup) {
-            numsetups++;
-        }
+        NewtonSolveDone(call_setup, numsolves == 0 || !modified_Newton, dt, mintegrable->GetNcoords_v(),
+                        mintegrable->GetNconstr());
 
-        // If using modified Newton, do not call Setup again
-        call_setup = !modified_Newton;
+        // If using modified Newton, do not call Setup again (unless the Newton matrix is from a previous step and the
+        // iteration does not converge fast enough)
+        call_setup = NewtonContractionSlow(Da.norm()) || !modified_Newton;
 
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
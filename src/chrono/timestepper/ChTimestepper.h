@@ -186,9 +186,60 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     int numsetups;  ///< number of calls to the solver's Setup function
     int numsolves;  ///< number of calls to the solver's Solve function
 
+    bool jacobian_reuse;       ///< reuse the Newton matrix across steps?
+    int jacobian_max_steps;    ///< maximum number of steps using the same Newton matrix
+    double jacobian_max_rate;  ///< maximum Newton contraction rate with a Newton matrix from a previous step
+    int jacobian_age;          ///< number of steps using the current Newton matrix (0: no valid matrix)
+    bool jacobian_fresh;       ///< was the Newton matrix updated during the current step?
+    double jacobian_h;         ///< step size at the last Newton matrix update
+    int jacobian_nv;           ///< number of velocity-level coordinates at the last Newton matrix update
+    int jacobian_nc;           ///< number of constraints at the last Newton matrix update
+    double newton_norm;        ///< norm of the previous Newton update in the current step (-1 if none)
+    double newton_rate;        ///< last observed Newton contraction rate
+
+    unsigned int numsetups_total;  ///< cumulative number of calls to the solver's Setup function
+    unsigned int numsetups_saved;  ///< cumulative number of calls to the solver's Setup function saved by reuse
+
+    /// Return true if the Newton matrix must be updated at the beginning of a step.
+    /// The Newton matrix is always updated if reuse across steps is disabled. Otherwise, it is updated if there is no
+    /// valid matrix, if it was used for the maximum number of steps, or if the step size or problem size changed.
+    bool NewtonMatrixUpdateRequired(double h, int nv, int nc);
+
+    /// Record a call to the solver's Setup function (for a step of size h and the given problem size).
+    void NewtonMatrixUpdated(double h, int nv, int nc);
+
+    /// Record a call to the solver's Solve function (for a step of size h and the given problem size).
+    /// 'setup' indicates whether the solver's Setup function was called for this solve, and 'setup_without_reuse'
+    /// whether the integrator would have called it if reuse of the Newton matrix across steps were disabled; a solve
+    /// without Setup call in the latter case counts as a saved Setup call.
+    void NewtonSolveDone(bool setup, bool setup_without_reuse, double h, int nv, int nc);
+
+    /// Record the norm of a Newton update and estimate the contraction rate of the Newton iteration.
+    /// Return true if the contraction is too slow with a Newton matrix evaluated at a previous step, in which case the
+    /// caller should update the Newton matrix.
+    bool NewtonContractionSlow(double update_norm);
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          jacobian_reuse(false),
+          jacobian_max_steps(20),
+          jacobian_max_rate(0.5),
+          jacobian_age(0),
+          jacobian_fresh(false),
+          jacobian_h(0),
+          jacobian_nv(0),
+          jacobian_nc(0),
+          newton_norm(-1),
+          newton_rate(0),
+          numsetups_total(0),
+          numsetups_saved(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -228,26 +279,62 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     int GetNumSolveCalls() const { return numsolves; }
 
+    /// Enable/disable reuse of the Newton matrix across steps (default: false).
+    /// If enabled, the solver's Setup function (e.g., the matrix factorization of a direct sparse solver) is not
+    /// called at the beginning of a step and the Newton matrix of a previous step is reused. The Newton matrix is
+    /// updated if it was used for more than 'max_steps' steps, if the step size or the problem size changed, or if the
+    /// observed contraction rate of the Newton iteration (ratio of the norms of successive updates) exceeds 'max_rate'.
+    /// This is effective for quasi-linear problems, where the Newton matrix changes little from one step to the next.
+    void SetJacobianReuse(bool val, int max_steps = 20, double max_rate = 0.5) {
+        jacobian_reuse = val;
+        jacobian_max_steps = max_steps;
+        jacobian_max_rate = max_rate;
+        jacobian_age = 0;
+    }
+
+    /// Return true if reuse of the Newton matrix across steps is enabled.
+    bool GetJacobianReuse() const { return jacobian_reuse; }
+
+    /// Return the cumulative number of calls to the solver's Setup function (over all steps).
+    unsigned int GetNumSetupCallsTotal() const { return numsetups_total; }
+
+    /// Return the cumulative number of calls to the solver's Setup function saved by reusing the Newton matrix.
+    /// This is the number of solves performed without a Setup call for which the integrator would have called Setup
+    /// if reuse were disabled: at every Newton iteration for Euler implicit (and for HHT and Newmark with full
+    /// Newton), only at the first iteration of a step for HHT and Newmark with modified Newton.
+    unsigned int GetNumSetupCallsSaved() const { return numsetups_saved; }
+
+    /// Return the last observed contraction rate of the Newton iteration.
+    double GetNewtonContractionRate() const { return newton_rate; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& archive) {
         // version number
-        archive.VersionWrite(1);
+        archive.VersionWrite(2);
         // serialize all member data:
         archive << CHNVP(maxiters);
         archive << CHNVP(reltol);
         archive << CHNVP(abstolS);
         archive << CHNVP(abstolL);
+        archive << CHNVP(jacobian_reuse);
+        archive << CHNVP(jacobian_max_steps);
+        archive << CHNVP(jacobian_max_rate);
     }
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& archive) {
         // version number
-        /*int version =*/ archive.VersionRead();
+        int version = archive.VersionRead();
         // stream in all member data:
         archive >> CHNVP(maxiters);
         archive >> CHNVP(reltol);
         archive >> CHNVP(abstolS);
         archive >> CHNVP(abstolL);
+        if (version >= 2) {
+            archive >> CHNVP(jacobian_reuse);
+            archive >> CHNVP(jacobian_max_steps);
+            archive >> CHNVP(jacobian_max_rate);
+        }
     }
 };
 
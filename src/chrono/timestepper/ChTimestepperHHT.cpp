@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChTracer.h"
 
 namespace chrono {
 
@@ -50,6 +51,8 @@ void ChTimestepperHHT::SetAlpha(double malpha) {
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
+    CH_TRACE_ZONE("ChTimestepperHHT::Advance");
+
     // Downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -107,8 +110,10 @@ void ChTimestepperHHT::Advance(const double dt) {
     //   - on a stepsize decrease
     //   - if the Newton iteration does not converge with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
+    // If reuse of the Newton matrix across steps is enabled, the matrix from a previous step may be used at the
+    // beginning of the step (see ChImplicitIterativeTimestepper::SetJacobianReuse).
     matrix_is_current = false;
-    call_setup = true;
+    call_setup = NewtonMatrixUpdateRequired(h, mintegrable->GetNcoords_v(), mintegrable->GetNconstr());
 
     // Loop until reaching final time
     while (true) {
@@ -120,6 +125,8 @@ void ChTimestepperHHT::Advance(const double dt) {
         int it;
 
         for (it = 0; it < maxiters; it++) {
+            CH_TRACE_ZONE("ChTimestepperHHT::NewtonIteration");
+
             if (verbose && modified_Newton && call_setup)
                 GetLog() << " HHT call Setup.\n";
 
@@ -127,14 +134,14 @@ void ChTimestepperHHT::Advance(const double dt) {
             Increment(mintegrable, scaling_factor);
 
             // Increment counters
+            // Without reuse, the solver's Setup is called at the first iteration (at each iteration with full Newton)
             numiters++;
-            numsolves++;
-            if (call_setup) {
-                numsetups++;
-            }
+            NewtonSolveDone(call_setup, numsolves == 0 || !modified_Newton, h, mintegrable->GetNcoords_v(),
+                            mintegrable->GetNconstr());
 
-            // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
+            // If using modified Newton, do not call Setup again (unless the Newton matrix is from a previous step and
+            // the iteration does not converge fast enough)
+            call_setup = NewtonContractionSlow(Da.norm()) || !modified_Newton;
 
             // A flag to indicate the trend of convergence
             if ((Rold.norm() < R.norm()) && (R.norm() > threshold_R)) {
@@ -197,6 +204,19 @@ void ChTimestepperHHT::Advance(const double dt) {
                 call_setup = true;
             */
 
+        } else if (!jacobian_fresh) {
+            // ------ NR did not converge with a Newton matrix from a previous step
+
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
+
+            // re-attempt step with updated matrix
+            if (verbose) {
+                GetLog() << " HHT re-attempt step with updated matrix.\n";
+            }
+
+            call_setup = true;
+
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
 
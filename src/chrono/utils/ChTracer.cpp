@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+#include "chrono/utils/ChTracer.h"
+
+namespace chrono {
+namespace utils {
+
+std::atomic<bool> ChTracer::m_enabled(false);
+
+namespace {
+
+// Ring buffer of events of a single thread.
+// Only the owning thread writes to the buffer; all other accesses happen when no thread is recording.
+struct ThreadBuffer {
+    std::vector<ChTraceEvent> events;
+    size_t count = 0;  // total number of events recorded since the last clear
+};
+
+// Registry of all thread buffers. Buffers are never released, so that the events of threads which have since
+// terminated can still be exported.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    size_t buffer_size = 65536;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+ThreadBuffer* GetThreadBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer));
+        buffer = registry.buffers.back().get();
+        buffer->events.resize(registry.buffer_size);
+    }
+    return buffer;
+}
+
+// Write a string as a JSON string literal.
+void WriteJSONString(std::ostream& os, const char* str) {
+    os << '"';
+    for (const char* c = str; *c; c++) {
+        switch (*c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            default:
+                if ((unsigned char)*c < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", (unsigned int)*c);
+                    os << code;
+                } else {
+                    os << *c;
+                }
+        }
+    }
+    os << '"';
+}
+
+}  // end anonymous namespace
+
+void ChTracer::SetBufferSize(size_t num_events) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffer_size = std::max(num_events, size_t(1));
+}
+
+void ChTracer::Clear() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& buffer : registry.buffers)
+        buffer->count = 0;
+}
+
+int64_t ChTracer::Now() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void ChTracer::Record(const char* name, int64_t start, int64_t end) {
+    ThreadBuffer* buffer = GetThreadBuffer();
+    ChTraceEvent& event = buffer->events[buffer->count % buffer->events.size()];
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    buffer->count++;
+}
+
+int ChTracer::GetNumThreads() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return (int)registry.buffers.size();
+}
+
+std::vector<ChTraceEvent> ChTracer::GetEvents(int thread) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::vector<ChTraceEvent> events;
+    if (thread < 0 || thread >= (int)registry.buffers.size())
+        return events;
+
+    const ThreadBuffer& buffer = *registry.buffers[thread];
+    size_t capacity = buffer.events.size();
+    size_t num = std::min(buffer.count, capacity);
+    events.reserve(num);
+    for (size_t i = buffer.count - num; i < buffer.count; i++)
+        events.push_back(buffer.events[i % capacity]);
+    return events;
+}
+
+bool ChTracer::WriteChromeTrace(const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    int num_threads = GetNumThreads();
+
+    // Complete ("X") events, with timestamps and durations in microseconds
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for (int t = 0; t < num_threads; t++) {
+        file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << t
+             << ",\"args\":{\"name\":\"thread " << t << "\"}}";
+        first = false;
+        for (const auto& event : GetEvents(t)) {
+            char times[64];
+            std::snprintf(times, sizeof(times), "\"ts\":%.3f,\"dur\":%.3f", event.start * 1e-3,
+                          (event.end - event.start) * 1e-3);
+            file << ",\n{\"name\":";
+            WriteJSONString(file, event.name);
+            file << ",\"cat\":\"chrono\",\"ph\":\"X\"," << times << ",\"pid\":0,\"tid\":" << t << "}";
+        }
+    }
+    file << "\n]}\n";
+
+    return file.good();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CHTRACER_H
+#define CHTRACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// A completed zone, as recorded by ChTracer.
+struct ChTraceEvent {
+    const char* name;  ///< zone name (must be a string with static storage duration, e.g. a literal)
+    int64_t start;     ///< start time, in nanoseconds since the tracer epoch
+    int64_t end;       ///< end time, in nanoseconds since the tracer epoch
+};
+
+/// Thread-aware, low-overhead tracing profiler.\n
+/// Timed zones are declared with the CH_TRACE_ZONE macro, which creates a scoped ChTraceZone object recording the
+/// time spent until the end of the enclosing block. Each thread records its zones in its own fixed-size ring buffer,
+/// without any locking; once a buffer is full, the oldest events of that thread are overwritten. Nested zones are
+/// displayed as a hierarchy by trace viewers.\n
+/// The collected events can be exported in the Chrome trace event format (JSON), which can be loaded in
+/// chrome://tracing or https://ui.perfetto.dev.\n
+/// Zones are compiled only if Chrono was configured with ENABLE_TRACING (CHRONO_TRACING_ENABLED is then defined in
+/// ChConfig.h); otherwise CH_TRACE_ZONE expands to nothing. Even if compiled, no events are recorded until tracing is
+/// enabled at run time with ChTracer::Enable().\n
+/// Example:
+/// <pre>
+///   ChTracer::Enable(true);
+///   for (int i = 0; i < 1000; i++)
+///       sys.DoStepDynamics(1e-3);
+///   ChTracer::Enable(false);
+///   ChTracer::WriteChromeTrace("chrono_trace.json");
+/// </pre>
+class ChApi ChTracer {
+  public:
+    /// Enable or disable the recording of events (default: disabled).
+    static void Enable(bool val) { m_enabled.store(val, std::memory_order_relaxed); }
+
+    /// Return true if events are currently recorded.
+    static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Set the capacity (number of events) of the per-thread ring buffers (default: 65536).
+    /// This only affects the buffers of threads that did not record any event yet.
+    static void SetBufferSize(size_t num_events);
+
+    /// Discard all recorded events.
+    /// Must not be called while other threads are recording events.
+    static void Clear();
+
+    /// Return the current time, in nanoseconds since the tracer epoch.
+    static int64_t Now();
+
+    /// Record a completed zone in the buffer of the calling thread.
+    static void Record(const char* name, int64_t start, int64_t end);
+
+    /// Return the number of threads which recorded events.
+    static int GetNumThreads();
+
+    /// Return the events currently held in the buffer of the specified thread, in chronological order.
+    /// Must not be called while other threads are recording events.
+    static std::vector<ChTraceEvent> GetEvents(int thread);
+
+    /// Write all recorded events to the specified file, in the Chrome trace event format (JSON).
+    /// Must not be called while other threads are recording events. Return false if the file cannot be opened.
+    static bool WriteChromeTrace(const std::string& filename);
+
+  private:
+    static std::atomic<bool> m_enabled;
+};
+
+/// Scoped timing zone.
+/// The zone starts when the object is constructed and ends when it is destroyed. It is recorded only if tracing was
+/// enabled at construction time. Use through the CH_TRACE_ZONE macro.
+class ChTraceZone {
+  public:
+    explicit ChTraceZone(const char* name) : m_name(name), m_start(ChTracer::IsEnabled() ? ChTracer::Now() : -1) {}
+    ~ChTraceZone() {
+        if (m_start >= 0)
+            ChTracer::Record(m_name, m_start, ChTracer::Now());
+    }
+
+  private:
+    ChTraceZone(const ChTraceZone&) = delete;
+    ChTraceZone& operator=(const ChTraceZone&) = delete;
+
+    const char* m_name;
+    int64_t m_start;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#define CH_TRACE_CONCAT_IMPL(a, b) a##b
+#define CH_TRACE_CONCAT(a, b) CH_TRACE_CONCAT_IMPL(a, b)
+
+/// Time the enclosing block as a zone with the given name (a string literal).
+#ifdef CHRONO_TRACING_ENABLED
+#define CH_TRACE_ZONE(name) chrono::utils::ChTraceZone CH_TRACE_CONCAT(ch_trace_zone_, __LINE__)(name)
+#else
+#define CH_TRACE_ZONE(name)
+#endif
+
+#endif
@@ -14,6 +14,11 @@
 //
 // =============================================================================
 
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/assets/ChCapsuleShape.h"
 #include "chrono/assets/ChColorAsset.h"
@@ -26,7 +31,9 @@
 #include "chrono/assets/ChRoundedCylinderShape.h"
 #include "chrono/assets/ChSphereShape.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/core/ChMappedFile.h"
 #include "chrono/geometry/ChLineBezier.h"
+#include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 
 namespace chrono {
@@ -104,16 +111,18 @@ bool WriteCheckpoint(ChSystem* system, const std::string& filename) {
             // Write shape material information
             if (ctype == 0) {
                 auto mat = std::static_pointer_cast<ChMaterialSurfaceNSC>(shape->GetMaterial());
-                csv << mat->static_friction << mat->sliding_friction << mat->rolling_friction << mat->spinning_friction;
-                csv << mat->restitution << mat->cohesion << mat->dampingf;
-                csv << mat->compliance << mat->complianceT << mat->complianceRoll << mat->complianceSpin;
+                csv << mat->GetSfriction() << mat->GetKfriction() << mat->GetRollingFriction()
+                    << mat->GetSpinningFriction();
+                csv << mat->GetRestitution() << mat->GetCohesion() << mat->GetDampingF();
+                csv << mat->GetCompliance() << mat->GetComplianceT() << mat->GetComplianceRolling()
+                    << mat->GetComplianceSpinning();
                 csv << tab;
             } else {
                 auto mat = std::static_pointer_cast<ChMaterialSurfaceSMC>(shape->GetMaterial());
-                csv << mat->young_modulus << mat->poisson_ratio;
-                csv << mat->static_friction << mat->sliding_friction;
-                csv << mat->restitution << mat->constant_adhesion << mat->adhesionMultDMT;
-                csv << mat->kn << mat->gn << mat->kt << mat->gt;
+                csv << mat->GetYoungModulus() << mat->GetPoissonRatio();
+                csv << mat->GetSfriction() << mat->GetKfriction();
+                csv << mat->GetRestitution() << mat->GetAdhesion() << mat->GetAdhesionMultDMT();
+                csv << mat->GetKn() << mat->GetGn() << mat->GetKt() << mat->GetGt();
                 csv << tab;
             }
 
@@ -220,18 +229,38 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
             // Get material information and create the material
             std::shared_ptr<ChMaterialSurface> mat;
             if (ctype == 0) {
+                float v[11];
+                for (int k = 0; k < 11; k++)
+                    iss >> v[k];
                 auto matNSC = chrono_types::make_shared<ChMaterialSurfaceNSC>();
-                iss >> matNSC->static_friction >> matNSC->sliding_friction >> matNSC->rolling_friction >>
-                    matNSC->spinning_friction;
-                iss >> matNSC->restitution >> matNSC->cohesion >> matNSC->dampingf;
-                iss >> matNSC->compliance >> matNSC->complianceT >> matNSC->complianceRoll >> matNSC->complianceSpin;
+                matNSC->SetSfriction(v[0]);
+                matNSC->SetKfriction(v[1]);
+                matNSC->SetRollingFriction(v[2]);
+                matNSC->SetSpinningFriction(v[3]);
+                matNSC->SetRestitution(v[4]);
+                matNSC->SetCohesion(v[5]);
+                matNSC->SetDampingF(v[6]);
+                matNSC->SetCompliance(v[7]);
+                matNSC->SetComplianceT(v[8]);
+                matNSC->SetComplianceRolling(v[9]);
+                matNSC->SetComplianceSpinning(v[10]);
                 mat = matNSC;
             } else {
+                float v[11];
+                for (int k = 0; k < 11; k++)
+                    iss >> v[k];
                 auto matSMC = chrono_types::make_shared<ChMaterialSurfaceSMC>();
-                iss >> matSMC->young_modulus >> matSMC->poisson_ratio;
-                iss >> matSMC->static_friction >> matSMC->sliding_friction;
-                iss >> matSMC->restitution >> matSMC->constant_adhesion >> matSMC->adhesionMultDMT;
-                iss >> matSMC->kn >> matSMC->gn >> matSMC->kt >> matSMC->gt;
+                matSMC->SetYoungModulus(v[0]);
+                matSMC->SetPoissonRatio(v[1]);
+                matSMC->SetSfriction(v[2]);
+                matSMC->SetKfriction(v[3]);
+                matSMC->SetRestitution(v[4]);
+                matSMC->SetAdhesion(v[5]);
+                matSMC->SetAdhesionMultDMT(v[6]);
+                matSMC->SetKn(v[7]);
+                matSMC->SetGn(v[8]);
+                matSMC->SetKt(v[9]);
+                matSMC->SetGt(v[10]);
                 mat = matSMC;
             }
 
@@ -295,6 +324,376 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// WriteBinaryCheckpoint
+//
+// Layout of a binary checkpoint (all data in native binary format):
+//   - header (format identifier and version, sizes, simulation time and step count)
+//   - one metadata record per physics item (bodies, shafts, links, meshes, other items)
+//   - state vectors x, v, a and the reactions L of the assembly constraints
+//   - one record per NSC contact (shape identifiers, feature index) and the contact reactions
+//   - the quaternion derivatives (first and second) of all bodies
+// -----------------------------------------------------------------------------
+
+namespace {
+
+const char checkpoint_tag[8] = {'C', 'H', 'C', 'K', 'P', 'T', 'B', 'N'};
+const uint32_t checkpoint_version = 2;
+
+struct CheckpointHeader {
+    char tag[8];
+    uint32_t version;
+    uint32_t real_size;  // sizeof(double)
+    int32_t contact_method;
+    int32_t num_items;
+    int32_t nx;  // number of position-level coordinates
+    int32_t nv;  // number of velocity-level coordinates
+    int32_t nL;  // number of assembly constraints (contacts excluded)
+    int32_t num_contacts;
+    int32_t num_contact_reactions;
+    int32_t num_bodies;
+    double time;
+    uint64_t stepcount;
+};
+
+struct CheckpointItem {
+    int32_t type;  // 0: body, 1: shaft, 2: link, 3: mesh, 4: other physics item
+    int32_t dof_x;  // number of position-level coordinates
+    int32_t dof_w;  // number of velocity-level coordinates
+    int32_t doc;    // number of constraints
+    uint32_t offset_x;
+    uint32_t offset_w;
+    uint32_t offset_L;
+};
+
+struct CheckpointContact {
+    int32_t bodyA;   // index of body A in the system body list
+    int32_t shapeA;  // index of the shape in the collision model of body A (-1: collision model)
+    int32_t bodyB;
+    int32_t shapeB;
+    int32_t feature;
+    int32_t stride;  // number of contact reactions
+};
+
+// Metadata records of all physics items in the system, in the order in which they appear in the state vectors.
+std::vector<CheckpointItem> CheckpointItems(ChSystem* system) {
+    std::vector<CheckpointItem> items;
+    auto add = [&items](int type, ChPhysicsItem& item) {
+        items.push_back({type, item.GetDOF(), item.GetDOF_w(), item.GetDOC(), item.GetOffset_x(), item.GetOffset_w(),
+                         item.GetOffset_L()});
+    };
+    for (const auto& body : system->Get_bodylist())
+        add(0, *body);
+    for (const auto& shaft : system->Get_shaftlist())
+        add(1, *shaft);
+    for (const auto& link : system->Get_linklist())
+        add(2, *link);
+    for (const auto& mesh : system->Get_meshlist())
+        add(3, *mesh);
+    for (const auto& item : system->Get_otherphysicslist())
+        add(4, *item);
+    return items;
+}
+
+// Map the collision models and collision shapes of all bodies in the system to (body index, shape index) pairs.
+std::unordered_map<const void*, std::pair<int, int>> CheckpointShapes(ChSystem* system) {
+    std::unordered_map<const void*, std::pair<int, int>> shapes;
+    const auto& bodies = system->Get_bodylist();
+    for (int ib = 0; ib < (int)bodies.size(); ib++) {
+        auto model = bodies[ib]->GetCollisionModel();
+        if (!model)
+            continue;
+        shapes[model.get()] = std::make_pair(ib, -1);
+        for (int is = 0; is < model->GetNumShapes(); is++)
+            shapes[model->GetShape(is).get()] = std::make_pair(ib, is);
+    }
+    return shapes;
+}
+
+template <typename T>
+void WriteData(char*& ptr, const T* data, size_t n) {
+    if (n == 0)
+        return;
+    std::memcpy(ptr, data, n * sizeof(T));
+    ptr += n * sizeof(T);
+}
+
+template <typename T>
+bool ReadData(const char*& ptr, const char* end, T* data, size_t n) {
+    if ((size_t)(end - ptr) < n * sizeof(T))
+        return false;
+    if (n > 0)
+        std::memcpy(data, ptr, n * sizeof(T));
+    ptr += n * sizeof(T);
+    return true;
+}
+
+}  // end anonymous namespace
+
+void WriteBinaryCheckpoint(ChSystem* system, std::vector<char>& buffer) {
+    system->Setup();
+
+    // Collect the per-item metadata
+    auto items = CheckpointItems(system);
+
+    // Gather the system state and the reactions of the assembly constraints (contact reactions are stored separately,
+    // together with the information needed to identify the contacts in the restored system)
+    int nx = system->GetNcoords_x();
+    int nv = system->GetNcoords_v();
+    int nc = system->GetNconstr();
+    int nL = nc - system->GetContactContainer()->GetDOC();
+
+    ChState x(nx, system);
+    ChStateDelta v(nv, system);
+    ChStateDelta a(nv, system);
+    ChVectorDynamic<> L(nc);
+    double time;
+    system->StateGather(x, v, time);
+    system->StateGatherAcceleration(a);
+    system->StateGatherReactions(L);
+
+    // Collect the NSC contacts between body shapes, with their reactions
+    std::vector<CheckpointContact> contacts;
+    std::vector<double> contact_reactions;
+    if (auto container = std::dynamic_pointer_cast<ChContactContainerNSC>(system->GetContactContainer())) {
+        std::vector<ChContactContainerNSC::ContactKey> keys;
+        std::vector<int> strides;
+        container->GetContactKeys(keys, strides);
+        auto shapes = CheckpointShapes(system);
+        int offset = nL;
+        for (size_t i = 0; i < keys.size(); i++) {
+            auto shapeA = shapes.find(keys[i].shapeA);
+            auto shapeB = shapes.find(keys[i].shapeB);
+            if (shapeA != shapes.end() && shapeB != shapes.end()) {
+                contacts.push_back({shapeA->second.first, shapeA->second.second, shapeB->second.first,
+                                    shapeB->second.second, keys[i].feature, strides[i]});
+                contact_reactions.insert(contact_reactions.end(), L.data() + offset, L.data() + offset + strides[i]);
+            }
+            offset += strides[i];
+        }
+    }
+
+    // Collect the quaternion derivatives of all bodies. The angular velocities and accelerations in the state vectors
+    // are obtained from these, but the conversion back is not exact; they are stored so that bodies are restored
+    // bit-for-bit.
+    std::vector<double> body_rot;
+    for (const auto& body : system->Get_bodylist()) {
+        const auto& q_dt = body->GetRot_dt();
+        const auto& q_dtdt = body->GetRot_dtdt();
+        body_rot.insert(body_rot.end(), {q_dt.e0(), q_dt.e1(), q_dt.e2(), q_dt.e3()});
+        body_rot.insert(body_rot.end(), {q_dtdt.e0(), q_dtdt.e1(), q_dtdt.e2(), q_dtdt.e3()});
+    }
+
+    CheckpointHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.tag, checkpoint_tag, sizeof(checkpoint_tag));
+    header.version = checkpoint_version;
+    header.real_size = sizeof(double);
+    header.contact_method = (system->GetContactMethod() == ChContactMethod::NSC) ? 0 : 1;
+    header.num_items = (int32_t)items.size();
+    header.nx = nx;
+    header.nv = nv;
+    header.nL = nL;
+    header.num_contacts = (int32_t)contacts.size();
+    header.num_contact_reactions = (int32_t)contact_reactions.size();
+    header.num_bodies = (int32_t)system->Get_bodylist().size();
+    header.time = time;
+    header.stepcount = system->GetStepcount();
+
+    // Assemble the checkpoint in a single contiguous buffer
+    size_t size = sizeof(CheckpointHeader) + items.size() * sizeof(CheckpointItem) +
+                  (nx + 2 * nv + nL) * sizeof(double) + contacts.size() * sizeof(CheckpointContact) +
+                  (contact_reactions.size() + body_rot.size()) * sizeof(double);
+    buffer.resize(size);
+
+    char* ptr = buffer.data();
+    WriteData(ptr, &header, 1);
+    WriteData(ptr, items.data(), items.size());
+    WriteData(ptr, x.data(), nx);
+    WriteData(ptr, v.data(), nv);
+    WriteData(ptr, a.data(), nv);
+    WriteData(ptr, L.data(), nL);
+    WriteData(ptr, contacts.data(), contacts.size());
+    WriteData(ptr, contact_reactions.data(), contact_reactions.size());
+    WriteData(ptr, body_rot.data(), body_rot.size());
+    assert(ptr == buffer.data() + size);
+}
+
+bool WriteBinaryCheckpoint(ChSystem* system, const std::string& filename) {
+    std::vector<char> buffer;
+    WriteBinaryCheckpoint(system, buffer);
+
+    std::ofstream ofile(filename, std::ios::binary);
+    ofile.write(buffer.data(), buffer.size());
+    if (!ofile.good()) {
+        std::cout << "utils::WriteBinaryCheckpoint ERROR: cannot write checkpoint file " << filename << "\n";
+        return false;
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// ReadBinaryCheckpoint
+//
+// Validate the checkpoint against the current system and restore its state.
+// -----------------------------------------------------------------------------
+bool ReadBinaryCheckpoint(ChSystem* system, const char* buffer, size_t size) {
+    const char* ptr = buffer;
+    const char* end = buffer + size;
+
+    CheckpointHeader header;
+    if (!ReadData(ptr, end, &header, 1) || std::memcmp(header.tag, checkpoint_tag, sizeof(checkpoint_tag)) != 0 ||
+        header.version != checkpoint_version || header.real_size != sizeof(double)) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: invalid or incompatible checkpoint data\n";
+        return false;
+    }
+
+    // Check the counts in the header against the buffer size before allocating anything
+    if (header.num_items < 0 || header.nx < 0 || header.nv < 0 || header.nL < 0 || header.num_contacts < 0 ||
+        header.num_contact_reactions < 0 || header.num_bodies < 0) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: invalid checkpoint data\n";
+        return false;
+    }
+    uint64_t expected = sizeof(CheckpointHeader) + (uint64_t)header.num_items * sizeof(CheckpointItem) +
+                        ((uint64_t)header.nx + 2 * (uint64_t)header.nv + (uint64_t)header.nL) * sizeof(double) +
+                        (uint64_t)header.num_contacts * sizeof(CheckpointContact) +
+                        ((uint64_t)header.num_contact_reactions + 8 * (uint64_t)header.num_bodies) * sizeof(double);
+    if (expected != size) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: truncated checkpoint data\n";
+        return false;
+    }
+
+    // Read the item metadata, the state vectors and the contact data
+    std::vector<CheckpointItem> ckpt_items(header.num_items);
+    ChState x(header.nx, system);
+    ChStateDelta v(header.nv, system);
+    ChStateDelta a(header.nv, system);
+    ChVectorDynamic<> L_assembly(header.nL);
+    std::vector<CheckpointContact> contacts(header.num_contacts);
+    ChVectorDynamic<> contact_reactions(header.num_contact_reactions);
+    std::vector<double> body_rot(8 * (size_t)header.num_bodies);
+    ReadData(ptr, end, ckpt_items.data(), ckpt_items.size());
+    ReadData(ptr, end, x.data(), header.nx);
+    ReadData(ptr, end, v.data(), header.nv);
+    ReadData(ptr, end, a.data(), header.nv);
+    ReadData(ptr, end, L_assembly.data(), header.nL);
+    ReadData(ptr, end, contacts.data(), contacts.size());
+    ReadData(ptr, end, contact_reactions.data(), contact_reactions.size());
+    ReadData(ptr, end, body_rot.data(), body_rot.size());
+
+    int64_t num_reactions = 0;
+    for (const auto& contact : contacts) {
+        if (contact.stride <= 0) {
+            std::cout << "utils::ReadBinaryCheckpoint ERROR: invalid checkpoint contact data\n";
+            return false;
+        }
+        num_reactions += contact.stride;
+    }
+    if (num_reactions != header.num_contact_reactions) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: invalid checkpoint contact data\n";
+        return false;
+    }
+
+    // Check consistency with the current system (Setup only refreshes the system counters and offsets)
+    system->Setup();
+
+    auto items = CheckpointItems(system);
+    int contact_method = (system->GetContactMethod() == ChContactMethod::NSC) ? 0 : 1;
+    int nL = system->GetNconstr() - system->GetContactContainer()->GetDOC();
+    bool consistent = header.contact_method == contact_method && header.nx == system->GetNcoords_x() &&
+                      header.nv == system->GetNcoords_v() && header.nL == nL && ckpt_items.size() == items.size() &&
+                      header.num_bodies == (int)system->Get_bodylist().size();
+    for (size_t i = 0; consistent && i < items.size(); i++) {
+        consistent = ckpt_items[i].type == items[i].type && ckpt_items[i].dof_x == items[i].dof_x &&
+                     ckpt_items[i].dof_w == items[i].dof_w && ckpt_items[i].doc == items[i].doc &&
+                     ckpt_items[i].offset_x == items[i].offset_x && ckpt_items[i].offset_w == items[i].offset_w &&
+                     ckpt_items[i].offset_L == items[i].offset_L;
+    }
+    if (!consistent) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: checkpoint data inconsistent with the Chrono system\n";
+        return false;
+    }
+
+    // Map the contacts to the collision shapes of the current system
+    std::vector<ChContactContainerNSC::ContactKey> keys(contacts.size());
+    std::vector<int> strides(contacts.size());
+    const auto& bodies = system->Get_bodylist();
+    auto shape_ptr = [&bodies](int ib, int is) -> const void* {
+        if (ib < 0 || ib >= (int)bodies.size() || !bodies[ib]->GetCollisionModel())
+            return nullptr;
+        auto model = bodies[ib]->GetCollisionModel();
+        if (is < 0)
+            return model.get();
+        return is < model->GetNumShapes() ? model->GetShape(is).get() : nullptr;
+    };
+    for (size_t i = 0; i < contacts.size(); i++) {
+        keys[i].shapeA = shape_ptr(contacts[i].bodyA, contacts[i].shapeA);
+        keys[i].shapeB = shape_ptr(contacts[i].bodyB, contacts[i].shapeB);
+        keys[i].feature = contacts[i].feature;
+        strides[i] = contacts[i].stride;
+        if (!keys[i].shapeA || !keys[i].shapeB) {
+            std::cout << "utils::ReadBinaryCheckpoint ERROR: checkpoint contact data inconsistent with the system\n";
+            return false;
+        }
+    }
+
+    // All checks passed; the system is modified only from here on.
+    // Perform the initial system setup, if needed, so that it is not done later with the restored state
+    system->Update(false);
+
+    // Restore the state (the reactions of the contacts are not restored here)
+    ChVectorDynamic<> L(system->GetNconstr());
+    L.setZero();
+    L.head(nL) = L_assembly;
+    system->StateScatter(x, v, header.time, true);
+    system->StateScatterAcceleration(a);
+    system->StateScatterReactions(L);
+    system->SetStepcount((size_t)header.stepcount);
+
+    // Restore the exact quaternion derivatives of the bodies and update the system with these
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const double* q = &body_rot[8 * i];
+        bodies[i]->SetRot_dt(ChQuaternion<>(q[0], q[1], q[2], q[3]));
+        bodies[i]->SetRot_dtdt(ChQuaternion<>(q[4], q[5], q[6], q[7]));
+    }
+    system->Update(false);
+
+    // Contacts are regenerated at the next step; load their reactions in the warm start cache
+    if (auto container = std::dynamic_pointer_cast<ChContactContainerNSC>(system->GetContactContainer()))
+        container->SetReactionCache(keys, strides, contact_reactions);
+
+    return true;
+}
+
+bool ReadBinaryCheckpoint(ChSystem* system, const std::string& filename) {
+    std::ifstream ifile(filename, std::ios::binary | std::ios::ate);
+    if (!ifile.good()) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: cannot open checkpoint file " << filename << "\n";
+        return false;
+    }
+
+    std::vector<char> buffer((size_t)ifile.tellg());
+    ifile.seekg(0);
+    ifile.read(buffer.data(), buffer.size());
+    if (!ifile.good()) {
+        std::cout << "utils::ReadBinaryCheckpoint ERROR: cannot read checkpoint file " << filename << "\n";
+        return false;
+    }
+
+    return ReadBinaryCheckpoint(system, buffer.data(), buffer.size());
+}
+
+bool ReadBinaryCheckpointMapped(ChSystem* system, const std::string& filename) {
+    ChMappedFile file(filename);
+    if (!file.IsValid()) {
+        std::cout << "utils::ReadBinaryCheckpointMapped ERROR: cannot map checkpoint file " << filename << "\n";
+        return false;
+    }
+
+    return ReadBinaryCheckpoint(system, file.GetData(), file.GetSize());
+}
+
 // -----------------------------------------------------------------------------
 // Write CSV output file with current camera information
 // -----------------------------------------------------------------------------
@@ -25,6 +25,10 @@
 //      contact geometry.
 //    - only a subset of contact shapes are currently supported
 //
+// WriteBinaryCheckpoint and ReadBinaryCheckpoint
+//  these functions write and read, respectively, a binary checkpoint of the
+//  full state of an existing Chrono system (for exact restart).
+//
 // WriteVisualizationAssets
 //  this function writes a CSV file appropriate for processing with a POV-Ray
 //  script.
@@ -39,6 +43,7 @@
 #include <sstream>
 #include <fstream>
 #include <functional>
+#include <vector>
 
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChBezierCurve.h"
@@ -143,6 +148,52 @@ ChApi bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 /// Read a CSV file with a checkpoint.
 ChApi void ReadCheckpoint(ChSystem* system, const std::string& filename);
 
+/// Write a binary checkpoint of the full state of the given system into a contiguous memory buffer.
+/// The checkpoint includes the simulation time and step count, the state vectors (positions, velocities, and
+/// accelerations) of all physics items, the quaternion derivatives of all bodies (which cannot be recovered exactly
+/// from the angular velocities), the last computed reactions of all links, and the reactions of the current NSC
+/// contacts (used to warm start the next step). Unlike WriteCheckpoint, the model itself is not stored: the
+/// checkpoint can only be restored (see ReadBinaryCheckpoint) into a system with the same items, added in the same
+/// order. The checkpoint also contains per-item metadata (type, number of coordinates and constraints, and state
+/// offsets) used to validate this.
+/// Notes:
+/// - the data is stored in native binary format (no conversion of endianness or floating point format);
+/// - the internal state of physics items not captured by the state vectors (e.g., sleeping flags, user forces, motor
+///   functions) is not included;
+/// - the internal data of finite elements which is updated during a step is not included (e.g., the EAS parameters of
+///   ChElementShellANCF_3423, which are used as initial guess in the next internal force evaluation);
+/// - the internal data of timesteppers and solvers is not included, other than what they obtain from the system
+///   state, accelerations and reactions at the beginning of a step; in particular, the internal step size of HHT with
+///   step size control and a Newton matrix reused across steps (see ChImplicitIterativeTimestepper::SetJacobianReuse)
+///   are not stored;
+/// - warm start reactions are only stored for contacts between shapes of bodies in the system.
+ChApi void WriteBinaryCheckpoint(ChSystem* system, std::vector<char>& buffer);
+
+/// Write a binary checkpoint of the full state of the given system to the specified file.
+/// The checkpoint is assembled in memory and written to file with a single operation.
+/// See WriteBinaryCheckpoint(ChSystem*, std::vector<char>&) for details.
+ChApi bool WriteBinaryCheckpoint(ChSystem* system, const std::string& filename);
+
+/// Restore the state of the given system from a binary checkpoint stored in a memory buffer.
+/// The system must contain the same physics items as the system used to create the checkpoint. If this is not the
+/// case, or if the checkpoint data is invalid, the system is not modified and the function returns false.
+/// When restoring with a deterministic collision system and solver, and with a timestepper which carries no history
+/// other than the system state, accelerations and reactions (Euler implicit variants, and HHT or Newmark with a fixed
+/// step size and without reuse of the Newton matrix across steps), and with finite elements which carry no internal
+/// data updated during a step, a resumed simulation continues exactly as the simulation from which the checkpoint was
+/// taken. With other timesteppers, the resumed simulation is a restart from
+/// the same state.
+ChApi bool ReadBinaryCheckpoint(ChSystem* system, const char* buffer, size_t size);
+
+/// Restore the state of the given system from a binary checkpoint file.
+/// The entire file is read with a single operation. See ReadBinaryCheckpoint(ChSystem*, const char*, size_t).
+ChApi bool ReadBinaryCheckpoint(ChSystem* system, const std::string& filename);
+
+/// Restore the state of the given system from a memory-mapped binary checkpoint file.
+/// Unlike ReadBinaryCheckpoint(ChSystem*, const std::string&), the checkpoint data is not copied into memory first.
+/// See ReadBinaryCheckpoint(ChSystem*, const char*, size_t).
+ChApi bool ReadBinaryCheckpointMapped(ChSystem* system, const std::string& filename);
+
 /// Write CSV output file with camera information for off-line visualization.
 /// The output file includes three vectors, one per line, for camera position, camera target (look-at point), and camera
 /// up vector, respectively.
@@ -30,6 +30,8 @@ ChCollisionSystemDistributed::ChCollisionSystemDistributed(ChMulticoreDataManage
     this->ddm = ddm;
     // TODO replace
     this->ddm->local_free_shapes = NULL;
+    // Shapes are recycled in place, which is not supported for mesh shapes
+    EnableMeshBVH(false);
 }
 
 ChCollisionSystemDistributed::~ChCollisionSystemDistributed() {}
@@ -36,7 +36,7 @@
 using namespace chrono;
 using namespace collision;
 
-ChCommDistributed::ChCommDistributed(ChSystemDistributed* my_sys) {
+ChCommDistributed::ChCommDistributed(ChSystemDistributed* my_sys) : posted(false) {
     this->my_sys = my_sys;
     this->data_manager = my_sys->data_manager;
 
@@ -268,21 +268,39 @@ void ChCommDistributed::ProcessShapes(int num_recv, Shape* buf) {
 
 // Handle all necessary communication
 void ChCommDistributed::Exchange() {
+    PostExchange();
+    CompleteExchange();
+}
+
+// Pack all outgoing messages and post them as non-blocking sends
+void ChCommDistributed::PostExchange(const std::vector<uint>* candidates) {
     int my_rank = my_sys->my_rank;
     int num_ranks = my_sys->num_ranks;
     std::forward_list<int> exchanges_up;
     std::forward_list<int> exchanges_down;
 
+    if (posted)
+        my_sys->ErrorAbort("PostExchange called before completing the previous exchange\n");
+
+    timer_pack.reset();
+    timer_wait.reset();
+    timer_process.reset();
+    timer_overlap.reset();
+    timer_pack.start();
+
     // Saves a reference copy for consistency in the threads.
     ddm->curr_status = ddm->comm_status;
-    std::vector<BodyExchange> exchange_up_buf;
-    std::vector<BodyExchange> exchange_down_buf;
-    std::vector<BodyUpdate> update_up_buf;
-    std::vector<BodyUpdate> update_down_buf;
-    std::vector<Shape> shapes_up;
-    std::vector<Shape> shapes_down;
-    std::vector<uint> update_take_up;
-    std::vector<uint> update_take_down;
+    exchange_up_buf.clear();
+    exchange_down_buf.clear();
+    update_up_buf.clear();
+    update_down_buf.clear();
+    shapes_up.clear();
+    shapes_down.clear();
+    update_take_up.clear();
+    update_take_down.clear();
+
+    // Bodies to scan
+    uint num_candidates = candidates ? (uint)candidates->size() : data_manager->num_rigid_bodies;
 
     // Send Counts
     int num_exchange_up = 0;
@@ -299,7 +317,8 @@ void ChCommDistributed::Exchange() {
 // Exchange Loop
 #pragma omp section
         {
-            for (uint i = 0; i < data_manager->num_rigid_bodies; i++) {
+            for (uint k = 0; k < num_candidates; k++) {
+                uint i = candidates ? (*candidates)[k] : k;
                 // Skip empty bodies or those that this rank isn't responsible for
                 int curr_status = ddm->curr_status[i];
                 if (curr_status != distributed::OWNED)
@@ -339,7 +358,8 @@ void ChCommDistributed::Exchange() {
 #pragma omp section
         {
             // PACKING and UPDATING comm_status of existing bodies
-            for (uint i = 0; i < data_manager->num_rigid_bodies; i++) {
+            for (uint k = 0; k < num_candidates; k++) {
+                uint i = candidates ? (*candidates)[k] : k;
                 // Skip empty bodies or those that this rank isn't responsible for
                 int curr_status = ddm->curr_status[i];
                 int location = my_sys->domain->GetBodyRegion(i);
@@ -413,7 +433,8 @@ void ChCommDistributed::Exchange() {
 #pragma omp section
         {
             // PACKING and UPDATING comm_status of existing bodies
-            for (uint i = 0; i < data_manager->num_rigid_bodies; i++) {
+            for (uint k = 0; k < num_candidates; k++) {
+                uint i = candidates ? (*candidates)[k] : k;
                 // Skip empty bodies or those that this rank isn't responsible for
                 int curr_status = ddm->curr_status[i];
                 if (curr_status != distributed::SHARED_DOWN && curr_status != distributed::SHARED_UP)
@@ -442,182 +463,10 @@ void ChCommDistributed::Exchange() {
         }      // End of update take loop
     }          // End of parallel sections
 
-    // MPI_Status status_exchange_up;
-    // MPI_Status status_exchange_down;
-    // MPI_Status status_update_up;
-    // MPI_Status status_update_down;
-    // MPI_Status status_take_up;
-    // MPI_Status status_take_down;
-    // MPI_Status status_shapes_up;
-    // MPI_Status status_shapes_down;
-
-    MPI_Request rq_exchange_up;
-    MPI_Request rq_exchange_down;
-    MPI_Request rq_update_up;
-    MPI_Request rq_update_down;
-    MPI_Request rq_take_up;
-    MPI_Request rq_take_down;
-    MPI_Request rq_shapes_up;
-    MPI_Request rq_shapes_down;
-
-    MPI_Status recv_status_exchange_up;
-    MPI_Status recv_status_exchange_down;
-    MPI_Status recv_status_update_up;
-    MPI_Status recv_status_update_down;
-    MPI_Status recv_status_take_up;
-    MPI_Status recv_status_take_down;
-    MPI_Status recv_status_shapes_up;
-    MPI_Status recv_status_shapes_down;
-
-    int num_recv_exchange_up;
-    int num_recv_exchange_down;
-    int num_recv_update_up;
-    int num_recv_update_down;
-    int num_recv_take_up;
-    int num_recv_take_down;
-    int num_recv_shapes_up = 0;
-    int num_recv_shapes_down = 0;
-
-    BodyExchange* recv_exchange_down = NULL;
-    BodyExchange* recv_exchange_up = NULL;
-    BodyUpdate* recv_update_down = NULL;
-    BodyUpdate* recv_update_up = NULL;
-    uint* recv_take_down = NULL;
-    uint* recv_take_up = NULL;
-    Shape* recv_shapes_down = NULL;
-    Shape* recv_shapes_up = NULL;
-
+    // Shapes only depend on the bodies packed for exchange on this rank, so they can be sent
+    // together with all other messages (the receiver processes them last).
 #pragma omp parallel sections
     {
-// Send/Recv
-#pragma omp section
-        {
-            // SENDING - TODO sequential for now
-
-            // Send empty message if there is nothing to send
-            if (num_exchange_up == 0) {
-                BodyExchange b_e = {};
-                b_e.gid = UINT_MAX;
-                exchange_up_buf.push_back(b_e);
-                num_exchange_up = 1;
-            }
-            if (num_exchange_down == 0) {
-                BodyExchange b_e = {};
-                b_e.gid = UINT_MAX;
-                exchange_down_buf.push_back(b_e);
-                num_exchange_down = 1;
-            }
-            if (num_update_up == 0) {
-                BodyUpdate b_u = {};
-                b_u.gid = UINT_MAX;
-                update_up_buf.push_back(b_u);
-                num_update_up = 1;
-            }
-            if (num_update_down == 0) {
-                BodyUpdate b_u = {};
-                b_u.gid = UINT_MAX;
-                update_down_buf.push_back(b_u);
-                num_update_down = 1;
-            }
-            if (num_take_up == 0) {
-                update_take_up.push_back(UINT_MAX);
-                num_take_up = 1;
-            }
-            if (num_take_down == 0) {
-                update_take_down.push_back(UINT_MAX);
-                num_take_down = 1;
-            }
-
-            // Send Exchanges
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(exchange_up_buf[0]), num_exchange_up, BodyExchangeType, my_rank + 1, 1, my_sys->world,
-                          &rq_exchange_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(exchange_down_buf[0]), num_exchange_down, BodyExchangeType, my_rank - 1, 2, my_sys->world,
-                          &rq_exchange_down);
-            }
-
-            // Recv Exchanges
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 1, my_sys->world, &recv_status_exchange_down);
-                MPI_Get_count(&recv_status_exchange_down, BodyExchangeType, &num_recv_exchange_down);
-                recv_exchange_down = new BodyExchange[num_recv_exchange_down];
-                MPI_Recv(recv_exchange_down, num_recv_exchange_down, BodyExchangeType, my_rank - 1, 1, my_sys->world,
-                         &recv_status_exchange_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 2, my_sys->world, &recv_status_exchange_up);
-                MPI_Get_count(&recv_status_exchange_up, BodyExchangeType, &num_recv_exchange_up);
-                recv_exchange_up = new BodyExchange[num_recv_exchange_up];
-                MPI_Recv(recv_exchange_up, num_recv_exchange_up, BodyExchangeType, my_rank + 1, 2, my_sys->world,
-                         &recv_status_exchange_up);
-            }
-
-            // Send Updates
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_up_buf[0]), num_update_up, BodyUpdateType, my_rank + 1, 3, my_sys->world,
-                          &rq_update_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(update_down_buf[0]), num_update_down, BodyUpdateType, my_rank - 1, 4, my_sys->world,
-                          &rq_update_down);
-            }
-
-            // Recv Updates
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 3, my_sys->world, &recv_status_update_down);
-                MPI_Get_count(&recv_status_update_down, BodyUpdateType, &num_recv_update_down);
-                recv_update_down = new BodyUpdate[num_recv_update_down];
-                MPI_Recv(recv_update_down, num_recv_update_down, BodyUpdateType, my_rank - 1, 3, my_sys->world,
-                         &recv_status_update_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 4, my_sys->world, &recv_status_update_up);
-                MPI_Get_count(&recv_status_update_up, BodyUpdateType, &num_recv_update_up);
-                recv_update_up = new BodyUpdate[num_recv_update_up];
-                MPI_Recv(recv_update_up, num_recv_update_up, BodyUpdateType, my_rank + 1, 4, my_sys->world,
-                         &recv_status_update_up);
-            }
-
-            // Send Takes
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_take_up[0]), num_take_up, MPI_UNSIGNED, my_rank + 1, 5, my_sys->world, &rq_take_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(update_take_down[0]), num_take_down, MPI_UNSIGNED, my_rank - 1, 6, my_sys->world,
-                          &rq_take_down);
-            }
-
-            // Recv Takes
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 5, my_sys->world, &recv_status_take_down);
-                MPI_Get_count(&recv_status_take_down, MPI_UNSIGNED, &num_recv_take_down);
-                recv_take_down = new uint[num_recv_take_down];
-                MPI_Recv(recv_take_down, num_recv_take_down, MPI_UNSIGNED, my_rank - 1, 5, my_sys->world,
-                         &recv_status_take_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 6, my_sys->world, &recv_status_take_up);
-                MPI_Get_count(&recv_status_take_up, MPI_UNSIGNED, &num_recv_take_up);
-                recv_take_up = new uint[num_recv_take_up];
-                MPI_Recv(recv_take_up, num_recv_take_up, MPI_UNSIGNED, my_rank + 1, 6, my_sys->world,
-                         &recv_status_take_up);
-            }
-
-            // Make sure all non-blocking communications are done.
-            if (my_rank != num_ranks - 1) {
-                MPI_Wait(&rq_exchange_up, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_update_up, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_take_up, MPI_STATUS_IGNORE);
-            }
-            if (my_rank != 0) {
-                MPI_Wait(&rq_exchange_down, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_update_down, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_take_down, MPI_STATUS_IGNORE);
-            }
-        }  // End of send/recv section
-
 // TODO could do in parallel if counting the spaces in the buffers in the first pass
 // Pack Shapes Up
 #pragma omp section
@@ -625,13 +474,6 @@ void ChCommDistributed::Exchange() {
             for (auto itr_up = exchanges_up.begin(); itr_up != exchanges_up.end(); itr_up++) {
                 num_shapes_up += PackShapes(&shapes_up, *itr_up);
             }
-
-            if (num_shapes_up == 0) {
-                Shape shape;
-                shape.gid = UINT_MAX;
-                shapes_up.push_back(shape);
-                num_shapes_up = 1;
-            }
         }  // End of pack shapes up section
 
 // Pack Shapes Down
@@ -640,78 +482,161 @@ void ChCommDistributed::Exchange() {
             for (auto itr_down = exchanges_down.begin(); itr_down != exchanges_down.end(); itr_down++) {
                 num_shapes_down += PackShapes(&shapes_down, *itr_down);
             }
-            if (num_shapes_down == 0) {
-                Shape shape;
-                shape.gid = UINT_MAX;
-                shapes_down.push_back(shape);
-                num_shapes_down = 1;
-            }
         }  // End of pack shapes down section
     }      // End of parallel sections
 
-    // TODO sections?
-    if (my_rank != 0)
-        ProcessExchanges(num_recv_exchange_down, recv_exchange_down, 0);
-    if (my_rank != num_ranks - 1)
-        ProcessExchanges(num_recv_exchange_up, recv_exchange_up, 1);
-
-    if (my_rank != 0)
-        ProcessUpdates(num_recv_update_down, recv_update_down);
-    if (my_rank != num_ranks - 1)
-        ProcessUpdates(num_recv_update_up, recv_update_up);
+    // Send empty message if there is nothing to send
+    if (num_exchange_up == 0) {
+        BodyExchange b_e = {};
+        b_e.gid = UINT_MAX;
+        exchange_up_buf.push_back(b_e);
+    }
+    if (num_exchange_down == 0) {
+        BodyExchange b_e = {};
+        b_e.gid = UINT_MAX;
+        exchange_down_buf.push_back(b_e);
+    }
+    if (num_update_up == 0) {
+        BodyUpdate b_u = {};
+        b_u.gid = UINT_MAX;
+        update_up_buf.push_back(b_u);
+    }
+    if (num_update_down == 0) {
+        BodyUpdate b_u = {};
+        b_u.gid = UINT_MAX;
+        update_down_buf.push_back(b_u);
+    }
+    if (num_take_up == 0) {
+        update_take_up.push_back(UINT_MAX);
+    }
+    if (num_take_down == 0) {
+        update_take_down.push_back(UINT_MAX);
+    }
+    if (num_shapes_up == 0) {
+        Shape shape;
+        shape.gid = UINT_MAX;
+        shapes_up.push_back(shape);
+    }
+    if (num_shapes_down == 0) {
+        Shape shape;
+        shape.gid = UINT_MAX;
+        shapes_down.push_back(shape);
+    }
 
-    if (my_rank != 0)
-        ProcessTakes(num_recv_take_down, recv_take_down);
-    if (my_rank != num_ranks - 1)
-        ProcessTakes(num_recv_take_up, recv_take_up);
+    timer_pack.stop();
 
-    // Send Shapes
+    // Post all sends. Messages of each kind use their own tag; since MPI guarantees that messages
+    // between two ranks with the same tag are not overtaken, no synchronization between steps is needed.
+    send_requests.clear();
+    MPI_Request rq;
     if (my_rank != num_ranks - 1) {
-        MPI_Isend(&(shapes_up[0]), num_shapes_up, ShapeType, my_rank + 1, 7, my_sys->world, &rq_shapes_up);
+        MPI_Isend(exchange_up_buf.data(), (int)exchange_up_buf.size(), BodyExchangeType, my_rank + 1, 1,
+                  my_sys->world, &rq);
+        send_requests.push_back(rq);
+        MPI_Isend(update_up_buf.data(), (int)update_up_buf.size(), BodyUpdateType, my_rank + 1, 3, my_sys->world,
+                  &rq);
+        send_requests.push_back(rq);
+        MPI_Isend(update_take_up.data(), (int)update_take_up.size(), MPI_UNSIGNED, my_rank + 1, 5, my_sys->world,
+                  &rq);
+        send_requests.push_back(rq);
+        MPI_Isend(shapes_up.data(), (int)shapes_up.size(), ShapeType, my_rank + 1, 7, my_sys->world, &rq);
+        send_requests.push_back(rq);
     }
     if (my_rank != 0) {
-        MPI_Isend(&(shapes_down[0]), num_shapes_down, ShapeType, my_rank - 1, 8, my_sys->world, &rq_shapes_down);
+        MPI_Isend(exchange_down_buf.data(), (int)exchange_down_buf.size(), BodyExchangeType, my_rank - 1, 2,
+                  my_sys->world, &rq);
+        send_requests.push_back(rq);
+        MPI_Isend(update_down_buf.data(), (int)update_down_buf.size(), BodyUpdateType, my_rank - 1, 4,
+                  my_sys->world, &rq);
+        send_requests.push_back(rq);
+        MPI_Isend(update_take_down.data(), (int)update_take_down.size(), MPI_UNSIGNED, my_rank - 1, 6,
+                  my_sys->world, &rq);
+        send_requests.push_back(rq);
+        MPI_Isend(shapes_down.data(), (int)shapes_down.size(), ShapeType, my_rank - 1, 8, my_sys->world, &rq);
+        send_requests.push_back(rq);
     }
 
-    // Recv Shapes
+    posted = true;
+    timer_overlap.start();
+}
+
+template <typename T>
+std::vector<T> ChCommDistributed::Receive(int source, int tag, MPI_Datatype type) {
+    MPI_Status status;
+    int count;
+    MPI_Probe(source, tag, my_sys->world, &status);
+    MPI_Get_count(&status, type, &count);
+    std::vector<T> buf(count);
+    MPI_Recv(buf.data(), count, type, source, tag, my_sys->world, &status);
+    return buf;
+}
+
+// Receive and process all incoming messages
+void ChCommDistributed::CompleteExchange() {
+    int my_rank = my_sys->my_rank;
+    int num_ranks = my_sys->num_ranks;
+
+    if (!posted)
+        my_sys->ErrorAbort("CompleteExchange called without a posted exchange\n");
+
+    timer_overlap.stop();
+
+    std::vector<BodyExchange> recv_exchange_down;
+    std::vector<BodyExchange> recv_exchange_up;
+    std::vector<BodyUpdate> recv_update_down;
+    std::vector<BodyUpdate> recv_update_up;
+    std::vector<uint> recv_take_down;
+    std::vector<uint> recv_take_up;
+    std::vector<Shape> recv_shapes_down;
+    std::vector<Shape> recv_shapes_up;
+
+    // Recv all messages, in the order in which they must be processed
+    timer_wait.start();
     if (my_rank != 0) {
-        MPI_Probe(my_rank - 1, 7, my_sys->world, &recv_status_shapes_down);
-        MPI_Get_count(&recv_status_shapes_down, ShapeType, &num_recv_shapes_down);
-        recv_shapes_down = new Shape[num_recv_shapes_down];
-        MPI_Recv(recv_shapes_down, num_recv_shapes_down, ShapeType, my_rank - 1, 7, my_sys->world,
-                 &recv_status_shapes_down);
+        recv_exchange_down = Receive<BodyExchange>(my_rank - 1, 1, BodyExchangeType);
+        recv_update_down = Receive<BodyUpdate>(my_rank - 1, 3, BodyUpdateType);
+        recv_take_down = Receive<uint>(my_rank - 1, 5, MPI_UNSIGNED);
+        recv_shapes_down = Receive<Shape>(my_rank - 1, 7, ShapeType);
     }
     if (my_rank != num_ranks - 1) {
-        MPI_Probe(my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
-        MPI_Get_count(&recv_status_shapes_up, ShapeType, &num_recv_shapes_up);
-        ////GetLog() << "num_recv_shapes_up" << num_recv_shapes_up << "\n";
-        recv_shapes_up = new Shape[num_recv_shapes_up];
-        MPI_Recv(recv_shapes_up, num_recv_shapes_up, ShapeType, my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
+        recv_exchange_up = Receive<BodyExchange>(my_rank + 1, 2, BodyExchangeType);
+        recv_update_up = Receive<BodyUpdate>(my_rank + 1, 4, BodyUpdateType);
+        recv_take_up = Receive<uint>(my_rank + 1, 6, MPI_UNSIGNED);
+        recv_shapes_up = Receive<Shape>(my_rank + 1, 8, ShapeType);
     }
+    timer_wait.stop();
+
+    timer_process.start();
 
+    // TODO sections?
     if (my_rank != 0)
-        ProcessShapes(num_recv_shapes_down, recv_shapes_down);
+        ProcessExchanges((int)recv_exchange_down.size(), recv_exchange_down.data(), 0);
     if (my_rank != num_ranks - 1)
-        ProcessShapes(num_recv_shapes_up, recv_shapes_up);
+        ProcessExchanges((int)recv_exchange_up.size(), recv_exchange_up.data(), 1);
 
-    if (my_rank != num_ranks - 1) {
-        MPI_Wait(&rq_shapes_up, MPI_STATUS_IGNORE);
-    }
-    if (my_rank != 0) {
-        MPI_Wait(&rq_shapes_down, MPI_STATUS_IGNORE);
-    }
+    if (my_rank != 0)
+        ProcessUpdates((int)recv_update_down.size(), recv_update_down.data());
+    if (my_rank != num_ranks - 1)
+        ProcessUpdates((int)recv_update_up.size(), recv_update_up.data());
+
+    if (my_rank != 0)
+        ProcessTakes((int)recv_take_down.size(), recv_take_down.data());
+    if (my_rank != num_ranks - 1)
+        ProcessTakes((int)recv_take_up.size(), recv_take_up.data());
+
+    if (my_rank != 0)
+        ProcessShapes((int)recv_shapes_down.size(), recv_shapes_down.data());
+    if (my_rank != num_ranks - 1)
+        ProcessShapes((int)recv_shapes_up.size(), recv_shapes_up.data());
+
+    timer_process.stop();
+
+    // Make sure all non-blocking communications are done before the send buffers are reused.
+    timer_wait.start();
+    MPI_Waitall((int)send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
+    timer_wait.stop();
 
-    // Free all dynamic memory used for recving
-    delete[] recv_exchange_down;
-    delete[] recv_exchange_up;
-    delete[] recv_update_down;
-    delete[] recv_update_up;
-    delete[] recv_take_down;
-    delete[] recv_take_up;
-    delete[] recv_shapes_down;
-    delete[] recv_shapes_up;
-
-    MPI_Barrier(my_sys->world);
+    posted = false;
 }
 
 void ChCommDistributed::PackExchange(BodyExchange* buf, int index) {
@@ -15,7 +15,9 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
+#include "chrono/core/ChTimer.h"
 #include "chrono/physics/ChBody.h"
 
 #include "chrono_multicore/ChDataManager.h"
@@ -113,8 +115,35 @@ class CH_DISTR_API ChCommDistributed {
     ///	- need to update their comm_status
     /// Sends updates via mpi to the appropriate rank
     /// Processes incoming updates from other ranks
+    /// Equivalent to PostExchange() followed by CompleteExchange().
     void Exchange();
 
+    /// First half of the exchange: scans the system's data structures, packs all outgoing
+    /// messages and posts them as non-blocking sends to the neighboring ranks.
+    /// If a list of body indices is provided, only those bodies are scanned; all other bodies
+    /// must be OWNED and remain in the owned region of this rank.
+    /// Must be followed by a call to CompleteExchange() before the next exchange.
+    void PostExchange(const std::vector<uint>* candidates = nullptr);
+
+    /// Second half of the exchange: receives and processes the incoming messages from the
+    /// neighboring ranks and waits for completion of the sends posted by PostExchange().
+    /// Work done between the two calls overlaps with the communication.
+    void CompleteExchange();
+
+    /// Return the time (in seconds) spent in packing outgoing messages during the last exchange.
+    double GetTimerPack() const { return timer_pack(); }
+
+    /// Return the time (in seconds) this rank was idle, waiting for messages or for the completion
+    /// of its sends, during the last exchange.
+    double GetTimerWait() const { return timer_wait(); }
+
+    /// Return the time (in seconds) spent in processing incoming messages during the last exchange.
+    double GetTimerProcess() const { return timer_process(); }
+
+    /// Return the time (in seconds) between posting the sends and starting to receive, during the last
+    /// exchange (i.e., the computation overlapped with communication).
+    double GetTimerOverlap() const { return timer_overlap(); }
+
   protected:
     ChSystemDistributed* my_sys;
 
@@ -130,6 +159,28 @@ class CH_DISTR_API ChCommDistributed {
     ChDistributedDataManager* ddm;
 
   private:
+    /// Outgoing messages, kept alive until the non-blocking sends complete
+    std::vector<BodyExchange> exchange_up_buf;
+    std::vector<BodyExchange> exchange_down_buf;
+    std::vector<BodyUpdate> update_up_buf;
+    std::vector<BodyUpdate> update_down_buf;
+    std::vector<uint> update_take_up;
+    std::vector<uint> update_take_down;
+    std::vector<Shape> shapes_up;
+    std::vector<Shape> shapes_down;
+
+    std::vector<MPI_Request> send_requests;  ///< requests for the posted sends
+    bool posted;                             ///< true between PostExchange and CompleteExchange
+
+    ChTimer<double> timer_pack;     ///< packing of outgoing messages
+    ChTimer<double> timer_wait;     ///< waiting for incoming messages and completion of sends
+    ChTimer<double> timer_process;  ///< processing of incoming messages
+    ChTimer<double> timer_overlap;  ///< computation between posting the sends and receiving
+
+    /// Receive a message of unknown length from the given rank (blocking).
+    template <typename T>
+    std::vector<T> Receive(int source, int tag, MPI_Datatype type);
+
     /// Helper function for processing incoming exchange messages.
     void ProcessExchanges(int num_recv, BodyExchange* buf, int updown);
 
@@ -159,6 +159,10 @@ distributed::COMM_STATUS ChDomainDistributed::GetBodyRegion(std::shared_ptr<ChBo
     return GetRegion(body->GetPos()[split_axis]);
 }
 
+distributed::COMM_STATUS ChDomainDistributed::GetPointRegion(const ChVector<>& pos) const {
+    return GetRegion(pos[split_axis]);
+}
+
 void ChDomainDistributed::PrintDomain() {
     GetLog() << "Domain:\n"
                 "Box:\n"
@@ -121,6 +121,10 @@ class CH_DISTR_API ChDomainDistributed {
     /// Returns the location of the specified body within this rank based on the body-list
     virtual distributed::COMM_STATUS GetBodyRegion(std::shared_ptr<ChBody> body) const;
 
+    /// Returns the location within this rank of a body with center at the given position.
+    /// Must be consistent with GetBodyRegion (used to classify bodies before they are advanced).
+    virtual distributed::COMM_STATUS GetPointRegion(const ChVector<>& pos) const;
+
     /// Get the lower bounds of the global simulation domain
     const ChVector<double>& GetBoxLo() const { return boxlo; }
     /// Get the upper bounds of the global simulation domain
@@ -53,7 +53,7 @@ static void PrintNode(LocalShapeNode* node) {
 }
 
 ChSystemDistributed::ChSystemDistributed(MPI_Comm communicator, double ghostlayer, unsigned int maxobjects)
-    : ghost_layer(ghostlayer), master_rank(0), num_bodies_global(0) {
+    : ghost_layer(ghostlayer), master_rank(0), num_bodies_global(0), overlap_exchange(true) {
     MPI_Comm_dup(communicator, &world);
     MPI_Comm_size(world, &num_ranks);
     MPI_Comm_rank(world, &my_rank);
@@ -124,10 +124,25 @@ bool ChSystemDistributed::Integrate_Y() {
     assert(domain->IsSplit());
     ddm->initial_add = false;
 
+    // With overlapping, the outgoing messages are posted while advancing the bodies (see IntegrateRigidBodies)
     bool ret = ChSystemMulticoreSMC::Integrate_Y();
     if (num_ranks != 1) {
         data_manager->system_timer.start("Exchange");
-        comm->Exchange();
+        if (!overlap_exchange) {
+            comm->Exchange();
+        } else {
+            comm->CompleteExchange();
+
+            // Should an interior body have left the owned region during integration, exchange it now.
+            // All ranks must take part in this additional exchange.
+            int local_misclassified = misclassified_bodies.empty() ? 0 : 1;
+            int any_misclassified = 0;
+            MPI_Allreduce(&local_misclassified, &any_misclassified, 1, MPI_INT, MPI_LOR, world);
+            if (any_misclassified) {
+                comm->PostExchange(&misclassified_bodies);
+                comm->CompleteExchange();
+            }
+        }
         data_manager->system_timer.stop("Exchange");
     }
 #ifdef DistrProfile
@@ -145,6 +160,69 @@ void ChSystemDistributed::UpdateRigidBodies() {
     }
 }
 
+void ChSystemDistributed::IntegrateRigidBodies() {
+    if (num_ranks == 1 || !overlap_exchange) {
+        ChSystemMulticore::IntegrateRigidBodies();
+        return;
+    }
+
+    // Classify bodies based on their position at the end of the step (see ChBody::VariablesQbIncrementPosition).
+    // An owned body is interior if it remains in the owned region. The test is made on a small interval
+    // around the predicted position, so that round-off cannot move an interior body out of the owned region.
+    const auto& velocities = data_manager->host_data.v;
+    double step = GetStep();
+    boundary_bodies.clear();
+    interior_bodies.clear();
+    for (uint i = 0; i < data_manager->num_rigid_bodies; i++) {
+        if (ddm->comm_status[i] == distributed::OWNED) {
+            ChVector<> pos = assembly.bodylist[i]->GetPos();
+            if (data_manager->host_data.active_rigid[i] != 0)
+                pos += ChVector<>(velocities[i * 6 + 0], velocities[i * 6 + 1], velocities[i * 6 + 2]) * step;
+            ChVector<> tol(1e-9 * (1 + pos.Length()));
+            if (domain->GetPointRegion(pos - tol) == distributed::OWNED &&
+                domain->GetPointRegion(pos + tol) == distributed::OWNED) {
+                interior_bodies.push_back(i);
+                continue;
+            }
+        }
+        boundary_bodies.push_back(i);
+    }
+
+    // Advance the bodies involved in communication and post the outgoing messages
+#pragma omp parallel for
+    for (size_t k = 0; k < boundary_bodies.size(); k++) {
+        IntegrateRigidBody(boundary_bodies[k]);
+    }
+    data_manager->system_timer.start("Exchange");
+    comm->PostExchange(&boundary_bodies);
+    data_manager->system_timer.stop("Exchange");
+
+    // Advance the interior bodies while the messages are in flight
+#pragma omp parallel for
+    for (size_t k = 0; k < interior_bodies.size(); k++) {
+        IntegrateRigidBody(interior_bodies[k]);
+    }
+
+    // Check the classification against the actual positions (see Integrate_Y)
+    misclassified_bodies.clear();
+    for (auto i : interior_bodies) {
+        if (domain->GetBodyRegion(i) != distributed::OWNED)
+            misclassified_bodies.push_back(i);
+    }
+}
+
+double ChSystemDistributed::GetTimerExchange() const {
+    return data_manager->system_timer.GetTime("Exchange");
+}
+
+double ChSystemDistributed::GetTimerExchangeWait() const {
+    return comm->GetTimerWait();
+}
+
+double ChSystemDistributed::GetTimerExchangeOverlap() const {
+    return comm->GetTimerOverlap();
+}
+
 ChBody* ChSystemDistributed::NewBody() {
     return new ChBody(chrono_types::make_shared<collision::ChCollisionModelDistributed>());
 }
@@ -19,6 +19,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "chrono/physics/ChBody.h"
 
@@ -106,6 +107,13 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemMulticoreSMC {
     /// that the correct body is found and removed where it exists.
     virtual void RemoveBody(std::shared_ptr<ChBody> body) override;
 
+    /// Enable or disable overlapping of inter-rank communication with computation (default: true).
+    /// If disabled, all bodies are advanced before a blocking exchange at the end of the step.
+    void SetOverlapExchange(bool val) { overlap_exchange = val; }
+
+    /// Return true if inter-rank communication is overlapped with computation.
+    bool GetOverlapExchange() const { return overlap_exchange; }
+
     /// Wraps the super-class Integrate_Y call and introduces a call that carries
     /// out all inter-rank communication.
     virtual bool Integrate_Y() override;
@@ -113,6 +121,18 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemMulticoreSMC {
     /// Wraps super-class UpdateRigidBodies and adds a gid update.
     virtual void UpdateRigidBodies() override;
 
+    /// Return the time (in seconds) spent in inter-rank communication during the last step.
+    /// This includes packing and processing of messages, as well as the time spent waiting for them.
+    double GetTimerExchange() const;
+
+    /// Return the time (in seconds) this rank was idle, waiting for messages from the neighboring
+    /// ranks, during the last step.
+    double GetTimerExchangeWait() const;
+
+    /// Return the time (in seconds) of computation overlapped with inter-rank communication during the
+    /// last step (advancing the interior bodies and finalizing the step).
+    double GetTimerExchangeOverlap() const;
+
     /// Internal call for removing deactivating a body.
     /// Should not be called by the user.
     void RemoveBodyExchange(int index);
@@ -233,6 +253,9 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemMulticoreSMC {
     /// Communicator of MPI ranks for the simulation
     MPI_Comm world;
 
+    /// Overlap inter-rank communication with the integration of interior bodies
+    bool overlap_exchange;
+
     /// Class for domain decomposition
     ChDomainDistributed* domain;
 
@@ -243,6 +266,18 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemMulticoreSMC {
     /// called by the user.
     void AddBodyExchange(std::shared_ptr<ChBody> newbody, distributed::COMM_STATUS status);
 
+    /// Advances the bodies involved in communication first, posts the outgoing messages,
+    /// and then advances the interior bodies while the messages are in flight.
+    /// Interior bodies found outside the owned region after integration are exchanged in Integrate_Y.
+    virtual void IntegrateRigidBodies() override;
+
+    /// Indices of the bodies which may be involved in communication during the current step
+    std::vector<uint> boundary_bodies;
+    /// Indices of the owned bodies which remain in the owned region during the current step
+    std::vector<uint> interior_bodies;
+    /// Indices of the interior bodies which nevertheless left the owned region during the current step
+    std::vector<uint> misclassified_bodies;
+
     /// Type for internally sending contact forces
     MPI_Datatype InternalForceType;
 
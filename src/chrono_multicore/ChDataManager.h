@@ -191,9 +191,6 @@ typedef blaze::Subvector<const DynamicVector<real>> ConstSubVectorType;
 //// Viscosity
 //#define _GAMMAFFV_ submatrix(_gamma_,  _num_uni_ + _num_bil_ + 3 * _num_rf_c_ + _num_fluid_,  3 * _num_fluid_)
 
-// The maximum number of shear history contacts per smaller body (SMC)
-#define max_shear 20
-
 /// @addtogroup multicore_module
 /// @{
 
@@ -211,11 +208,14 @@ struct host_container {
     custom_vector<real3> ct_body_force;   ///< Total contact force on bodies
     custom_vector<real3> ct_body_torque;  ///< Total contact torque on these bodies
 
-    // Contact shear history (SMC)
-    custom_vector<vec3> shear_neigh;          ///< Neighbor list of contacting bodies and shapes
-    custom_vector<real3> shear_disp;          ///< Accumulated shear displacement for each neighbor
-    custom_vector<real> contact_relvel_init;  ///< Initial relative normal velocity manitude per contact pair
-    custom_vector<real> contact_duration;     ///< Accumulated contact duration, per contact pair
+    // Contact shear history (SMC, multi-step tangential displacement model)
+    // Open-addressing hash table (with linear probing) of the contacts that persisted at the end of the previous step,
+    // keyed by the body and shape pairs of each contact. The table is rebuilt at each step and its size is a power of
+    // 2, at least twice the number of contacts, so its memory footprint is proportional to the number of contacts.
+    custom_vector<vec4> shear_keys;           ///< Contact keys (body1, body2, shape1, shape2); x = -1 for empty slots
+    custom_vector<real3> shear_disp;          ///< Accumulated shear displacement, per contact
+    custom_vector<real> contact_relvel_init;  ///< Initial relative normal velocity manitude, per contact
+    custom_vector<real> contact_duration;     ///< Accumulated contact duration, per contact
 
     /// Mapping from all bodies in the system to bodies involved in a contact.
     /// For bodies that are currently not in contact, the mapping entry is -1.
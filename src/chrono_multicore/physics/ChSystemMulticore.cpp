@@ -165,32 +165,9 @@ bool ChSystemMulticore::Integrate_Y() {
 
     // Scatter the states to the Chrono objects (bodies and shafts) and update
     // all physics items at the end of the step.
-    DynamicVector<real>& velocities = data_manager->host_data.v;
-    custom_vector<real3>& pos_pointer = data_manager->host_data.pos_rigid;
-    custom_vector<quaternion>& rot_pointer = data_manager->host_data.rot_rigid;
+    IntegrateRigidBodies();
 
-#pragma omp parallel for
-    for (int i = 0; i < assembly.bodylist.size(); i++) {
-        if (data_manager->host_data.active_rigid[i] != 0) {
-            auto& body = assembly.bodylist[i];
-            body->Variables().Get_qb()(0) = velocities[i * 6 + 0];
-            body->Variables().Get_qb()(1) = velocities[i * 6 + 1];
-            body->Variables().Get_qb()(2) = velocities[i * 6 + 2];
-            body->Variables().Get_qb()(3) = velocities[i * 6 + 3];
-            body->Variables().Get_qb()(4) = velocities[i * 6 + 4];
-            body->Variables().Get_qb()(5) = velocities[i * 6 + 5];
-
-            body->VariablesQbIncrementPosition(this->GetStep());
-            body->VariablesQbSetSpeed(this->GetStep());
-
-            body->Update(ch_time);
-
-            // update the position and rotation vectors
-            pos_pointer[i] = (real3(body->GetPos().x(), body->GetPos().y(), body->GetPos().z()));
-            rot_pointer[i] =
-                (quaternion(body->GetRot().e0(), body->GetRot().e1(), body->GetRot().e2(), body->GetRot().e3()));
-        }
-    }
+    DynamicVector<real>& velocities = data_manager->host_data.v;
 
     uint offset = data_manager->num_rigid_bodies * 6;
     ////#pragma omp parallel for
@@ -237,6 +214,37 @@ bool ChSystemMulticore::Integrate_Y() {
     return true;
 }
 
+void ChSystemMulticore::IntegrateRigidBodies() {
+#pragma omp parallel for
+    for (int i = 0; i < assembly.bodylist.size(); i++) {
+        IntegrateRigidBody(i);
+    }
+}
+
+void ChSystemMulticore::IntegrateRigidBody(int index) {
+    if (data_manager->host_data.active_rigid[index] == 0)
+        return;
+
+    DynamicVector<real>& velocities = data_manager->host_data.v;
+    auto& body = assembly.bodylist[index];
+    body->Variables().Get_qb()(0) = velocities[index * 6 + 0];
+    body->Variables().Get_qb()(1) = velocities[index * 6 + 1];
+    body->Variables().Get_qb()(2) = velocities[index * 6 + 2];
+    body->Variables().Get_qb()(3) = velocities[index * 6 + 3];
+    body->Variables().Get_qb()(4) = velocities[index * 6 + 4];
+    body->Variables().Get_qb()(5) = velocities[index * 6 + 5];
+
+    body->VariablesQbIncrementPosition(this->GetStep());
+    body->VariablesQbSetSpeed(this->GetStep());
+
+    body->Update(ch_time);
+
+    // update the position and rotation vectors
+    data_manager->host_data.pos_rigid[index] = real3(body->GetPos().x(), body->GetPos().y(), body->GetPos().z());
+    data_manager->host_data.rot_rigid[index] =
+        quaternion(body->GetRot().e0(), body->GetRot().e1(), body->GetRot().e2(), body->GetRot().e3());
+}
+
 // Add the specified body to the system.
 // A unique identifier is assigned to each body for indexing purposes.
 // Space is allocated in system-wide vectors for data corresponding to the
@@ -188,6 +188,13 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
     int current_threads;
 
   protected:
+    /// Advance the positions and velocities of all active rigid bodies at the end of a step, using the velocities
+    /// computed by the solver. Derived classes can override this to control the order in which bodies are advanced.
+    virtual void IntegrateRigidBodies();
+
+    /// Advance the position and velocity of the rigid body with specified index (no-op if the body is not active).
+    void IntegrateRigidBody(int index);
+
     double old_timer, old_timer_cd;
     bool detect_optimal_threads;
 
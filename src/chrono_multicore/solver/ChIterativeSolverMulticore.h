@@ -116,8 +116,23 @@ class CH_MULTICORE_API ChIterativeSolverMulticoreSMC : public ChIterativeSolverM
     void host_CalcContactForces(custom_vector<int>& ct_bid,
                                 custom_vector<real3>& ct_force,
                                 custom_vector<real3>& ct_torque,
-                                custom_vector<vec2>& shape_pairs,
-                                custom_vector<char>& shear_touch);
+                                custom_vector<char>& shear_touch,
+                                custom_vector<real3>& shear_disp,
+                                custom_vector<real>& contact_relvel_init,
+                                custom_vector<real>& contact_duration);
+
+    /// Look up the contact history of all current contacts in the history table of the previous step.
+    void host_LoadContactHistory(custom_vector<vec4>& ct_keys,
+                                 custom_vector<real3>& shear_disp,
+                                 custom_vector<real>& contact_relvel_init,
+                                 custom_vector<real>& contact_duration);
+
+    /// Rebuild the contact history table from the persistent contacts of the current step.
+    void host_StoreContactHistory(const custom_vector<vec4>& ct_keys,
+                                  const custom_vector<char>& shear_touch,
+                                  const custom_vector<real3>& shear_disp,
+                                  const custom_vector<real>& contact_relvel_init,
+                                  const custom_vector<real>& contact_duration);
 
     void host_AddContactForces(uint ct_body_count, const custom_vector<int>& ct_body_id);
 
@@ -29,6 +29,8 @@
 //// case. Is there a solution?
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <stdexcept>
 
 #include "chrono/physics/ChSystemSMC.h"
@@ -53,7 +55,6 @@ using namespace chrono;
 void function_CalcContactForces(
     int index,                                            // index of this contact pair
     vec2* body_pairs,                                     // indices of the body pair in contact
-    vec2* shape_pairs,                                    // indices of the shape pair in contact
     ChSystemSMC::ContactForceModel contact_model,         // contact force model
     ChSystemSMC::AdhesionForceModel adhesion_model,       // adhesion force model
     ChSystemSMC::TangentialDisplacementModel displ_mode,  // type of tangential displacement history
@@ -77,11 +78,10 @@ void function_CalcContactForces(
     real3* normal,                                        // contact normal (per contact)
     real* depth,                                          // penetration depth (per contact)
     real* eff_radius,                                     // effective contact radius (per contact)
-    vec3* shear_neigh,                                    // neighbor list of contacting bodies and shapes (per body)
-    char* shear_touch,                                    // flag if contact in neighbor list is persistent (per body)
-    real3* shear_disp,                                    // accumulated shear displacement for each neighbor (per body)
-    real* contact_relvel_init,                            // initial relative normal velocity per contact pair
-    real* contact_duration,                               // duration of persistent contact between contact pairs
+    char* shear_touch,                                    // [output] flag if contact is persistent (per contact)
+    real3* shear_disp,                                    // accumulated shear displacement (per contact)
+    real* contact_relvel_init,                            // initial relative normal velocity (per contact, <0 if new)
+    real* contact_duration,                               // duration of persistent contact (per contact)
     int* ct_bid,                                          // [output] body IDs (two per contact)
     real3* ct_force,                                      // [output] body force (two per contact)
     real3* ct_torque                                      // [output] body torque (two per contact)
@@ -172,78 +172,44 @@ void function_CalcContactForces(
     real delta_n = -depth[index];
     real3 delta_t = real3(0);
 
-    int i;
-    int contact_id = -1;
     int shear_body1 = -1;
-    int shear_body2;
-    int shear_shape1;
-    int shear_shape2;
-    bool newcontact = true;
 
     if (displ_mode == ChSystemSMC::TangentialDisplacementModel::OneStep) {
         delta_t = relvel_t * dT;
     } else if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
         delta_t = relvel_t * dT;
 
-        // Identify the two shapes in contact (global shape IDs).
-        int s1 = shape_pairs[index].x;
-        int s2 = shape_pairs[index].y;
-
-        // Contact history information stored on the body with the smaller shape or else the body with larger index.
-        // Currently, it is assumed that the smaller shape is on the body with larger ID. We call this body shear_body1.
+        // Contact history (loaded by host_LoadContactHistory) is expressed relative to the body with larger index.
+        // We call this body shear_body1.
         shear_body1 = std::max(b1, b2);
-        shear_body2 = std::min(b1, b2);
-        shear_shape1 = std::max(s1, s2);
-        shear_shape2 = std::min(s1, s2);
-
-        // Check if contact history already exists. If not, initialize new contact history.
-        for (i = 0; i < max_shear; i++) {
-            int ctIdUnrolled = max_shear * shear_body1 + i;
-            if (shear_neigh[ctIdUnrolled].x == shear_body2 && shear_neigh[ctIdUnrolled].y == shear_shape1 &&
-                shear_neigh[ctIdUnrolled].z == shear_shape2) {
-                contact_duration[ctIdUnrolled] += dT;
-                contact_id = i;
-                newcontact = false;
-                break;
-            }
-        }
-        if (newcontact == true) {
-            for (i = 0; i < max_shear; i++) {
-                int ctIdUnrolled = max_shear * shear_body1 + i;
-                if (shear_neigh[ctIdUnrolled].x == -1) {
-                    contact_id = i;
-                    shear_neigh[ctIdUnrolled].x = shear_body2;
-                    shear_neigh[ctIdUnrolled].y = shear_shape1;
-                    shear_neigh[ctIdUnrolled].z = shear_shape2;
-                    shear_disp[ctIdUnrolled].x = 0;
-                    shear_disp[ctIdUnrolled].y = 0;
-                    shear_disp[ctIdUnrolled].z = 0;
-                    contact_relvel_init[ctIdUnrolled] = relvel_init;
-                    contact_duration[ctIdUnrolled] = 0;
-                    break;
-                }
-            }
+
+        // Initialize the contact history of a new contact, or else increment the contact duration.
+        if (contact_relvel_init[index] < 0) {
+            shear_disp[index] = real3(0);
+            contact_relvel_init[index] = relvel_init;
+            contact_duration[index] = 0;
+        } else {
+            contact_duration[index] += dT;
         }
 
         // Record that these two bodies are really in contact at this time.
-        int ctSaveId = max_shear * shear_body1 + contact_id;
-        shear_touch[ctSaveId] = true;
+        shear_touch[index] = true;
 
         // Increment stored contact history tangential (shear) displacement vector and project it onto the current
         // contact plane.
         if (shear_body1 == b1) {
-            shear_disp[ctSaveId] += delta_t;
-            shear_disp[ctSaveId] -= Dot(shear_disp[ctSaveId], normal[index]) * normal[index];
-            delta_t = shear_disp[ctSaveId];
+            shear_disp[index] += delta_t;
+            shear_disp[index] -= Dot(shear_disp[index], normal[index]) * normal[index];
+            delta_t = shear_disp[index];
         } else {
-            shear_disp[ctSaveId] -= delta_t;
-            shear_disp[ctSaveId] -= Dot(shear_disp[ctSaveId], normal[index]) * normal[index];
-            delta_t = -shear_disp[ctSaveId];
+            shear_disp[index] -= delta_t;
+            shear_disp[index] -= Dot(shear_disp[index], normal[index]) * normal[index];
+            delta_t = -shear_disp[index];
         }
 
         // Load the initial collision velocity and accumulated contact duration from the contact history.
-        relvel_init = (contact_relvel_init[ctSaveId] < char_vel) ? char_vel : contact_relvel_init[ctSaveId];
-        t_contact = contact_duration[ctSaveId];
+        relvel_init = (contact_relvel_init[index] < char_vel) ? char_vel : contact_relvel_init[index];
+        t_contact = contact_duration[index];
     }
 
     auto eps = std::numeric_limits<double>::epsilon();
@@ -458,9 +424,9 @@ void function_CalcContactForces(
             if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
                 delta_t = (forceT - forceT_damp) / kt;
                 if (shear_body1 == b1) {
-                    shear_disp[max_shear * shear_body1 + contact_id] = delta_t;
+                    shear_disp[index] = delta_t;
                 } else {
-                    shear_disp[max_shear * shear_body1 + contact_id] = -delta_t;
+                    shear_disp[index] = -delta_t;
                 }
             }
         } else {
@@ -555,14 +521,15 @@ void function_CalcContactForces(
 void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& ct_bid,
                                                            custom_vector<real3>& ct_force,
                                                            custom_vector<real3>& ct_torque,
-                                                           custom_vector<vec2>& shape_pairs,
-                                                           custom_vector<char>& shear_touch) {
+                                                           custom_vector<char>& shear_touch,
+                                                           custom_vector<real3>& shear_disp,
+                                                           custom_vector<real>& contact_relvel_init,
+                                                           custom_vector<real>& contact_duration) {
 #pragma omp parallel for
     for (int index = 0; index < (signed)data_manager->cd_data->num_rigid_contacts; index++) {
         function_CalcContactForces(
             index,                                                  // index of this contact pair
             data_manager->cd_data->bids_rigid_rigid.data(),         // indices of the body pair in contact
-            shape_pairs.data(),                                     // indices of the shape pair in contact
             data_manager->settings.solver.contact_force_model,      // contact force model
             data_manager->settings.solver.adhesion_force_model,     // adhesion force model
             data_manager->settings.solver.tangential_displ_mode,    // type of tangential displacement history
@@ -586,18 +553,156 @@ void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& c
             data_manager->cd_data->norm_rigid_rigid.data(),         // contact normal (per contact)
             data_manager->cd_data->dpth_rigid_rigid.data(),         // penetration depth (per contact)
             data_manager->cd_data->erad_rigid_rigid.data(),         // effective contact radius (per contact)
-            data_manager->host_data.shear_neigh.data(),  // neighbor list of contacting bodies and shapes (per body)
-            shear_touch.data(),                          // flag if contact in neighbor list is persistent (per body)
-            data_manager->host_data.shear_disp.data(),   // accumulated shear displacement for each neighbor (per body)
-            data_manager->host_data.contact_relvel_init.data(),  // initial relative normal velocity per contact pair
-            data_manager->host_data.contact_duration.data(),     // duration of persistent contact between contact pairs
-            ct_bid.data(),                                       // [output] body IDs (two per contact)
-            ct_force.data(),                                     // [output] body force (two per contact)
-            ct_torque.data()                                     // [output] body torque (two per contact)
+            shear_touch.data(),                                     // [output] flag if contact is persistent
+            shear_disp.data(),                                      // accumulated shear displacement (per contact)
+            contact_relvel_init.data(),                             // initial relative normal velocity (per contact)
+            contact_duration.data(),                                // duration of persistent contact (per contact)
+            ct_bid.data(),                                          // [output] body IDs (two per contact)
+            ct_force.data(),                                        // [output] body force (two per contact)
+            ct_torque.data()                                        // [output] body torque (two per contact)
         );
     }
 }
 
+// -----------------------------------------------------------------------------
+// Contact history for the multi-step tangential displacement model.
+// The history of the contacts that persist at the end of a step is stored in an open-addressing hash table (with
+// linear probing), keyed by the body and shape pairs of each contact. At the beginning of the next step, each contact
+// looks up its history in this table (concurrently, the table being read-only). At the end of the step, the table is
+// rebuilt (concurrently, with slots claimed through atomic operations) from the contacts that persist. The table size
+// is a power of 2, at least twice the number of contacts, so that probe sequences remain short.
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Key of a contact: the body with larger index and the shape with larger index come first.
+inline vec4 ContactKey(const vec2& bodies, long long shapes) {
+    int s1 = int(shapes >> 32);
+    int s2 = int(shapes & 0xffffffff);
+    vec4 key;
+    key.x = std::max(bodies.x, bodies.y);
+    key.y = std::min(bodies.x, bodies.y);
+    key.z = std::max(s1, s2);
+    key.w = std::min(s1, s2);
+    return key;
+}
+
+inline bool SameContactKey(const vec4& a, const vec4& b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+}
+
+inline size_t HashContactKey(const vec4& key) {
+    uint64_t h1 = (uint64_t(uint32_t(key.x)) << 32) | uint32_t(key.y);
+    uint64_t h2 = (uint64_t(uint32_t(key.z)) << 32) | uint32_t(key.w);
+    uint64_t h = h1 * 0x9E3779B97F4A7C15ULL ^ h2 * 0xC2B2AE3D27D4EB4FULL;
+    return size_t(h ^ (h >> 29));
+}
+
+// Return the table slot of the given key, or -1 if not found.
+inline int FindContactKey(const custom_vector<vec4>& keys, const vec4& key) {
+    if (keys.empty())
+        return -1;
+    size_t mask = keys.size() - 1;
+    for (size_t h = HashContactKey(key) & mask; keys[h].x != -1; h = (h + 1) & mask) {
+        if (SameContactKey(keys[h], key))
+            return (int)h;
+    }
+    return -1;
+}
+
+}  // end anonymous namespace
+
+void ChIterativeSolverMulticoreSMC::host_LoadContactHistory(custom_vector<vec4>& ct_keys,
+                                                            custom_vector<real3>& shear_disp,
+                                                            custom_vector<real>& contact_relvel_init,
+                                                            custom_vector<real>& contact_duration) {
+    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
+    const auto& body_pairs = data_manager->cd_data->bids_rigid_rigid;
+    const auto& shape_ids = data_manager->cd_data->contact_shapeIDs;
+    const auto& host_data = data_manager->host_data;
+
+    ct_keys.resize(num_rigid_contacts);
+    shear_disp.resize(num_rigid_contacts);
+    contact_relvel_init.resize(num_rigid_contacts);
+    contact_duration.resize(num_rigid_contacts);
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_rigid_contacts; i++) {
+        ct_keys[i] = ContactKey(body_pairs[i], shape_ids[i]);
+        int slot = FindContactKey(host_data.shear_keys, ct_keys[i]);
+        if (slot >= 0) {
+            shear_disp[i] = host_data.shear_disp[slot];
+            contact_relvel_init[i] = host_data.contact_relvel_init[slot];
+            contact_duration[i] = host_data.contact_duration[slot];
+        } else {
+            // New contact; history initialized in function_CalcContactForces
+            shear_disp[i] = real3(0);
+            contact_relvel_init[i] = -1;
+            contact_duration[i] = 0;
+        }
+    }
+}
+
+void ChIterativeSolverMulticoreSMC::host_StoreContactHistory(const custom_vector<vec4>& ct_keys,
+                                                             const custom_vector<char>& shear_touch,
+                                                             const custom_vector<real3>& shear_disp,
+                                                             const custom_vector<real>& contact_relvel_init,
+                                                             const custom_vector<real>& contact_duration) {
+    const int num_contacts = (int)ct_keys.size();
+    auto& host_data = data_manager->host_data;
+
+    // Table size: smallest power of 2 not less than twice the number of contacts
+    size_t capacity = 0;
+    if (num_contacts > 0) {
+        capacity = 1;
+        while (capacity < 2 * (size_t)num_contacts)
+            capacity <<= 1;
+    }
+    size_t mask = capacity - 1;
+
+    // Claim a slot for each persistent contact. Each slot records the index of the contact that owns it. If the same
+    // key is reported by several contacts, the history of the contact with smallest index is kept.
+    std::vector<std::atomic<int>> owner(capacity);
+#pragma omp parallel for
+    for (int h = 0; h < (signed)capacity; h++)
+        owner[h].store(-1, std::memory_order_relaxed);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_contacts; i++) {
+        if (!shear_touch[i])
+            continue;
+        for (size_t h = HashContactKey(ct_keys[i]) & mask;; h = (h + 1) & mask) {
+            int current = -1;
+            if (owner[h].compare_exchange_strong(current, i))
+                break;
+            if (SameContactKey(ct_keys[current], ct_keys[i])) {
+                while (current > i && !owner[h].compare_exchange_weak(current, i)) {
+                }
+                break;
+            }
+        }
+    }
+
+    // Fill the new table
+    host_data.shear_keys.resize(capacity);
+    host_data.shear_disp.resize(capacity);
+    host_data.contact_relvel_init.resize(capacity);
+    host_data.contact_duration.resize(capacity);
+
+#pragma omp parallel for
+    for (int h = 0; h < (signed)capacity; h++) {
+        int i = owner[h].load(std::memory_order_relaxed);
+        if (i < 0) {
+            host_data.shear_keys[h].x = -1;
+            continue;
+        }
+        host_data.shear_keys[h] = ct_keys[i];
+        host_data.shear_disp[h] = shear_disp[i];
+        host_data.contact_relvel_init[h] = contact_relvel_init[i];
+        host_data.contact_duration[h] = contact_duration[i];
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Include contact impulses (linear and rotational) for all bodies that are
 // involved in at least one contact. For each such body, the corresponding
@@ -659,22 +764,20 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     custom_vector<real3> ct_force(2 * num_rigid_contacts);
     custom_vector<real3> ct_torque(2 * num_rigid_contacts);
 
-    // Set up additional vectors for multi-step tangential model
-    custom_vector<vec2> shape_pairs;
+    // Set up additional vectors for multi-step tangential model (contact history, per contact)
+    custom_vector<vec4> ct_keys;
     custom_vector<char> shear_touch;
+    custom_vector<real3> shear_disp;
+    custom_vector<real> contact_relvel_init;
+    custom_vector<real> contact_duration;
     if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-        shape_pairs.resize(num_rigid_contacts);
-        shear_touch.resize(max_shear * data_manager->num_rigid_bodies);
+        shear_touch.resize(num_rigid_contacts);
         Thrust_Fill(shear_touch, false);
-#pragma omp parallel for
-        for (int i = 0; i < (signed)num_rigid_contacts; i++) {
-            vec2 pair = I2(int(data_manager->cd_data->contact_shapeIDs[i] >> 32),
-                           int(data_manager->cd_data->contact_shapeIDs[i] & 0xffffffff));
-            shape_pairs[i] = pair;
-        }
+        host_LoadContactHistory(ct_keys, shear_disp, contact_relvel_init, contact_duration);
     }
 
-    host_CalcContactForces(ct_bid, ct_force, ct_torque, shape_pairs, shear_touch);
+    host_CalcContactForces(ct_bid, ct_force, ct_torque, shear_touch, shear_disp, contact_relvel_init,
+                           contact_duration);
 
     data_manager->host_data.ct_force.resize(2 * num_rigid_contacts);
     data_manager->host_data.ct_torque.resize(2 * num_rigid_contacts);
@@ -682,13 +785,7 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     thrust::copy(THRUST_PAR ct_torque.begin(), ct_torque.end(), data_manager->host_data.ct_torque.begin());
 
     if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-#pragma omp parallel for
-        for (int index = 0; index < (signed)data_manager->num_rigid_bodies; index++) {
-            for (int i = 0; i < max_shear; i++) {
-                if (shear_touch[max_shear * index + i] == false)
-                    data_manager->host_data.shear_neigh[max_shear * index + i].x = -1;
-            }
-        }
+        host_StoreContactHistory(ct_keys, shear_touch, shear_disp, contact_relvel_init, contact_duration);
     }
 
     // 2. Calculate contact forces and torques - per body basis
@@ -802,6 +899,12 @@ void ChIterativeSolverMulticoreSMC::RunTimeStep() {
         data_manager->system_timer.start("ChIterativeSolverMulticoreSMC_ProcessContact");
         ProcessContacts();
         data_manager->system_timer.stop("ChIterativeSolverMulticoreSMC_ProcessContact");
+    } else {
+        // No contacts persist from this step; discard the contact history
+        data_manager->host_data.shear_keys.clear();
+        data_manager->host_data.shear_disp.clear();
+        data_manager->host_data.contact_relvel_init.clear();
+        data_manager->host_data.contact_duration.clear();
     }
 
     // Generate the mass matrix and compute M_inv_k
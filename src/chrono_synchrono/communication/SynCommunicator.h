@@ -79,7 +79,7 @@ class SYN_API SynCommunicator {
     ///@brief Add the messages to the outgoing message buffer
     ///
     ///@param messages a list of handles to messages to add to the outgoing buffer
-    void AddOutgoingMessages(SynMessageList& messages);
+    virtual void AddOutgoingMessages(SynMessageList& messages);
 
     /// @brief Adds a quit message to the queue telling other nodes to end the simulation
     void AddQuitMessage();
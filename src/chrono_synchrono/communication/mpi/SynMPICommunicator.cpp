@@ -21,12 +21,20 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
+#include "chrono_synchrono/utils/SynLog.h"
 
 namespace chrono {
 namespace synchrono {
 
-SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
+// MPI tags for the neighbor-only exchange of vehicle states
+static const int TAG_STATE_SIZE = 1;
+static const int TAG_STATE_DATA = 2;
+
+SynMPICommunicator::SynMPICommunicator(int argc, char* argv[])
+    : m_interest_radius(0), m_num_neighbors(0), m_bytes_sent(0) {
     // mpi initialization
     MPI_Init(&argc, &argv);
     // set rank
@@ -38,6 +46,7 @@ SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
 
     m_msg_lengths = new int[m_num_ranks];
     m_msg_displs = new int[m_num_ranks];
+    m_records.resize(m_num_ranks);
 }
 
 SynMPICommunicator::~SynMPICommunicator() {
@@ -47,7 +56,33 @@ SynMPICommunicator::~SynMPICommunicator() {
     MPI_Finalize();
 }
 
+void SynMPICommunicator::AddOutgoingMessages(SynMessageList& messages) {
+    if (m_interest_radius <= 0) {
+        SynCommunicator::AddOutgoingMessages(messages);
+        return;
+    }
+
+    for (auto message : messages) {
+        if (SynMPIStateEncoder::IsSupported(message))
+            m_state_messages.push_back(message);
+        else
+            m_flatbuffers_manager.AddMessage(message);
+    }
+}
+
 void SynMPICommunicator::Synchronize() {
+    if (m_interest_radius > 0) {
+        SynchronizeInterest();
+        return;
+    }
+
+    GatherFlatBuffers();
+    m_num_neighbors = m_num_ranks - 1;
+
+    m_flatbuffers_manager.Reset();
+}
+
+void SynMPICommunicator::GatherFlatBuffers() {
     m_flatbuffers_manager.Finish();
 
     int msg_length = m_flatbuffers_manager.GetSize();
@@ -70,27 +105,160 @@ void SynMPICommunicator::Synchronize() {
     // if (m_rank == 0)
     //     std::cout << m_rank << " message length: " << m_total_length << std::endl;
 
-    m_all_data.reserve(m_total_length);
+    // Need resize rather than reserve so that MPI can just copy into the buffer
+    m_all_data.resize(m_total_length);
 
     MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
                    m_all_data.data(), m_msg_lengths, m_msg_displs,
                    MPI_BYTE,  // Receiving pointer, lengths, displacements, type
                    MPI_COMM_WORLD);
 
+    m_bytes_sent = (size_t)msg_length * (m_num_ranks - 1);
+}
+
+void SynMPICommunicator::SynchronizeInterest() {
+    // Bounding sphere of the vehicles on this rank
+    InterestRecord& record = m_records[m_rank];
+    record = InterestRecord();
+    record.has_vehicles = m_state_messages.empty() ? 0 : 1;
+    record.num_broadcast = (double)m_flatbuffers_manager.GetFlatBufferMessageList().size();
+    if (!m_state_messages.empty()) {
+        ChVector<> pmin(+1e300);
+        ChVector<> pmax(-1e300);
+        for (auto& message : m_state_messages) {
+            auto pos = SynMPIStateEncoder::GetPosition(message);
+            pmin = ChVector<>(std::min(pmin.x(), pos.x()), std::min(pmin.y(), pos.y()), std::min(pmin.z(), pos.z()));
+            pmax = ChVector<>(std::max(pmax.x(), pos.x()), std::max(pmax.y(), pos.y()), std::max(pmax.z(), pos.z()));
+        }
+        ChVector<> center = 0.5 * (pmin + pmax);
+        for (auto& message : m_state_messages)
+            record.radius = std::max(record.radius, (SynMPIStateEncoder::GetPosition(message) - center).Length());
+        record.center[0] = center.x();
+        record.center[1] = center.y();
+        record.center[2] = center.z();
+    }
+
+    // Share the interest records (fixed size, independent of the number of vehicles)
+    InterestRecord my_record = record;
+    MPI_Allgather(&my_record, sizeof(InterestRecord), MPI_BYTE,     // Sending pointer, length, type
+                  m_records.data(), sizeof(InterestRecord), MPI_BYTE,  // Receiving pointer, length, type
+                  MPI_COMM_WORLD);
+
+    // Messages other than vehicle states are sent to all ranks, but only if some rank has any
+    bool broadcast = false;
+    for (const auto& rec : m_records)
+        broadcast = broadcast || rec.num_broadcast > 0;
+    if (broadcast) {
+        GatherFlatBuffers();
+    } else {
+        m_total_length = 0;
+        for (int i = 0; i < m_num_ranks; i++) {
+            m_msg_lengths[i] = 0;
+            m_msg_displs[i] = 0;
+        }
+        m_bytes_sent = 0;
+    }
+    m_bytes_sent += sizeof(InterestRecord) * (m_num_ranks - 1);
+
+    // Find the neighbor ranks and drop the encoders of ranks which are no longer neighbors.
+    // Since the neighbor relation is symmetric, both sides of each exchange agree on it.
+    std::vector<int> neighbors;
+    for (int i = 0; i < m_num_ranks; i++) {
+        if (i != m_rank && AreNeighbors(m_records[m_rank], m_records[i]))
+            neighbors.push_back(i);
+    }
+    for (auto it = m_encoders.begin(); it != m_encoders.end();) {
+        if (std::find(neighbors.begin(), neighbors.end(), it->first) == neighbors.end())
+            it = m_encoders.erase(it);
+        else
+            ++it;
+    }
+    m_num_neighbors = (int)neighbors.size();
+
+    // Encode the states of interest for each neighbor
+    int num = m_num_neighbors;
+    std::vector<std::vector<uint8_t>> send_data(num);
+    std::vector<std::vector<uint8_t>> recv_data(num);
+    std::vector<int> send_sizes(num);
+    std::vector<int> recv_sizes(num);
+    for (int k = 0; k < num; k++) {
+        const auto& rec = m_records[neighbors[k]];
+        auto& encoder = m_encoders[neighbors[k]];
+        for (auto& message : m_state_messages) {
+            if (IsOfInterest(SynMPIStateEncoder::GetPosition(message), rec))
+                encoder.Encode(message, send_data[k]);
+        }
+        send_sizes[k] = (int)send_data[k].size();
+        m_bytes_sent += sizeof(int) + send_data[k].size();
+    }
+
+    // Exchange sizes, then data, with non-blocking point-to-point communication
+    std::vector<MPI_Request> requests(2 * num);
+    for (int k = 0; k < num; k++)
+        MPI_Irecv(&recv_sizes[k], 1, MPI_INT, neighbors[k], TAG_STATE_SIZE, MPI_COMM_WORLD, &requests[k]);
+    for (int k = 0; k < num; k++)
+        MPI_Isend(&send_sizes[k], 1, MPI_INT, neighbors[k], TAG_STATE_SIZE, MPI_COMM_WORLD, &requests[num + k]);
+    MPI_Waitall(2 * num, requests.data(), MPI_STATUSES_IGNORE);
+
+    for (int k = 0; k < num; k++) {
+        recv_data[k].resize(recv_sizes[k]);
+        MPI_Irecv(recv_data[k].data(), recv_sizes[k], MPI_BYTE, neighbors[k], TAG_STATE_DATA, MPI_COMM_WORLD,
+                  &requests[k]);
+    }
+    for (int k = 0; k < num; k++)
+        MPI_Isend(send_data[k].data(), send_sizes[k], MPI_BYTE, neighbors[k], TAG_STATE_DATA, MPI_COMM_WORLD,
+                  &requests[num + k]);
+    MPI_Waitall(2 * num, requests.data(), MPI_STATUSES_IGNORE);
+
+    // The exchange is complete: the states just sent become the base for the next delta encodings
+    for (int k = 0; k < num; k++)
+        m_encoders[neighbors[k]].Commit();
+
+    for (int k = 0; k < num; k++) {
+        if (!m_decoder.Decode(recv_data[k].data(), recv_data[k].size(), m_received_states))
+            SynLog() << "WARNING: malformed vehicle state data received from rank " << neighbors[k] << "\n";
+    }
+
+    m_state_messages.clear();
     m_flatbuffers_manager.Reset();
 }
 
+bool SynMPICommunicator::AreNeighbors(const InterestRecord& a, const InterestRecord& b) const {
+    if (a.has_vehicles == 0 && b.has_vehicles == 0)
+        return false;
+    if (a.has_vehicles == 0 || b.has_vehicles == 0)
+        return true;
+
+    // Note: a.radius + b.radius == b.radius + a.radius, so that the test gives the same result on both ranks
+    double dx = a.center[0] - b.center[0];
+    double dy = a.center[1] - b.center[1];
+    double dz = a.center[2] - b.center[2];
+    double range = m_interest_radius + (a.radius + b.radius);
+    return dx * dx + dy * dy + dz * dz <= range * range;
+}
+
+bool SynMPICommunicator::IsOfInterest(const ChVector<>& pos, const InterestRecord& rec) const {
+    if (rec.has_vehicles == 0)
+        return true;
+    double range = m_interest_radius + rec.radius;
+    return (pos - ChVector<>(rec.center[0], rec.center[1], rec.center[2])).Length2() <= range * range;
+}
+
 SynMessageList& SynMPICommunicator::GetMessages() {
     for (int i = 0; i < m_num_ranks; i++) {
-        if (i != m_rank) {
+        if (i != m_rank && m_msg_lengths[i] > 0) {
             std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
                                                              m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
             m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
         }
     }
 
+    // Vehicle states received from neighbor ranks (interest management only)
+    m_incoming_messages.insert(m_incoming_messages.end(), m_received_states.begin(), m_received_states.end());
+    m_received_states.clear();
+
     return m_incoming_messages;
 }
 
 }  // namespace synchrono
-}  // namespace chrono
\ No newline at end of file
+}  // namespace chrono
@@ -26,7 +26,10 @@
 
 #include <mpi.h>
 
+#include <map>
+
 #include "chrono_synchrono/communication/SynCommunicator.h"
+#include "chrono_synchrono/communication/mpi/SynMPIStateEncoding.h"
 
 namespace chrono {
 namespace synchrono {
@@ -35,7 +38,21 @@ namespace synchrono {
 /// @{
 
 /// Derived communicator used to establish and facilitate communication between nodes.
-/// Uses the Message Passing Interface (MPI) standard
+/// Uses the Message Passing Interface (MPI) standard.
+///
+/// By default, all messages of each rank are sent to every other rank (MPI_Allgatherv). If an interest radius is set
+/// (see SetInterestRadius), vehicle state messages (SynWheeledVehicleStateMessage and SynTrackedVehicleStateMessage)
+/// are instead only exchanged between neighboring ranks:
+/// - at each synchronization, ranks share a small fixed-size record with the bounding sphere of their vehicles;
+/// - two ranks are neighbors if their bounding spheres are closer than the interest radius (a rank without vehicles
+///   is interested in all vehicles);
+/// - a vehicle state is sent to a neighbor only if the vehicle is within the interest radius of the neighbor's
+///   bounding sphere, using non-blocking point-to-point sends;
+/// - states are delta-encoded against the last state of the same vehicle acknowledged by that neighbor (see
+///   SynMPIStateEncoder).
+///
+/// All other messages (descriptions, simulation, traffic light messages, ...) are still sent to all ranks, but only on
+/// synchronizations where some rank has any.
 class SYN_API SynMPICommunicator : public SynCommunicator {
   public:
     ///@brief Default constructor
@@ -61,6 +78,12 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual void Synchronize() override;
 
+    ///@brief Add the messages to the outgoing message buffer
+    /// If interest management is enabled, vehicle state messages are set aside for the neighbor-only exchange.
+    ///
+    ///@param messages a list of handles to messages to add to the outgoing buffer
+    virtual void AddOutgoingMessages(SynMessageList& messages) override;
+
     ///@brief This method is responsible for blocking until an action is received or done.
     /// For example, a process may call Barrier to wait until another process has established
     /// certain classes and initialized certain quantities. This functionality should be implemented
@@ -83,12 +106,62 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual int GetNumRanks() const { return m_num_ranks; }
 
+    ///@brief Set the interest radius for the exchange of vehicle state messages
+    /// A non-positive value (default) disables interest management, so that all messages are sent to all ranks.
+    /// All ranks must use the same value.
+    ///
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
+    ///@brief Get the interest radius for the exchange of vehicle state messages
+    ///
+    double GetInterestRadius() const { return m_interest_radius; }
+
+    ///@brief Get the number of ranks this rank exchanged vehicle states with during the last synchronization
+    /// With interest management disabled, this is the number of other ranks.
+    ///
+    int GetNumNeighbors() const { return m_num_neighbors; }
+
+    ///@brief Get the number of bytes sent by this rank to other ranks during the last synchronization
+    /// For collective exchanges, the data is counted once for each receiving rank.
+    ///
+    size_t GetNumBytesSent() const { return m_bytes_sent; }
+
     // -----------------------------------------------------------------------------------------------
 
   private:
+    /// Record shared by all ranks at each synchronization when interest management is enabled
+    struct InterestRecord {
+        double center[3];      ///< center of the bounding sphere of the vehicles on the rank
+        double radius;         ///< radius of the bounding sphere of the vehicles on the rank
+        double has_vehicles;   ///< 1 if the rank has vehicle state messages to send, 0 otherwise
+        double num_broadcast;  ///< number of messages to be sent to all ranks
+    };
+
+    /// Send the messages in the flatbuffer manager to all ranks
+    void GatherFlatBuffers();
+
+    /// Exchange vehicle state messages with neighboring ranks only
+    void SynchronizeInterest();
+
+    /// Check whether two ranks exchange vehicle state messages (symmetric)
+    bool AreNeighbors(const InterestRecord& a, const InterestRecord& b) const;
+
+    /// Check whether the given position is of interest for a rank
+    bool IsOfInterest(const ChVector<>& pos, const InterestRecord& rec) const;
+
     int m_rank;
     int m_num_ranks;
 
+    double m_interest_radius;  ///< interest radius (disabled if non-positive)
+    int m_num_neighbors;       ///< number of ranks vehicle states were exchanged with in the last synchronization
+    size_t m_bytes_sent;       ///< number of bytes sent in the last synchronization
+
+    SynMessageList m_state_messages;               ///< outgoing vehicle state messages (interest management only)
+    SynMessageList m_received_states;              ///< decoded incoming vehicle states (interest management only)
+    std::vector<InterestRecord> m_records;         ///< interest records of all ranks
+    std::map<int, SynMPIStateEncoder> m_encoders;  ///< state encoders, per neighbor rank
+    SynMPIStateDecoder m_decoder;                  ///< state decoder for all incoming states
+
     int m_total_length;
 
     int* m_msg_lengths;
@@ -0,0 +1,336 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Compact, lossless delta encoding of vehicle state messages, used by the MPI
+// communicator when interest management is enabled.
+//
+// Encoded message layout (all integers little-endian):
+//   uint8    message type (wheeled or tracked vehicle state)
+//   uint8    flags (bit 0: delta-encoded)
+//   int32[4] source node id, source agent id, destination node id, destination agent id
+//   int32[]  number of poses in each pose list (1 list for wheeled, 4 lists for tracked vehicles)
+//   values   in pairs: one byte with the byte counts of the two values (low and high nibble),
+//            followed by the low-order bytes of the two XOR-ed values
+//
+// =============================================================================
+
+#include <cstring>
+
+#include "chrono_synchrono/communication/mpi/SynMPIStateEncoding.h"
+#include "chrono_synchrono/flatbuffer/message/SynTrackedVehicleMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynWheeledVehicleMessage.h"
+
+namespace chrono {
+namespace synchrono {
+
+namespace {
+
+const int WHEELED_STATE = 1;
+const int TRACKED_STATE = 2;
+const int POSE_SIZE = 21;  // position, rotation and their first and second derivatives
+
+// -----------------------------------------------------------------------------
+
+void AppendPose(SynPose& pose, std::vector<double>& values) {
+    const auto& frame = pose.GetFrame();
+    const ChCoordsys<>* coords[3] = {&frame.GetCoord(), &frame.GetCoord_dt(), &frame.GetCoord_dtdt()};
+    for (auto csys : coords) {
+        values.push_back(csys->pos.x());
+        values.push_back(csys->pos.y());
+        values.push_back(csys->pos.z());
+        values.push_back(csys->rot.e0());
+        values.push_back(csys->rot.e1());
+        values.push_back(csys->rot.e2());
+        values.push_back(csys->rot.e3());
+    }
+}
+
+SynPose ExtractPose(const double* v) {
+    ChFrameMoving<> frame(ChVector<>(v[0], v[1], v[2]), ChQuaternion<>(v[3], v[4], v[5], v[6]));
+    frame.coord_dt.pos = ChVector<>(v[7], v[8], v[9]);
+    frame.coord_dt.rot = ChQuaternion<>(v[10], v[11], v[12], v[13]);
+    frame.coord_dtdt.pos = ChVector<>(v[14], v[15], v[16]);
+    frame.coord_dtdt.rot = ChQuaternion<>(v[17], v[18], v[19], v[20]);
+    return SynPose(frame);
+}
+
+std::vector<SynPose> ExtractPoses(const double*& v, int num_poses) {
+    std::vector<SynPose> poses;
+    poses.reserve(num_poses);
+    for (int i = 0; i < num_poses; i++, v += POSE_SIZE)
+        poses.push_back(ExtractPose(v));
+    return poses;
+}
+
+// Flatten a vehicle state message. Return false if the message is not supported.
+bool Flatten(std::shared_ptr<SynMessage> message, SynMPIEncodedState& state) {
+    state.layout.clear();
+    state.values.clear();
+
+    if (auto wheeled = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
+        state.layout = {WHEELED_STATE, (int)wheeled->wheels.size()};
+        state.values.reserve(1 + POSE_SIZE * (1 + wheeled->wheels.size()));
+        state.values.push_back(wheeled->time);
+        AppendPose(wheeled->chassis, state.values);
+        for (auto& wheel : wheeled->wheels)
+            AppendPose(wheel, state.values);
+        return true;
+    }
+
+    if (auto tracked = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message)) {
+        state.layout = {TRACKED_STATE, (int)tracked->track_shoes.size(), (int)tracked->sprockets.size(),
+                        (int)tracked->idlers.size(), (int)tracked->road_wheels.size()};
+        state.values.push_back(tracked->time);
+        AppendPose(tracked->chassis, state.values);
+        for (auto list : {&tracked->track_shoes, &tracked->sprockets, &tracked->idlers, &tracked->road_wheels}) {
+            for (auto& pose : *list)
+                AppendPose(pose, state.values);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+// Create a vehicle state message from its flattened state.
+std::shared_ptr<SynMessage> Unflatten(const SynMPIEncodedState& state, AgentKey source, AgentKey destination) {
+    const double* v = state.values.data();
+    double time = *v++;
+    SynPose chassis = ExtractPose(v);
+    v += POSE_SIZE;
+
+    if (state.layout[0] == WHEELED_STATE) {
+        auto message = chrono_types::make_shared<SynWheeledVehicleStateMessage>(source, destination);
+        auto wheels = ExtractPoses(v, state.layout[1]);
+        message->SetState(time, chassis, wheels);
+        message->SetMessageType(SynFlatBuffers::Type_Agent_State);
+        return message;
+    }
+
+    auto message = chrono_types::make_shared<SynTrackedVehicleStateMessage>(source, destination);
+    auto track_shoes = ExtractPoses(v, state.layout[1]);
+    auto sprockets = ExtractPoses(v, state.layout[2]);
+    auto idlers = ExtractPoses(v, state.layout[3]);
+    auto road_wheels = ExtractPoses(v, state.layout[4]);
+    message->SetState(time, chassis, track_shoes, sprockets, idlers, road_wheels);
+    message->SetMessageType(SynFlatBuffers::Type_Agent_State);
+    return message;
+}
+
+// -----------------------------------------------------------------------------
+
+void WriteInt(int32_t val, std::vector<uint8_t>& buffer) {
+    uint32_t u = (uint32_t)val;
+    for (int k = 0; k < 4; k++)
+        buffer.push_back((uint8_t)(u >> (8 * k)));
+}
+
+uint64_t ToBits(double val) {
+    uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+}
+
+double FromBits(uint64_t bits) {
+    double val;
+    std::memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+
+// Number of significant (low-order) bytes
+int NumBytes(uint64_t x) {
+    int n = 0;
+    while (x) {
+        x >>= 8;
+        n++;
+    }
+    return n;
+}
+
+// Encode the given values, XOR-ed with the base values (if any)
+void EncodeValues(const std::vector<double>& values, const std::vector<double>* base, std::vector<uint8_t>& buffer) {
+    size_t n = values.size();
+    for (size_t i = 0; i < n; i += 2) {
+        uint64_t x[2] = {0, 0};
+        int nb[2] = {0, 0};
+        for (size_t k = 0; k < 2 && i + k < n; k++) {
+            x[k] = ToBits(values[i + k]) ^ (base ? ToBits((*base)[i + k]) : 0);
+            nb[k] = NumBytes(x[k]);
+        }
+        buffer.push_back((uint8_t)(nb[0] | (nb[1] << 4)));
+        for (int k = 0; k < 2; k++) {
+            for (int b = 0; b < nb[k]; b++)
+                buffer.push_back((uint8_t)(x[k] >> (8 * b)));
+        }
+    }
+}
+
+// Sequential reader with bounds checking
+class Reader {
+  public:
+    Reader(const uint8_t* data, size_t size) : m_ptr(data), m_end(data + size) {}
+
+    bool AtEnd() const { return m_ptr >= m_end; }
+
+    size_t Remaining() const { return (size_t)(m_end - m_ptr); }
+
+    bool ReadByte(uint8_t& val) {
+        if (m_ptr + 1 > m_end)
+            return false;
+        val = *m_ptr++;
+        return true;
+    }
+
+    bool ReadInt(int32_t& val) {
+        if (m_ptr + 4 > m_end)
+            return false;
+        uint32_t u = 0;
+        for (int k = 0; k < 4; k++)
+            u |= (uint32_t)(*m_ptr++) << (8 * k);
+        val = (int32_t)u;
+        return true;
+    }
+
+    bool ReadValues(size_t n, const std::vector<double>* base, std::vector<double>& values) {
+        // Each pair of values takes at least one byte; check before allocating
+        if ((n + 1) / 2 > Remaining())
+            return false;
+        values.resize(n);
+        for (size_t i = 0; i < n; i += 2) {
+            uint8_t header;
+            if (!ReadByte(header))
+                return false;
+            int nb[2] = {header & 0x0F, header >> 4};
+            for (size_t k = 0; k < 2; k++) {
+                if (nb[k] > 8 || m_ptr + nb[k] > m_end)
+                    return false;
+                uint64_t x = 0;
+                for (int b = 0; b < nb[k]; b++)
+                    x |= (uint64_t)(*m_ptr++) << (8 * b);
+                if (i + k < n)
+                    values[i + k] = FromBits(x ^ (base ? ToBits((*base)[i + k]) : 0));
+            }
+        }
+        return true;
+    }
+
+  private:
+    const uint8_t* m_ptr;
+    const uint8_t* m_end;
+};
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+bool SynMPIStateEncoder::IsSupported(std::shared_ptr<SynMessage> message) {
+    return std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message) ||
+           std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message);
+}
+
+ChVector<> SynMPIStateEncoder::GetPosition(std::shared_ptr<SynMessage> message) {
+    if (auto wheeled = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message))
+        return wheeled->chassis.GetFrame().GetPos();
+    if (auto tracked = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message))
+        return tracked->chassis.GetFrame().GetPos();
+    return ChVector<>(0, 0, 0);
+}
+
+void SynMPIStateEncoder::Encode(std::shared_ptr<SynMessage> message, std::vector<uint8_t>& buffer) {
+    SynMPIEncodedState state;
+    if (!Flatten(message, state))
+        return;
+
+    int id = message->GetSourceKey().GetUniqueID();
+    auto base = m_base.find(id);
+    bool delta = base != m_base.end() && base->second.layout == state.layout;
+
+    buffer.push_back((uint8_t)state.layout[0]);
+    buffer.push_back(delta ? 1 : 0);
+    WriteInt(message->GetSourceKey().GetNodeID(), buffer);
+    WriteInt(message->GetSourceKey().GetAgentID(), buffer);
+    WriteInt(message->GetDestinationKey().GetNodeID(), buffer);
+    WriteInt(message->GetDestinationKey().GetAgentID(), buffer);
+    for (size_t i = 1; i < state.layout.size(); i++)
+        WriteInt(state.layout[i], buffer);
+    EncodeValues(state.values, delta ? &base->second.values : nullptr, buffer);
+
+    m_pending[id] = std::move(state);
+}
+
+void SynMPIStateEncoder::Commit() {
+    for (auto& pending : m_pending)
+        m_base[pending.first] = std::move(pending.second);
+    m_pending.clear();
+}
+
+void SynMPIStateEncoder::Clear() {
+    m_base.clear();
+    m_pending.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+bool SynMPIStateDecoder::Decode(const uint8_t* data, size_t size, SynMessageList& messages) {
+    Reader reader(data, size);
+
+    while (!reader.AtEnd()) {
+        uint8_t type, flags;
+        int32_t source_node, source_agent, destination_node, destination_agent;
+        if (!reader.ReadByte(type) || !reader.ReadByte(flags))
+            return false;
+        if (!reader.ReadInt(source_node) || !reader.ReadInt(source_agent) || !reader.ReadInt(destination_node) ||
+            !reader.ReadInt(destination_agent))
+            return false;
+
+        int num_lists;
+        if (type == WHEELED_STATE)
+            num_lists = 1;
+        else if (type == TRACKED_STATE)
+            num_lists = 4;
+        else
+            return false;
+
+        SynMPIEncodedState state;
+        state.layout.push_back(type);
+        size_t num_poses = 1;
+        for (int i = 0; i < num_lists; i++) {
+            int32_t count;
+            if (!reader.ReadInt(count) || count < 0 || (size_t)count > reader.Remaining())
+                return false;
+            state.layout.push_back(count);
+            num_poses += count;
+        }
+
+        AgentKey source(source_node, source_agent);
+        const std::vector<double>* base_values = nullptr;
+        if (flags & 1) {
+            auto base = m_base.find(source.GetUniqueID());
+            if (base == m_base.end() || base->second.layout != state.layout)
+                return false;
+            base_values = &base->second.values;
+        }
+
+        if (!reader.ReadValues(1 + POSE_SIZE * num_poses, base_values, state.values))
+            return false;
+
+        messages.push_back(Unflatten(state, source, AgentKey(destination_node, destination_agent)));
+        m_base[source.GetUniqueID()] = std::move(state);
+    }
+
+    return true;
+}
+
+}  // namespace synchrono
+}  // namespace chrono
@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Compact, lossless delta encoding of vehicle state messages, used by the MPI
+// communicator when interest management is enabled.
+//
+// =============================================================================
+
+#ifndef SYN_MPI_STATE_ENCODING_H
+#define SYN_MPI_STATE_ENCODING_H
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "chrono_synchrono/SynApi.h"
+#include "chrono_synchrono/flatbuffer/message/SynMessage.h"
+
+namespace chrono {
+namespace synchrono {
+
+/// @addtogroup synchrono_communication_mpi
+/// @{
+
+/// Flattened state of a vehicle state message, used as base for delta encoding.
+struct SynMPIEncodedState {
+    std::vector<int> layout;     ///< message type followed by the number of poses in each pose list
+    std::vector<double> values;  ///< time and all poses (with their derivatives)
+};
+
+/// Encoder for vehicle state messages (SynWheeledVehicleStateMessage and SynTrackedVehicleStateMessage).
+/// A state message is flattened into a vector of values (time and all poses, with their first and second derivatives).
+/// Each value is XOR-ed with the corresponding value of the last acknowledged state of the same agent and only the
+/// non-zero low-order bytes of the result are written, preceded by a 4-bit byte count. Since consecutive states of a
+/// vehicle share sign, exponent and leading mantissa bits, most values take 3 to 6 bytes instead of 8, and unchanged
+/// values take none. If there is no acknowledged state for the agent (or the number of poses changed), the message is
+/// encoded in full. The encoding is lossless.
+///
+/// An encoder is associated with a single receiver: the states encoded since the last call to Commit() become the base
+/// for the next encodings only once Commit() is called, i.e. once the receiver is known to have them.
+class SYN_API SynMPIStateEncoder {
+  public:
+    SynMPIStateEncoder() {}
+    ~SynMPIStateEncoder() {}
+
+    /// Return true if the given message can be encoded (wheeled and tracked vehicle state messages).
+    static bool IsSupported(std::shared_ptr<SynMessage> message);
+
+    /// Return the position of the chassis of the vehicle described by the given (supported) state message.
+    static ChVector<> GetPosition(std::shared_ptr<SynMessage> message);
+
+    /// Append the encoding of the given state message to the buffer.
+    void Encode(std::shared_ptr<SynMessage> message, std::vector<uint8_t>& buffer);
+
+    /// Acknowledge all states encoded since the last call, which become the base for the next encodings.
+    void Commit();
+
+    /// Forget all states; subsequent messages are encoded in full.
+    void Clear();
+
+  private:
+    std::map<int, SynMPIEncodedState> m_base;     ///< acknowledged states, per agent
+    std::map<int, SynMPIEncodedState> m_pending;  ///< encoded but not yet acknowledged states, per agent
+};
+
+/// Decoder for vehicle state messages encoded with SynMPIStateEncoder.
+/// The decoder keeps the last decoded state of each agent, as base for the following delta-encoded messages.
+class SYN_API SynMPIStateDecoder {
+  public:
+    SynMPIStateDecoder() {}
+    ~SynMPIStateDecoder() {}
+
+    /// Decode all state messages in the given buffer and append them to the provided list.
+    /// Return false if the buffer is malformed or if a delta-encoded message has no matching base state.
+    bool Decode(const uint8_t* data, size_t size, SynMessageList& messages);
+
+    /// Forget all states.
+    void Clear() { m_base.clear(); }
+
+  private:
+    std::map<int, SynMPIEncodedState> m_base;  ///< last decoded states, per agent
+};
+
+/// @} synchrono_communication_mpi
+
+}  // namespace synchrono
+}  // namespace chrono
+
+#endif
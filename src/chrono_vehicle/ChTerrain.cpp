@@ -33,5 +33,33 @@ float ChTerrain::GetCoefficientFriction(const ChVector<>& loc) const {
     return 0.8f;
 }
 
+void ChTerrain::GetProperties(const std::vector<ChVector<>>& loc,
+                              std::vector<double>& height,
+                              std::vector<ChVector<>>* normal,
+                              std::vector<float>* friction) const {
+    size_t n = loc.size();
+    height.resize(n);
+    for (size_t i = 0; i < n; i++)
+        height[i] = GetHeight(loc[i]);
+    if (normal) {
+        normal->resize(n);
+        for (size_t i = 0; i < n; i++)
+            (*normal)[i] = GetNormal(loc[i]);
+    }
+    if (friction) {
+        friction->resize(n);
+        for (size_t i = 0; i < n; i++)
+            (*friction)[i] = GetCoefficientFriction(loc[i]);
+    }
+}
+
+void ChTerrain::GetProperties(const ChVector<>& loc, double& height, ChVector<>* normal, float* friction) const {
+    height = GetHeight(loc);
+    if (normal)
+        *normal = GetNormal(loc);
+    if (friction)
+        *friction = GetCoefficientFriction(loc);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
@@ -19,6 +19,8 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/core/ChVector.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -54,6 +56,24 @@ class CH_VEHICLE_API ChTerrain {
     /// with other objects (including tire models that do not explicitly use it).
     virtual float GetCoefficientFriction(const ChVector<>& loc) const;
 
+    /// Get the terrain height, normal, and coefficient of friction at the points below the specified locations.
+    /// The output vectors are resized to the number of query locations. Normals and coefficients of friction are
+    /// evaluated only if the corresponding output vector is provided. The default implementation calls GetHeight,
+    /// GetNormal, and GetCoefficientFriction for each location; derived classes can override it to find all properties
+    /// with a single search per location.
+    virtual void GetProperties(const std::vector<ChVector<>>& loc,
+                               std::vector<double>& height,
+                               std::vector<ChVector<>>* normal = nullptr,
+                               std::vector<float>* friction = nullptr) const;
+
+    /// Get the terrain height and, optionally, normal and coefficient of friction at the point below the specified
+    /// location. This single-point version of GetProperties does not allocate any memory. The default implementation
+    /// calls GetHeight, GetNormal, and GetCoefficientFriction.
+    virtual void GetProperties(const ChVector<>& loc,
+                               double& height,
+                               ChVector<>* normal = nullptr,
+                               float* friction = nullptr) const;
+
     /// Class to be used as a functor interface for location-dependent coefficient of friction.
     class CH_VEHICLE_API FrictionFunctor {
       public:
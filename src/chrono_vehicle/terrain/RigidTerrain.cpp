@@ -49,6 +49,7 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_grid(false),
       m_contact_callback(nullptr),
       m_collision_family(14) {}
 
@@ -59,6 +60,7 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_grid(false),
       m_contact_callback(nullptr),
       m_collision_family(14) {
     // Open and parse the input file
@@ -495,7 +497,7 @@ class RTContactCallback : public ChContactContainer::AddContactCallback {
         auto friction_terrain = (*m_friction_fun)(contactinfo.vpA);
 
         // Set friction in composite material based on contact formulation.
-        auto friction_other = shape_other->GetMaterial()->sliding_friction;
+        auto friction_other = shape_other->GetMaterial()->GetKfriction();
         auto friction = strategy.CombineFriction(friction_terrain, friction_other);
         switch (sys->GetContactMethod()) {
             case ChContactMethod::NSC: {
@@ -525,6 +527,10 @@ void RigidTerrain::Initialize() {
         // and disable collision with other collision models in this family.
         patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
         patch->m_body->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(m_collision_family);
+
+        // Build the height-field grid for mesh patches
+        if (m_use_grid && patch->m_type != PatchType::BOX)
+            std::static_pointer_cast<MeshPatch>(patch)->BuildGrid();
     }
 
     if (!m_friction_fun)
@@ -579,6 +585,36 @@ float RigidTerrain::GetCoefficientFriction(const ChVector<>& loc) const {
     return hit ? friction : 0.8f;
 }
 
+void RigidTerrain::GetProperties(const std::vector<ChVector<>>& loc,
+                                 std::vector<double>& height,
+                                 std::vector<ChVector<>>* normal,
+                                 std::vector<float>* friction) const {
+    size_t n = loc.size();
+    height.resize(n);
+    if (normal)
+        normal->resize(n);
+    if (friction)
+        friction->resize(n);
+
+    for (size_t i = 0; i < n; i++)
+        RigidTerrain::GetProperties(loc[i], height[i], normal ? &(*normal)[i] : nullptr,
+                                    friction ? &(*friction)[i] : nullptr);
+}
+
+void RigidTerrain::GetProperties(const ChVector<>& loc, double& height, ChVector<>* normal, float* friction) const {
+    double pheight;
+    ChVector<> pnormal;
+    float pfriction;
+
+    bool hit = FindPoint(loc, pheight, pnormal, pfriction);
+
+    height = hit ? pheight : 0.0;
+    if (normal)
+        *normal = hit ? pnormal : ChWorldFrame::Vertical();
+    if (friction)
+        *friction = m_friction_fun ? (*m_friction_fun)(loc) : (hit ? pfriction : 0.8f);
+}
+
 bool RigidTerrain::FindPoint(const ChVector<> loc, double& height, ChVector<>& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
@@ -617,6 +653,9 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector<>& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    if (!m_grid_cell_start.empty())
+        return FindPointGrid(loc, height, normal);
+
     ChVector<> from = loc + (m_radius + 1000) * ChWorldFrame::Vertical();
     ChVector<> to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -628,6 +667,150 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, C
     return result.hit;
 }
 
+// -----------------------------------------------------------------------------
+// Height-field grid for mesh patches.
+// The (fixed) patch mesh is expressed in an absolute ISO frame and the mesh faces are binned in a uniform grid over
+// the horizontal (x,y) plane. A query for the terrain point below a given location only tests the faces overlapping
+// the grid cell containing that location and returns the highest intersection, same as a downward ray cast.
+// -----------------------------------------------------------------------------
+void RigidTerrain::MeshPatch::BuildGrid() {
+    const auto& vertices = m_trimesh->getCoordsVertices();
+    const auto& faces = m_trimesh->getIndicesVertexes();
+
+    m_grid_vertices.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++)
+        m_grid_vertices[i] = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(vertices[i]));
+
+    // Collect the non-vertical faces (vertical faces cannot be hit by a vertical ray) and their upward normals.
+    // Find the horizontal extent of the mesh and the average horizontal size of a face.
+    m_grid_faces.clear();
+    m_grid_normals.clear();
+    double xmin = std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
+    double ymax = std::numeric_limits<double>::lowest();
+    double face_size = 0;
+    for (const auto& face : faces) {
+        const auto& A = m_grid_vertices[face[0]];
+        const auto& B = m_grid_vertices[face[1]];
+        const auto& C = m_grid_vertices[face[2]];
+        ChVector<> n = Vcross(B - A, C - A);
+        if (std::abs(n.z()) <= 1e-12 * n.Length())
+            continue;
+        if (n.z() < 0)
+            n = -n;
+        m_grid_faces.push_back(face);
+        m_grid_normals.push_back(n.GetNormalized());
+
+        double fxmin = std::min({A.x(), B.x(), C.x()});
+        double fymin = std::min({A.y(), B.y(), C.y()});
+        double fxmax = std::max({A.x(), B.x(), C.x()});
+        double fymax = std::max({A.y(), B.y(), C.y()});
+        xmin = std::min(xmin, fxmin);
+        ymin = std::min(ymin, fymin);
+        xmax = std::max(xmax, fxmax);
+        ymax = std::max(ymax, fymax);
+        face_size += std::max(fxmax - fxmin, fymax - fymin);
+    }
+
+    int num_faces = (int)m_grid_faces.size();
+    if (num_faces == 0) {
+        m_grid_cell_start.clear();
+        m_grid_cell_faces.clear();
+        return;
+    }
+
+    // Size the grid cells after the average face size, limiting the number of cells to a multiple of the number of
+    // faces (for meshes with very non-uniform face sizes).
+    double lx = std::max(xmax - xmin, 1e-6);
+    double ly = std::max(ymax - ymin, 1e-6);
+    m_grid_delta = std::max(face_size / num_faces, 1e-6);
+    double num_cells = (lx / m_grid_delta + 1) * (ly / m_grid_delta + 1);
+    if (num_cells > 4.0 * num_faces)
+        m_grid_delta *= std::sqrt(num_cells / (4.0 * num_faces));
+    m_grid_xmin = xmin;
+    m_grid_ymin = ymin;
+    m_grid_nx = (int)(lx / m_grid_delta) + 1;
+    m_grid_ny = (int)(ly / m_grid_delta) + 1;
+
+    // Bin faces in the cells overlapped by their horizontal bounding box (two passes: count, then fill)
+    auto cell_range = [this](const ChVector<int>& face, int& ix1, int& iy1, int& ix2, int& iy2) {
+        const auto& A = m_grid_vertices[face[0]];
+        const auto& B = m_grid_vertices[face[1]];
+        const auto& C = m_grid_vertices[face[2]];
+        ix1 = ChClamp((int)((std::min({A.x(), B.x(), C.x()}) - m_grid_xmin) / m_grid_delta), 0, m_grid_nx - 1);
+        iy1 = ChClamp((int)((std::min({A.y(), B.y(), C.y()}) - m_grid_ymin) / m_grid_delta), 0, m_grid_ny - 1);
+        ix2 = ChClamp((int)((std::max({A.x(), B.x(), C.x()}) - m_grid_xmin) / m_grid_delta), 0, m_grid_nx - 1);
+        iy2 = ChClamp((int)((std::max({A.y(), B.y(), C.y()}) - m_grid_ymin) / m_grid_delta), 0, m_grid_ny - 1);
+    };
+
+    m_grid_cell_start.assign(m_grid_nx * m_grid_ny + 1, 0);
+    for (const auto& face : m_grid_faces) {
+        int ix1, iy1, ix2, iy2;
+        cell_range(face, ix1, iy1, ix2, iy2);
+        for (int iy = iy1; iy <= iy2; iy++)
+            for (int ix = ix1; ix <= ix2; ix++)
+                m_grid_cell_start[iy * m_grid_nx + ix + 1]++;
+    }
+    for (int ic = 0; ic < m_grid_nx * m_grid_ny; ic++)
+        m_grid_cell_start[ic + 1] += m_grid_cell_start[ic];
+
+    m_grid_cell_faces.resize(m_grid_cell_start.back());
+    std::vector<int> fill(m_grid_cell_start.begin(), m_grid_cell_start.end() - 1);
+    for (int f = 0; f < num_faces; f++) {
+        int ix1, iy1, ix2, iy2;
+        cell_range(m_grid_faces[f], ix1, iy1, ix2, iy2);
+        for (int iy = iy1; iy <= iy2; iy++)
+            for (int ix = ix1; ix <= ix2; ix++)
+                m_grid_cell_faces[fill[iy * m_grid_nx + ix]++] = f;
+    }
+}
+
+bool RigidTerrain::MeshPatch::FindPointGrid(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    ChVector<> p = ChWorldFrame::ToISO(loc);
+
+    double x = (p.x() - m_grid_xmin) / m_grid_delta;
+    double y = (p.y() - m_grid_ymin) / m_grid_delta;
+    if (x < 0 || y < 0 || x >= m_grid_nx || y >= m_grid_ny)
+        return false;
+    int cell = (int)y * m_grid_nx + (int)x;
+
+    // Find the highest face intersected by a vertical line through the query location
+    int face_id = -1;
+    double z = std::numeric_limits<double>::lowest();
+    for (int k = m_grid_cell_start[cell]; k < m_grid_cell_start[cell + 1]; k++) {
+        int f = m_grid_cell_faces[k];
+        const auto& A = m_grid_vertices[m_grid_faces[f][0]];
+        const auto& B = m_grid_vertices[m_grid_faces[f][1]];
+        const auto& C = m_grid_vertices[m_grid_faces[f][2]];
+
+        // Barycentric coordinates of the query location in the horizontal projection of the face
+        double det = (B.y() - C.y()) * (A.x() - C.x()) + (C.x() - B.x()) * (A.y() - C.y());
+        double l1 = ((B.y() - C.y()) * (p.x() - C.x()) + (C.x() - B.x()) * (p.y() - C.y())) / det;
+        double l2 = ((C.y() - A.y()) * (p.x() - C.x()) + (A.x() - C.x()) * (p.y() - C.y())) / det;
+        double l3 = 1 - l1 - l2;
+        if (l1 < -1e-10 || l2 < -1e-10 || l3 < -1e-10)
+            continue;
+
+        double fz = l1 * A.z() + l2 * B.z() + l3 * C.z();
+        if (fz > z) {
+            z = fz;
+            face_id = f;
+        }
+    }
+
+    if (face_id == -1)
+        return false;
+
+    // Report the hit point consistently with ray casting into the collision system (offset by the collision envelope)
+    normal = ChWorldFrame::FromISO(m_grid_normals[face_id]);
+    ChVector<> point = ChWorldFrame::FromISO(ChVector<>(p.x(), p.y(), z));
+    point -= normal * m_body->GetCollisionModel()->GetEnvelope();
+    height = ChWorldFrame::Height(point);
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
@@ -169,6 +169,28 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// See UseLocationDependentFriction.
     virtual float GetCoefficientFriction(const ChVector<>& loc) const override;
 
+    /// Get the terrain height, normal, and coefficient of friction at the points below the specified locations.
+    /// All properties at a given location are obtained with a single search over the terrain patches.
+    virtual void GetProperties(const std::vector<ChVector<>>& loc,
+                               std::vector<double>& height,
+                               std::vector<ChVector<>>* normal = nullptr,
+                               std::vector<float>* friction = nullptr) const override;
+
+    /// Get the terrain height and, optionally, normal and coefficient of friction at the point below the specified
+    /// location (single-point version, with a single search over the terrain patches).
+    virtual void GetProperties(const ChVector<>& loc,
+                               double& height,
+                               ChVector<>* normal = nullptr,
+                               float* friction = nullptr) const override;
+
+    /// Enable use of a height-field grid for terrain queries on mesh patches.
+    /// If enabled, a uniform grid over the horizontal projection of each mesh patch, with the list of mesh triangles
+    /// overlapping each cell, is built at Initialize. Height, normal, and friction queries on mesh patches are then
+    /// resolved directly against the triangles of the cell containing the query location, without ray casting into
+    /// the collision system. This assumes the patch meshes are not modified after Initialize. By default, this option
+    /// is disabled. This function must be called before Initialize.
+    void UseHeightFieldGrid(bool val) { m_use_grid = val; }
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -203,12 +225,30 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
+
+        /// Build the height-field grid of this patch (see RigidTerrain::UseHeightFieldGrid).
+        void BuildGrid();
+
+        /// Find the terrain point below the specified location using the height-field grid.
+        bool FindPointGrid(const ChVector<>& loc, double& height, ChVector<>& normal) const;
+
+        std::vector<ChVector<>> m_grid_vertices;  ///< mesh vertices (absolute, expressed in the ISO frame)
+        std::vector<ChVector<int>> m_grid_faces;  ///< non-vertical mesh faces
+        std::vector<ChVector<>> m_grid_normals;   ///< upward face normals (expressed in the ISO frame)
+        std::vector<int> m_grid_cell_start;       ///< start of the face list of each cell (plus end marker)
+        std::vector<int> m_grid_cell_faces;       ///< face indices, grouped by cell
+        double m_grid_xmin;                       ///< grid origin, x coordinate
+        double m_grid_ymin;                       ///< grid origin, y coordinate
+        double m_grid_delta;                      ///< grid cell size
+        int m_grid_nx;                            ///< number of grid cells in x direction
+        int m_grid_ny;                            ///< number of grid cells in y direction
     };
 
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    bool m_use_grid;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
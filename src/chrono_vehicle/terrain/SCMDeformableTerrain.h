@@ -20,7 +20,9 @@
 #ifndef SCM_DEFORMABLE_TERRAIN_H
 #define SCM_DEFORMABLE_TERRAIN_H
 
+#include <algorithm>
 #include <string>
+#include <memory>
 #include <ostream>
 #include <unordered_map>
 
@@ -403,6 +405,106 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
         std::size_t operator()(const ChVector2<int>& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Sparse tiled storage of node records.
+    // The SCM grid is partitioned in square tiles of TILE_SIZE x TILE_SIZE nodes. A tile is allocated the first time
+    // one of its nodes is recorded and stores the records of all its nodes contiguously, together with flags marking
+    // the recorded nodes. Tiles are addressed by index through a hash map of tile coordinates; since this map has one
+    // entry per tile (rather than per node), lookups are much cheaper than in a per-node hash map and neighboring nodes
+    // are usually in the same (cached) tile. Node records never move once allocated.
+    // Memory tradeoff: a tile stores all its TILE_SIZE x TILE_SIZE records (about 8 KB) as soon as one node is
+    // recorded. Since SCM nodes are recorded in contiguous patches under the contacting bodies (tire footprints, track
+    // shoes), which usually span several tiles, most records of an allocated tile are eventually used; in the worst
+    // case of isolated recorded nodes, the tiled storage uses over an order of magnitude more memory than a per-node
+    // hash map.
+    class NodeGrid {
+      public:
+        NodeGrid() : m_num_nodes(0) {}
+
+        // Return the record of the specified node (nullptr if the node was not recorded).
+        NodeRecord* Find(const ChVector2<int>& ij) {
+            auto t = m_tile_index.find(TileCoords(ij));
+            if (t == m_tile_index.end())
+                return nullptr;
+            int k = LocalIndex(ij);
+            auto& tile = *m_tiles[t->second];
+            return tile.recorded[k] ? &tile.nodes[k] : nullptr;
+        }
+
+        const NodeRecord* Find(const ChVector2<int>& ij) const { return const_cast<NodeGrid*>(this)->Find(ij); }
+
+        // Return the record of the specified node (throw an exception if the node was not recorded).
+        NodeRecord& Get(const ChVector2<int>& ij) {
+            NodeRecord* nr = Find(ij);
+            if (!nr)
+                throw ChException("SCM grid node not recorded");
+            return *nr;
+        }
+
+        // Set the record of the specified node (overwriting any existing record) and return a reference to it.
+        NodeRecord& Insert(const ChVector2<int>& ij, const NodeRecord& nr) {
+            auto tc = TileCoords(ij);
+            auto t = m_tile_index.find(tc);
+            int it;
+            if (t == m_tile_index.end()) {
+                it = (int)m_tiles.size();
+                m_tiles.push_back(std::unique_ptr<Tile>(new Tile(tc)));
+                m_tile_index.insert(std::make_pair(tc, it));
+            } else {
+                it = t->second;
+            }
+            int k = LocalIndex(ij);
+            auto& tile = *m_tiles[it];
+            if (!tile.recorded[k]) {
+                tile.recorded[k] = true;
+                m_num_nodes++;
+            }
+            tile.nodes[k] = nr;
+            return tile.nodes[k];
+        }
+
+        // Return the number of recorded nodes.
+        size_t GetNumNodes() const { return m_num_nodes; }
+
+        // Invoke the given function f(ij, nr) for all recorded nodes, tile by tile.
+        template <typename F>
+        void ForEach(F f) const {
+            for (const auto& tile : m_tiles) {
+                for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+                    if (tile->recorded[k])
+                        f(ChVector2<int>(tile->origin.x() + k % TILE_SIZE, tile->origin.y() + k / TILE_SIZE),
+                          tile->nodes[k]);
+                }
+            }
+        }
+
+      private:
+        static const int TILE_BITS = 3;
+        static const int TILE_SIZE = 1 << TILE_BITS;
+
+        struct Tile {
+            Tile(const ChVector2<int>& tc) : origin(tc.x() * TILE_SIZE, tc.y() * TILE_SIZE) {
+                std::fill(recorded, recorded + TILE_SIZE * TILE_SIZE, false);
+            }
+            ChVector2<int> origin;                    // coordinates of first tile node
+            NodeRecord nodes[TILE_SIZE * TILE_SIZE];  // node records (row-major)
+            bool recorded[TILE_SIZE * TILE_SIZE];     // flags for recorded nodes
+        };
+
+        // Tile coordinates of a grid node (floor division, also for negative node coordinates).
+        static ChVector2<int> TileCoords(const ChVector2<int>& ij) {
+            return ChVector2<int>(ij.x() >> TILE_BITS, ij.y() >> TILE_BITS);
+        }
+
+        // Index of a grid node within its tile.
+        static int LocalIndex(const ChVector2<int>& ij) {
+            return (ij.x() & (TILE_SIZE - 1)) + TILE_SIZE * (ij.y() & (TILE_SIZE - 1));
+        }
+
+        std::vector<std::unique_ptr<Tile>> m_tiles;                      // allocated tiles
+        std::unordered_map<ChVector2<int>, int, CoordHash> m_tile_index;  // index of tile with given coordinates
+        size_t m_num_nodes;                                              // number of recorded nodes
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -511,8 +613,8 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
 
     ChMatrixDynamic<> m_heights;  // (base) grid heights (when initializing from height-field map)
 
-    std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_grid_map;  // modified grid nodes (persistent)
-    std::vector<ChVector2<int>> m_modified_nodes;                          // modified grid nodes (current)
+    NodeGrid m_grid_map;                           // modified grid nodes (persistent)
+    std::vector<ChVector2<int>> m_modified_nodes;  // modified grid nodes (current)
 
     std::vector<MovingPatchInfo> m_patches;  // set of active moving patches
     bool m_moving_patch;                     // user-specified moving patches?
@@ -554,6 +656,13 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
     // Indices of visualization mesh vertices modified externally
     std::vector<int> m_external_modified_vertices;
 
+    // Ray casting buffers (reused across steps)
+    std::vector<ChVector2<int>> m_ray_nodes;  // grid nodes of cast rays
+    std::vector<ChVector<>> m_ray_from;       // ray start points
+    std::vector<ChVector<>> m_ray_to;         // ray end points
+    std::vector<char> m_ray_active;           // flags for rays passing the quick rejection test
+    std::vector<collision::ChCollisionSystem::ChRayhitResult> m_ray_results;
+
     // Timers and counters
     ChTimer<double> m_timer_moving_patches;
     ChTimer<double> m_timer_ray_testing;
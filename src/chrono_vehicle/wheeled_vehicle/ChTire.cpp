@@ -162,15 +162,16 @@ bool ChTire::DiscTerrainCollision(
     ChCoordsys<>& contact,          // [out] contact coordinate system (relative to the global frame)
     double& depth)                  // [out] penetration depth (positive if contact occurred)
 {
-    // Find terrain height below disc center. There is no contact if the disc
+    // Find terrain height and normal below disc center. There is no contact if the disc
     // center is below the terrain or farther away by more than its radius.
-    double hc = terrain.GetHeight(disc_center);
+    double hc;
+    ChVector<> nhelp;
+    terrain.GetProperties(disc_center, hc, &nhelp);
     double disc_height = ChWorldFrame::Height(disc_center);
     if (disc_height <= hc || disc_height >= hc + disc_radius)
         return false;
 
     // Find the lowest point on the disc. There is no contact if the disc is (almost) horizontal.
-    ChVector<> nhelp = terrain.GetNormal(disc_center);
     ChVector<> dir1 = Vcross(disc_normal, nhelp);
     double sinTilt2 = dir1.Length2();
 
@@ -180,15 +181,16 @@ bool ChTire::DiscTerrainCollision(
     // Contact point (lowest point on disc).
     ChVector<> ptD = disc_center + disc_radius * Vcross(disc_normal, dir1 / sqrt(sinTilt2));
 
-    // Find terrain height at lowest point. No contact if lowest point is above the terrain.
-    double hp = terrain.GetHeight(ptD);
+    // Find terrain height and normal at lowest point. No contact if lowest point is above the terrain.
+    double hp;
+    ChVector<> normal;
+    terrain.GetProperties(ptD, hp, &normal);
     double ptD_height = ChWorldFrame::Height(ptD);
     if (ptD_height > hp)
         return false;
 
     // Approximate the terrain with a plane. Define the projection of the lowest
     // point onto this plane as the contact point on the terrain.
-    ChVector<> normal = terrain.GetNormal(ptD);
     ChVector<> longitudinal = Vcross(disc_normal, normal);
     longitudinal.Normalize();
     ChVector<> lateral = Vcross(normal, longitudinal);
@@ -217,15 +219,16 @@ bool ChTire::DiscTerrainCollision4pt(
     double dx = 0.1 * disc_radius;
     double dy = 0.3 * width;
 
-    // Find terrain height below disc center. There is no contact if the disc
+    // Find terrain height and normal below disc center. There is no contact if the disc
     // center is below the terrain or farther away by more than its radius.
-    double hc = terrain.GetHeight(disc_center);
+    double hc;
+    ChVector<> nhelp;
+    terrain.GetProperties(disc_center, hc, &nhelp);
     double disc_height = ChWorldFrame::Height(disc_center);
     if (disc_height <= hc || disc_height >= hc + disc_radius)
         return false;
 
     // Find the lowest point on the disc. There is no contact if the disc is (almost) horizontal.
-    ChVector<> nhelp = terrain.GetNormal(disc_center);
     ChVector<> dir1 = Vcross(disc_normal, nhelp);
     double sinTilt2 = dir1.Length2();
 
@@ -244,24 +247,26 @@ bool ChTire::DiscTerrainCollision4pt(
 
     // Calculate four contact points in the contact patch
     ChVector<> ptQ1 = ptD + dx * longitudinal;
-    double hQ1 = terrain.GetHeight(ptQ1);
+    ChVector<> ptQ2 = ptD - dx * longitudinal;
+    ChVector<> ptQ3 = ptD + dy * lateral;
+    ChVector<> ptQ4 = ptD - dy * lateral;
+    double heights[4];
+    terrain.GetProperties(ptQ1, heights[0]);
+    terrain.GetProperties(ptQ2, heights[1]);
+    terrain.GetProperties(ptQ3, heights[2]);
+    terrain.GetProperties(ptQ4, heights[3]);
+
     double ptQ1_height = ChWorldFrame::Height(ptQ1);
-    ptQ1 = ptQ1 - (ptQ1_height - hQ1) * ChWorldFrame::Vertical();
+    ptQ1 = ptQ1 - (ptQ1_height - heights[0]) * ChWorldFrame::Vertical();
 
-    ChVector<> ptQ2 = ptD - dx * longitudinal;
-    double hQ2 = terrain.GetHeight(ptQ2);
     double ptQ2_height = ChWorldFrame::Height(ptQ2);
-    ptQ2 = ptQ2 - (ptQ2_height - hQ2) * ChWorldFrame::Vertical();
+    ptQ2 = ptQ2 - (ptQ2_height - heights[1]) * ChWorldFrame::Vertical();
 
-    ChVector<> ptQ3 = ptD + dy * lateral;
-    double hQ3 = terrain.GetHeight(ptQ3);
     double ptQ3_height = ChWorldFrame::Height(ptQ3);
-    ptQ3 = ptQ3 - (ptQ3_height - hQ3) * ChWorldFrame::Vertical();
+    ptQ3 = ptQ3 - (ptQ3_height - heights[2]) * ChWorldFrame::Vertical();
 
-    ChVector<> ptQ4 = ptD - dy * lateral;
-    double hQ4 = terrain.GetHeight(ptQ4);
     double ptQ4_height = ChWorldFrame::Height(ptQ4);
-    ptQ4 = ptQ4 - (ptQ4_height - hQ4) * ChWorldFrame::Vertical();
+    ptQ4 = ptQ4 - (ptQ4_height - heights[3]) * ChWorldFrame::Vertical();
 
     // Calculate a smoothed road surface normal
     ChVector<> rQ2Q1 = ptQ1 - ptQ2;
@@ -323,14 +328,22 @@ bool ChTire::DiscTerrainCollisionEnvelope(
     ChVector<> longitudinal = Vcross(disc_normal, normal);
     longitudinal.Normalize();
 
+    // Query the terrain heights at all test points in a single batch
     const size_t n_div = 180;
     double x_step = 2.0 * disc_radius / n_div;
+    std::vector<ChVector<>> pTest(n_div - 1);
+    for (size_t i = 1; i < n_div; i++) {
+        double x = -disc_radius + x_step * double(i);
+        pTest[i - 1] = disc_center + x * longitudinal;
+    }
+    std::vector<double> heights;
+    terrain.GetProperties(pTest, heights);
+
     double A = 0;  // overlapping area of tire disc and road surface contour
     for (size_t i = 1; i < n_div; i++) {
         double x = -disc_radius + x_step * double(i);
-        ChVector<> pTest = disc_center + x * longitudinal;
-        double q = terrain.GetHeight(pTest);
-        double a = ChWorldFrame::Height(pTest) - sqrt(disc_radius * disc_radius - x * x);
+        double q = heights[i - 1];
+        double a = ChWorldFrame::Height(pTest[i - 1]) - sqrt(disc_radius * disc_radius - x * x);
         if (q > a) {
             A += q - a;
         }
@@ -345,7 +358,7 @@ bool ChTire::DiscTerrainCollisionEnvelope(
     depth = areaDep.Get_y(A);
 
     // Find the lowest point on the disc. There is no contact if the disc is (almost) horizontal.
-    ChVector<> nhelp = terrain.GetNormal(disc_center);
+    ChVector<> nhelp = normal;
     ChVector<> dir1 = Vcross(disc_normal, nhelp);
     double sinTilt2 = dir1.Length2();
 
@@ -78,21 +78,22 @@ void WriteCSV(std::ofstream* file, int timestep_i, ChSystemDistributed* sys) {
     *file << ss_particles.str();
 }
 
-void Monitor(chrono::ChSystemMulticore* system, int rank) {
+void Monitor(chrono::ChSystemDistributed* system, int rank) {
     double TIME = system->GetChTime();
     double STEP = system->GetTimerStep();
     double BROD = system->GetTimerCollisionBroad();
     double NARR = system->GetTimerCollisionNarrow();
     double SOLVER = system->GetTimerLSsolve();
     double UPDT = system->GetTimerUpdate();
-    double EXCH = system->data_manager->system_timer.GetTime("Exchange");
+    double EXCH = system->GetTimerExchange();
+    double WAIT = system->GetTimerExchangeWait();
     int BODS = system->GetNbodies();
     int CNTC = system->GetNcontacts();
     double RESID = std::static_pointer_cast<chrono::ChIterativeSolverMulticore>(system->GetSolver())->GetResidual();
     int ITER = std::static_pointer_cast<chrono::ChIterativeSolverMulticore>(system->GetSolver())->GetIterations();
 
-    printf("%d|   %8.5f | %7.4f | E%7.4f | B%7.4f | N%7.4f | %7.4f | %7.4f | %7d | %7d | %7d | %7.4f\n",  ////
-           rank, TIME, STEP, EXCH, BROD, NARR, SOLVER, UPDT, BODS, CNTC, ITER, RESID);
+    printf("%d|   %8.5f | %7.4f | E%7.4f | W%7.4f | B%7.4f | N%7.4f | %7.4f | %7.4f | %7d | %7d | %7d | %7.4f\n",  ////
+           rank, TIME, STEP, EXCH, WAIT, BROD, NARR, SOLVER, UPDT, BODS, CNTC, ITER, RESID);
 }
 
 void AddContainer(ChSystemDistributed* sys, double hx, double hy, double height) {
@@ -317,10 +318,18 @@ int main(int argc, char* argv[]) {
     if (verbose && my_rank == MASTER)
         std::cout << "Starting Simulation" << std::endl;
 
+    // Cumulative communication timers on this rank
+    double t_exchange = 0;
+    double t_wait = 0;
+    double t_overlap = 0;
+
     double t_start = MPI_Wtime();
     for (int i = 0; i < num_steps; i++) {
         my_sys.DoStepDynamics(time_step);
         time += time_step;
+        t_exchange += my_sys.GetTimerExchange();
+        t_wait += my_sys.GetTimerExchangeWait();
+        t_overlap += my_sys.GetTimerExchangeOverlap();
 
         if (i % out_steps == 0) {
             if (my_rank == MASTER)
@@ -336,8 +345,23 @@ int main(int argc, char* argv[]) {
     }
     double elapsed = MPI_Wtime() - t_start;
 
-    if (my_rank == MASTER)
+    // Communication statistics over all ranks (for strong scaling studies, run with an increasing
+    // number of ranks on the same problem, e.g. mpirun -n <N> demo_DISTR_scaling ...)
+    double t_local[3] = {t_exchange, t_wait, t_overlap};
+    double t_max[3];
+    double t_sum[3];
+    MPI_Reduce(t_local, t_max, 3, MPI_DOUBLE, MPI_MAX, MASTER, MPI_COMM_WORLD);
+    MPI_Reduce(t_local, t_sum, 3, MPI_DOUBLE, MPI_SUM, MASTER, MPI_COMM_WORLD);
+
+    if (my_rank == MASTER) {
         std::cout << "\n\nTotal elapsed time = " << elapsed << std::endl;
+        std::cout << "Communication time (avg / max over ranks) = " << t_sum[0] / num_ranks << " / " << t_max[0]
+                  << std::endl;
+        std::cout << "Idle time, waiting for messages (avg / max) = " << t_sum[1] / num_ranks << " / " << t_max[1]
+                  << std::endl;
+        std::cout << "Computation overlapped with communication (avg / max) = " << t_sum[2] / num_ranks << " / "
+                  << t_max[2] << std::endl;
+    }
 
     if (output_data)
         outfile.close();
@@ -0,0 +1,120 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark for the evaluation of function trees, in their original form and
+// compiled with ChFunction_Compiled.
+// A motor drive cycle is described by a long recorded speed profile, scaled by
+// a ramp-up law and used as the central segment of a sequence. The functions
+// are evaluated at random times (as when switching between different cycles or
+// re-evaluating at Newton iterates) and over a sorted array of times.
+//
+// =============================================================================
+
+#include <cmath>
+#include <random>
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/motion_functions/ChFunction.h"
+
+using namespace chrono;
+
+// Create a drive cycle with the given number of recorded points
+std::shared_ptr<ChFunction> DriveCycle(int num_points) {
+    auto recorder = chrono_types::make_shared<ChFunction_Recorder>();
+    for (int i = 0; i < num_points; i++) {
+        double t = 0.1 * i;
+        recorder->AddPoint(t, 20 * std::sin(0.01 * t) * std::sin(0.01 * t) + std::sin(t));
+    }
+
+    auto rampup = chrono_types::make_shared<ChFunction_Operation>();
+    rampup->Set_optype(ChFunction_Operation::ChOP_MIN);
+    rampup->Set_fa(chrono_types::make_shared<ChFunction_Ramp>(0, 0.1));
+    rampup->Set_fb(chrono_types::make_shared<ChFunction_Const>(1));
+
+    auto scaled = chrono_types::make_shared<ChFunction_Operation>();
+    scaled->Set_optype(ChFunction_Operation::ChOP_MUL);
+    scaled->Set_fa(rampup);
+    scaled->Set_fb(recorder);
+
+    auto seq = chrono_types::make_shared<ChFunction_Sequence>();
+    seq->InsertFunct(chrono_types::make_shared<ChFunction_Const>(0), 1.0);
+    seq->InsertFunct(scaled, 0.1 * num_points);
+    seq->InsertFunct(chrono_types::make_shared<ChFunction_Const>(0), 1.0);
+    seq->Setup();
+
+    return seq;
+}
+
+std::vector<double> RandomTimes(int num_points, int num_times) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(0, 0.1 * num_points + 2);
+    std::vector<double> times(num_times);
+    for (auto& t : times)
+        t = distribution(generator);
+    return times;
+}
+
+static void BM_Original_random(benchmark::State& state) {
+    auto fun = DriveCycle((int)state.range(0));
+    auto times = RandomTimes((int)state.range(0), 1000);
+    for (auto _ : state) {
+        for (auto t : times)
+            benchmark::DoNotOptimize(fun->Get_y(t));
+    }
+    state.SetItemsProcessed(state.iterations() * times.size());
+}
+BENCHMARK(BM_Original_random)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_Compiled_random(benchmark::State& state) {
+    ChFunction_Compiled fun(DriveCycle((int)state.range(0)));
+    auto times = RandomTimes((int)state.range(0), 1000);
+    for (auto _ : state) {
+        for (auto t : times)
+            benchmark::DoNotOptimize(fun.Get_y(t));
+    }
+    state.SetItemsProcessed(state.iterations() * times.size());
+}
+BENCHMARK(BM_Compiled_random)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_Original_sweep(benchmark::State& state) {
+    auto fun = DriveCycle((int)state.range(0));
+    ChVectorDynamic<> times(10000);
+    for (int i = 0; i < times.size(); i++)
+        times(i) = (0.1 * state.range(0) + 2) * i / times.size();
+    ChVectorDynamic<> y(times.size());
+    for (auto _ : state) {
+        for (int i = 0; i < times.size(); i++)
+            y(i) = fun->Get_y_dx(times(i));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * times.size());
+}
+BENCHMARK(BM_Original_sweep)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void BM_Compiled_sweep(benchmark::State& state) {
+    ChFunction_Compiled fun(DriveCycle((int)state.range(0)));
+    ChVectorDynamic<> times(10000);
+    for (int i = 0; i < times.size(); i++)
+        times(i) = (0.1 * state.range(0) + 2) * i / times.size();
+    ChVectorDynamic<> y;
+    for (auto _ : state) {
+        fun.Get_y_dx(times, y);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * times.size());
+}
+BENCHMARK(BM_Compiled_sweep)->Arg(1000)->Arg(10000)->Arg(100000);
+
+BENCHMARK_MAIN();
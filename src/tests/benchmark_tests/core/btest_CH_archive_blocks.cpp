@@ -0,0 +1,166 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark for the serialization of large arrays in binary archives, with
+// arrays of plain data written and read as memory blocks or element by element.
+// The archived data corresponds to a mesh with 1M nodes (positions, velocities
+// and nodal values) and hexahedral elements (connectivity).
+//
+// =============================================================================
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/core/ChVector.h"
+#include "chrono/serialization/ChArchiveBinary.h"
+
+using namespace chrono;
+
+class MeshData {
+  public:
+    MeshData() {}
+
+    MeshData(int num_nodes) {
+        pos.resize(num_nodes);
+        vel.resize(num_nodes);
+        values.resize(num_nodes);
+        connectivity.resize(8 * (size_t)num_nodes);
+        for (int i = 0; i < num_nodes; i++) {
+            pos[i] = ChVector<>(0.001 * i, 0.002 * i, 0.003 * i);
+            vel[i] = ChVector<>(1, 0, -1);
+            values(i) = 0.5 * i;
+        }
+        for (size_t i = 0; i < connectivity.size(); i++)
+            connectivity[i] = (int)((i * 7919) % num_nodes);
+    }
+
+    size_t GetNumBytes() const {
+        return (pos.size() + vel.size()) * sizeof(ChVector<>) + values.size() * sizeof(double) +
+               connectivity.size() * sizeof(int);
+    }
+
+    void ArchiveOUT(ChArchiveOut& marchive) {
+        marchive << CHNVP(pos);
+        marchive << CHNVP(vel);
+        marchive << CHNVP(values);
+        marchive << CHNVP(connectivity);
+    }
+
+    void ArchiveIN(ChArchiveIn& marchive) {
+        marchive >> CHNVP(pos);
+        marchive >> CHNVP(vel);
+        marchive >> CHNVP(values);
+        marchive >> CHNVP(connectivity);
+    }
+
+    std::vector<ChVector<>> pos;
+    std::vector<ChVector<>> vel;
+    ChVectorDynamic<> values;
+    std::vector<int> connectivity;
+};
+
+static const int num_nodes = 1000000;
+
+static void Write(benchmark::State& state, bool blocks) {
+    MeshData mesh(num_nodes);
+    for (auto _ : state) {
+        std::vector<char> buffer;
+        ChStreamOutBinaryVector stream(&buffer);
+        ChArchiveOutBinary archive(stream);
+        archive.SetUseBlocks(blocks);
+        archive << CHNVP(mesh);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * mesh.GetNumBytes());
+}
+
+static void Read(benchmark::State& state, bool blocks) {
+    MeshData mesh(num_nodes);
+    std::vector<char> buffer;
+    ChStreamOutBinaryVector ostream(&buffer);
+    ChArchiveOutBinary oarchive(ostream);
+    oarchive << CHNVP(mesh);
+
+    for (auto _ : state) {
+        MeshData mesh_in;
+        ChStreamInBinaryVector stream(&buffer);
+        ChArchiveInBinary archive(stream);
+        archive.SetUseBlocks(blocks);
+        archive >> CHNVP(mesh_in);
+        benchmark::DoNotOptimize(mesh_in.pos.data());
+    }
+    state.SetBytesProcessed(state.iterations() * mesh.GetNumBytes());
+}
+
+static void ReadFile(benchmark::State& state, bool mapped) {
+    const std::string filename = "btest_archive_blocks.dat";
+    MeshData mesh(num_nodes);
+    {
+        ChStreamOutBinaryFile ostream(filename.c_str());
+        ChArchiveOutBinary oarchive(ostream);
+        oarchive << CHNVP(mesh);
+    }
+
+    for (auto _ : state) {
+        MeshData mesh_in;
+        if (mapped) {
+            ChStreamInBinaryMappedFile stream(filename.c_str());
+            ChArchiveInBinary archive(stream);
+            archive >> CHNVP(mesh_in);
+        } else {
+            ChStreamInBinaryFile stream(filename.c_str());
+            ChArchiveInBinary archive(stream);
+            archive >> CHNVP(mesh_in);
+        }
+        benchmark::DoNotOptimize(mesh_in.pos.data());
+    }
+    state.SetBytesProcessed(state.iterations() * mesh.GetNumBytes());
+
+    std::remove(filename.c_str());
+}
+
+static void BM_Write_elements(benchmark::State& state) {
+    Write(state, false);
+}
+BENCHMARK(BM_Write_elements)->Unit(benchmark::kMillisecond);
+
+static void BM_Write_blocks(benchmark::State& state) {
+    Write(state, true);
+}
+BENCHMARK(BM_Write_blocks)->Unit(benchmark::kMillisecond);
+
+static void BM_Read_elements(benchmark::State& state) {
+    Read(state, false);
+}
+BENCHMARK(BM_Read_elements)->Unit(benchmark::kMillisecond);
+
+static void BM_Read_blocks(benchmark::State& state) {
+    Read(state, true);
+}
+BENCHMARK(BM_Read_blocks)->Unit(benchmark::kMillisecond);
+
+static void BM_ReadFile_stream(benchmark::State& state) {
+    ReadFile(state, false);
+}
+BENCHMARK(BM_ReadFile_stream)->Unit(benchmark::kMillisecond);
+
+static void BM_ReadFile_mapped(benchmark::State& state) {
+    ReadFile(state, true);
+}
+BENCHMARK(BM_ReadFile_mapped)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -14,7 +14,7 @@
 //
 // Benchmark test for sparse matrix setup (assembly of system matrix).
 // This provides a measure of the effect and performance of using the "sparsity
-// learner".
+// learner" and the cached matrix assembly.
 //
 // =============================================================================
 
@@ -175,6 +175,26 @@ class SystemFixture : public ::benchmark::Fixture {
     }                                                                                 \
     BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
 
+// Sparse LU solver with locked sparsity pattern, with and without cached matrix assembly.
+// Unlike the tests above, the sparsity pattern is not re-evaluated at each iteration.
+#define BM_SOLVER_LU_CACHE(TEST_NAME, N, WITH_CACHE)                                  \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        auto solver = chrono_types::make_shared<ChSolverSparseLU>();                  \
+        solver->UseSparsityPatternLearner(true);                                      \
+        solver->LockSparsityPattern(true);                                            \
+        solver->UseCachedAssembly(WITH_CACHE);                                        \
+        solver->SetVerbose(false);                                                    \
+        m_system->SetSolver(solver);                                                  \
+        m_system->DoStaticLinear();                                                   \
+        solver->ResetTimers();                                                        \
+        m_system->ResetTimers();                                                      \
+        while (st.KeepRunning()) {                                                    \
+            m_system->DoStaticLinear();                                               \
+        }                                                                             \
+        Report(st);                                                                   \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
 #ifdef CHRONO_PARDISO_MKL
 BM_SOLVER_MKL(MKL_learner_500, 500, true)
 BM_SOLVER_MKL(MKL_no_learner_500, 500, false)
@@ -225,6 +245,13 @@ BM_SOLVER_QR(QR_no_learner_4000, 4000, false)
 BM_SOLVER_QR(QR_learner_8000, 8000, true)
 BM_SOLVER_QR(QR_no_learner_8000, 8000, false)
 
+BM_SOLVER_LU_CACHE(LU_no_cache_1000, 1000, false)
+BM_SOLVER_LU_CACHE(LU_cache_1000, 1000, true)
+BM_SOLVER_LU_CACHE(LU_no_cache_4000, 4000, false)
+BM_SOLVER_LU_CACHE(LU_cache_4000, 4000, true)
+BM_SOLVER_LU_CACHE(LU_no_cache_8000, 8000, false)
+BM_SOLVER_LU_CACHE(LU_cache_8000, 8000, true)
+
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
@@ -10,6 +10,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <iostream>
 #include <benchmark/benchmark.h>
 
@@ -97,6 +98,57 @@ BENCHMARK_DEFINE_F(SystemFixture, SingleLoop)(benchmark::State& st) {
     st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
 }
 BENCHMARK_REGISTER_F(SystemFixture, SingleLoop)->Unit(benchmark::kMicrosecond);
+
+// Configure the per-item passes of the system assembly: serial baseline for 0 threads, otherwise parallel passes with
+// the specified number of Chrono threads
+static void SetAssemblyThreads(ChSystem* sys, int num_threads) {
+    sys->SetUseParallelUpdate(num_threads > 0);
+    sys->SetNumThreads(std::max(num_threads, 1));
+}
+
+// Numbers of threads for the assembly benchmarks (0: serial baseline), timed with wall clock time, since the CPU time
+// of the main thread does not account for the work done by the other threads
+static void AssemblyThreadArgs(benchmark::internal::Benchmark* b) {
+    b->ArgName("threads")->UseRealTime();
+    for (int num_threads : {0, 1, 2, 4, 8})
+        b->Arg(num_threads);
+}
+
+// Benchmark the per-body passes of the system assembly (serial, or parallel with the specified number of threads)
+BENCHMARK_DEFINE_F(SystemFixture, AssemblyUpdate)(benchmark::State& st) {
+    SetAssemblyThreads(sys, (int)st.range(0));
+    for (auto _ : st) {
+        sys->Update(current_time, false);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(SystemFixture, AssemblyUpdate)->Unit(benchmark::kMicrosecond)->Apply(AssemblyThreadArgs);
+
+BENCHMARK_DEFINE_F(SystemFixture, AssemblyStateScatter)(benchmark::State& st) {
+    SetAssemblyThreads(sys, (int)st.range(0));
+    sys->Setup();
+    ChState x(sys->GetNcoords_x(), sys);
+    ChStateDelta v(sys->GetNcoords_v(), sys);
+    double t;
+    sys->StateGather(x, v, t);
+    for (auto _ : st) {
+        sys->StateScatter(x, v, current_time, false);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(SystemFixture, AssemblyStateScatter)->Unit(benchmark::kMicrosecond)->Apply(AssemblyThreadArgs);
+
+BENCHMARK_DEFINE_F(SystemFixture, AssemblyLoadResidual_F)(benchmark::State& st) {
+    SetAssemblyThreads(sys, (int)st.range(0));
+    sys->Setup();
+    ChVectorDynamic<> R(sys->GetNcoords_v());
+    for (auto _ : st) {
+        R.setZero();
+        sys->LoadResidual_F(R, 1.0);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+BENCHMARK_REGISTER_F(SystemFixture, AssemblyLoadResidual_F)->Unit(benchmark::kMicrosecond)->Apply(AssemblyThreadArgs);
 ////BENCHMARK_REGISTER_F(SystemFixture, SingleLoop)->Unit(benchmark::kMicrosecond)->Iterations(1);
 
 ////BENCHMARK_MAIN();
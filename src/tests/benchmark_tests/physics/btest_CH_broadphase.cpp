@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark test comparing the broadphase algorithms of the Chrono collision
+// system (uniform grid vs. incremental dynamic AABB tree) on a settled pile of
+// spheres in a box. The collision detection timers (CD_Broad in particular)
+// are reported for each case.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// =============================================================================
+
+template <int N, ChBroadphase::Algorithm ALGORITHM>
+class SettledPileTest : public utils::ChBenchmarkTest {
+  public:
+    SettledPileTest();
+    ~SettledPileTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemSMC* m_system;
+    double m_step;
+};
+
+template <int N, ChBroadphase::Algorithm ALGORITHM>
+SettledPileTest<N, ALGORITHM>::SettledPileTest() : m_system(new ChSystemSMC()), m_step(1e-4) {
+    m_system->SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    m_system->Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(m_system->GetCollisionSystem());
+    collsys->SetBroadphaseGridDensity(2);
+    collsys->SetBroadphaseAlgorithm(ALGORITHM);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.5f);
+    mat->SetYoungModulus(1e7f);
+    mat->SetRestitution(0.0f);
+
+    // Container (floor and walls)
+    double hdim = 0.1 * N;
+    double hthick = 0.1;
+    double height = 0.1 * N;
+    auto container = chrono_types::make_shared<ChBody>(ChCollisionSystemType::CHRONO);
+    container->SetBodyFixed(true);
+    container->SetCollide(true);
+    container->GetCollisionModel()->ClearModel();
+    container->GetCollisionModel()->AddBox(mat, hdim, hthick, hdim, ChVector<>(0, -hthick, 0));
+    container->GetCollisionModel()->AddBox(mat, hthick, height, hdim, ChVector<>(-hdim - hthick, height, 0));
+    container->GetCollisionModel()->AddBox(mat, hthick, height, hdim, ChVector<>(+hdim + hthick, height, 0));
+    container->GetCollisionModel()->AddBox(mat, hdim, height, hthick, ChVector<>(0, height, -hdim - hthick));
+    container->GetCollisionModel()->AddBox(mat, hdim, height, hthick, ChVector<>(0, height, +hdim + hthick));
+    container->GetCollisionModel()->BuildModel();
+    m_system->AddBody(container);
+
+    // N x N x N spheres of radius 0.05, in a slightly perturbed lattice
+    double radius = 0.05;
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < N; k++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, mat, ChCollisionSystemType::CHRONO);
+                ball->SetPos(ChVector<>(-hdim + radius + 2.01 * radius * i + 0.002 * (k % 2),
+                                        radius + 2.01 * radius * k,
+                                        -hdim + radius + 2.01 * radius * j + 0.002 * (k % 2)));
+                m_system->AddBody(ball);
+            }
+        }
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 5000  // number of steps for hot start (settling of the pile)
+#define NUM_SIM_STEPS 500    // number of simulation steps for each benchmark
+
+using SettledPileGrid10 = SettledPileTest<10, ChBroadphase::Algorithm::GRID>;
+using SettledPileTree10 = SettledPileTest<10, ChBroadphase::Algorithm::AABB_TREE>;
+using SettledPileGrid20 = SettledPileTest<20, ChBroadphase::Algorithm::GRID>;
+using SettledPileTree20 = SettledPileTest<20, ChBroadphase::Algorithm::AABB_TREE>;
+
+CH_BM_SIMULATION_LOOP(PileGrid10, SettledPileGrid10, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(PileTree10, SettledPileTree10, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(PileGrid20, SettledPileGrid20, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(PileTree20, SettledPileTree20, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+BENCHMARK_MAIN();
@@ -16,6 +16,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/utils/ChBenchmark.h"
 
@@ -93,6 +95,47 @@ BM_LINK_OP_VOID(UpdateState_LinkLock, ChLinkLock, UpdateState)
 BM_LINK_OP_TIME(Update_LinkMarkers, ChLinkMarkers, Update)
 BM_LINK_OP_TIME(Update_LinkLock, ChLinkLock, Update)
 
+// Configure the per-item passes of the system assembly: serial baseline for 0 threads, otherwise parallel passes with
+// the specified number of Chrono threads
+static void SetAssemblyThreads(ChSystem* sys, int num_threads) {
+    sys->SetUseParallelUpdate(num_threads > 0);
+    sys->SetNumThreads(std::max(num_threads, 1));
+}
+
+// Numbers of threads for the assembly benchmarks (0: serial baseline), timed with wall clock time, since the CPU time
+// of the main thread does not account for the work done by the other threads
+static void AssemblyThreadArgs(benchmark::internal::Benchmark* b) {
+    b->ArgName("threads")->UseRealTime();
+    for (int num_threads : {0, 1, 2, 4, 8})
+        b->Arg(num_threads);
+}
+
+// Benchmark the per-item passes of the system assembly (bodies and joints), serial or parallel with the specified
+// number of threads
+
+BENCHMARK_DEFINE_F(LinkLockBM, AssemblyUpdate)(benchmark::State& st) {
+    SetAssemblyThreads(sys, (int)st.range(0));
+    for (auto _ : st) {
+        sys->Update(crt_time, false);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_linklist().size());
+}
+BENCHMARK_REGISTER_F(LinkLockBM, AssemblyUpdate)->Unit(benchmark::kMicrosecond)->Apply(AssemblyThreadArgs);
+
+BENCHMARK_DEFINE_F(LinkLockBM, AssemblyStateScatter)(benchmark::State& st) {
+    SetAssemblyThreads(sys, (int)st.range(0));
+    sys->Setup();
+    ChState x(sys->GetNcoords_x(), sys);
+    ChStateDelta v(sys->GetNcoords_v(), sys);
+    double t;
+    sys->StateGather(x, v, t);
+    for (auto _ : st) {
+        sys->StateScatter(x, v, crt_time, false);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_linklist().size());
+}
+BENCHMARK_REGISTER_F(LinkLockBM, AssemblyStateScatter)->Unit(benchmark::kMicrosecond)->Apply(AssemblyThreadArgs);
+
 // Main function
 
 BENCHMARK_MAIN();
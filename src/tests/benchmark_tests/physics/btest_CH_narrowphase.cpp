@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark test for the narrowphase of the Chrono collision system.
+// A dense lattice of alternating spheres and boxes (about 1M candidate pairs)
+// is processed with and without batching of the candidate pairs (see
+// ChCollisionSystemChrono::EnableNarrowphaseBatching). The number of candidate
+// pairs processed per second by the narrowphase is reported.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "benchmark/benchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// =============================================================================
+
+// Create an N x N x N lattice of alternating spheres and boxes, with each shape AABB overlapping those of all its
+// neighbors (i.e., about 13 candidate pairs per shape).
+static void CreateLattice(ChSystemNSC& sys, int N) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    double spacing = 0.19;
+    for (int i = 0; i < N; i++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < N; k++) {
+                std::shared_ptr<ChBody> body;
+                if ((i + j + k) % 2 == 0)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, mat, ChCollisionSystemType::CHRONO);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, mat,
+                                                                   ChCollisionSystemType::CHRONO);
+                body->SetPos(ChVector<>(spacing * i, spacing * j + 0.01 * (i % 3), spacing * k));
+                body->SetRot(Q_from_AngAxis(0.1 * (i + 2 * j + 3 * k), ChVector<>(1, 1, 0).GetNormalized()));
+                sys.AddBody(body);
+            }
+        }
+    }
+}
+
+template <bool BATCHED>
+static void Narrowphase(benchmark::State& state) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetBroadphaseGridDensity(4);
+    collsys->SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm::HYBRID);
+    collsys->EnableNarrowphaseBatching(BATCHED);
+
+    CreateLattice(sys, (int)state.range(0));
+
+    // Synchronize the collision models and run the collision detection once
+    sys.ComputeCollisions();
+    double num_pairs = (double)collsys->GetOverlappingPairs().size();
+
+    double time_narrow = 0;
+    for (auto _ : state) {
+        collsys->Run();
+        time_narrow += collsys->GetTimerCollisionNarrow();
+    }
+
+    state.counters["Pairs"] = num_pairs;
+    state.counters["Contacts"] = sys.GetNcontacts();
+    state.counters["CD_Narrow"] = 1e3 * time_narrow / state.iterations();
+    state.counters["PairsPerSec"] = num_pairs * state.iterations() / time_narrow;
+}
+
+BENCHMARK_TEMPLATE(Narrowphase, false)->Unit(benchmark::kMillisecond)->Arg(20)->Arg(44);
+BENCHMARK_TEMPLATE(Narrowphase, true)->Unit(benchmark::kMillisecond)->Arg(20)->Arg(44);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,146 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark for the exchange of vehicle state messages with SynMPICommunicator,
+// comparing the default all-to-all exchange with interest management.
+//
+// Each rank owns a cluster of synthetic vehicles. Clusters are placed along a
+// line, at the specified spacing, and move at constant speed. Run with, e.g.:
+//    mpirun -n 16 btest_SYN_MPI_interest --agents 10 --radius 100
+//
+// =============================================================================
+
+#include <iomanip>
+#include <iostream>
+
+#include "chrono/core/ChTimer.h"
+
+#include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
+#include "chrono_synchrono/flatbuffer/message/SynWheeledVehicleMessage.h"
+
+#include "chrono_thirdparty/cxxopts/ChCLI.h"
+
+using namespace chrono;
+using namespace chrono::synchrono;
+
+// =============================================================================
+
+int num_heartbeats = 200;  // number of synchronizations
+int num_agents = 10;       // number of vehicles per rank
+double radius = 100;       // interest radius
+double spacing = 200;      // distance between the clusters of vehicles of consecutive ranks
+double heartbeat = 1e-2;   // time between synchronizations
+
+// =============================================================================
+
+// Create the state message of the given vehicle at the given time
+std::shared_ptr<SynMessage> CreateStateMessage(int rank, int agent, double time) {
+    auto message = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(rank, agent), AgentKey());
+    message->SetMessageType(SynFlatBuffers::Type_Agent_State);
+
+    ChVector<> vel(10, 0, 0);
+    ChVector<> loc(spacing * rank + time * vel.x(), 5.0 * agent, 0.5);
+    ChFrameMoving<> chassis_frame(loc, QUNIT);
+    chassis_frame.SetPos_dt(vel);
+
+    std::vector<SynPose> wheels;
+    for (int i = 0; i < 4; i++) {
+        ChFrameMoving<> wheel_frame(loc + ChVector<>(i < 2 ? 1.5 : -1.5, i % 2 ? 1 : -1, -0.3),
+                                    Q_from_AngY(vel.x() * time / 0.5));
+        wheel_frame.SetPos_dt(vel);
+        wheels.push_back(SynPose(wheel_frame));
+    }
+
+    message->SetState(time, SynPose(chassis_frame), wheels);
+    return message;
+}
+
+// Run the exchange with the given interest radius and report timing and communication statistics
+void Run(SynMPICommunicator& communicator, double interest_radius, const std::string& label) {
+    int rank = communicator.GetRank();
+
+    communicator.SetInterestRadius(interest_radius);
+    communicator.Barrier();
+
+    ChTimer<> timer;
+    double bytes_sent = 0;
+    double num_received = 0;
+    double num_neighbors = 0;
+
+    for (int k = 0; k < num_heartbeats; k++) {
+        double time = k * heartbeat;
+
+        SynMessageList messages;
+        for (int i = 0; i < num_agents; i++)
+            messages.push_back(CreateStateMessage(rank, i, time));
+
+        timer.start();
+        communicator.AddOutgoingMessages(messages);
+        communicator.Synchronize();
+        num_received += communicator.GetMessages().size();
+        timer.stop();
+
+        bytes_sent += communicator.GetNumBytesSent();
+        num_neighbors += communicator.GetNumNeighbors();
+        communicator.Reset();
+    }
+
+    double local[4] = {timer(), bytes_sent / num_heartbeats, num_received / num_heartbeats,
+                       num_neighbors / num_heartbeats};
+    double max_time;
+    double sum[3];
+    MPI_Reduce(&local[0], &max_time, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Reduce(&local[1], sum, 3, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        int num_ranks = communicator.GetNumRanks();
+        std::cout << std::left << std::setw(20) << label;
+        std::cout << "  time/heartbeat [ms]: " << std::setw(10) << 1e3 * max_time / num_heartbeats;
+        std::cout << "  bytes sent/rank: " << std::setw(10) << sum[0] / num_ranks;
+        std::cout << "  states received/rank: " << std::setw(8) << sum[1] / num_ranks;
+        std::cout << "  neighbors/rank: " << sum[2] / num_ranks << std::endl;
+    }
+}
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    SynMPICommunicator communicator(argc, argv);
+    int rank = communicator.GetRank();
+    int num_ranks = communicator.GetNumRanks();
+
+    ChCLI cli(argv[0]);
+    cli.AddOption<int>("Test", "n,heartbeats", "Number of synchronizations", std::to_string(num_heartbeats));
+    cli.AddOption<int>("Test", "a,agents", "Number of vehicles per rank", std::to_string(num_agents));
+    cli.AddOption<double>("Test", "r,radius", "Interest radius", std::to_string(radius));
+    cli.AddOption<double>("Test", "s,spacing", "Distance between the vehicles of consecutive ranks",
+                          std::to_string(spacing));
+    if (!cli.Parse(argc, argv, rank == 0))
+        return 0;
+
+    num_heartbeats = cli.GetAsType<int>("heartbeats");
+    num_agents = cli.GetAsType<int>("agents");
+    radius = cli.GetAsType<double>("radius");
+    spacing = cli.GetAsType<double>("spacing");
+
+    if (rank == 0) {
+        std::cout << "Ranks: " << num_ranks << "  vehicles/rank: " << num_agents << "  spacing: " << spacing
+                  << "  interest radius: " << radius << std::endl;
+    }
+
+    Run(communicator, 0, "All-to-all");
+    Run(communicator, radius, "Interest management");
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Chrono unit test for the AABB tree broadphase of the Chrono collision system.
+// The candidate pairs and ray intersections obtained with the AABB tree must be
+// the same as those obtained with the broadphase grid, also when bodies (with
+// overlapping shapes of the same body) are added during the simulation.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+class BroadphaseTest {
+  public:
+    BroadphaseTest(ChBroadphase::Algorithm algorithm) {
+        sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+        collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+        collsys->SetBroadphaseAlgorithm(algorithm, 0.05);
+        collsys->SetEnvelope(0.01);
+        mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+        auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, mat, ChCollisionSystemType::CHRONO);
+        ground->SetPos(ChVector<>(0, 0, -0.1));
+        ground->SetBodyFixed(true);
+        sys.AddBody(ground);
+    }
+
+    // Add a layer of bodies: spheres, boxes, and compound bodies with two overlapping spheres.
+    void AddBodies(double height) {
+        for (int i = 0; i < 6; i++) {
+            for (int j = 0; j < 6; j++) {
+                std::shared_ptr<ChBody> body;
+                switch ((i + j) % 3) {
+                    case 0:
+                        body = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, mat,
+                                                                           ChCollisionSystemType::CHRONO);
+                        break;
+                    case 1:
+                        body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.18, 0.16, 1000, mat,
+                                                                       ChCollisionSystemType::CHRONO);
+                        break;
+                    case 2:
+                        body = chrono_types::make_shared<ChBody>(ChCollisionSystemType::CHRONO);
+                        body->GetCollisionModel()->ClearModel();
+                        body->GetCollisionModel()->AddSphere(mat, 0.08, ChVector<>(-0.04, 0, 0));
+                        body->GetCollisionModel()->AddSphere(mat, 0.08, ChVector<>(+0.04, 0, 0));
+                        body->GetCollisionModel()->BuildModel();
+                        body->SetCollide(true);
+                        break;
+                }
+                body->SetPos(ChVector<>(-1.0 + 0.35 * i, -1.0 + 0.37 * j, height));
+                sys.AddBody(body);
+                bodies.push_back(body);
+                init_pos.push_back(body->GetPos());
+            }
+        }
+    }
+
+    // Move all bodies (kinematically) and return the sorted list of candidate pairs.
+    std::vector<std::pair<int, int>> Step(int frame) {
+        double t = 0.01 * frame;
+        for (size_t k = 0; k < bodies.size(); k++) {
+            double phase = 0.7 * k;
+            ChVector<> offset(0.2 * std::sin(3 * t + phase), 0.2 * std::cos(2 * t + phase), -0.4713 * t);
+            bodies[k]->SetPos(init_pos[k] + offset);
+            bodies[k]->SetRot(Q_from_AngZ(t + phase));
+        }
+        sys.ComputeCollisions();
+
+        std::vector<std::pair<int, int>> pairs;
+        for (const auto& p : collsys->GetOverlappingPairs())
+            pairs.push_back(std::make_pair(p.x, p.y));
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChCollisionSystemChrono> collsys;
+    std::shared_ptr<ChMaterialSurface> mat;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    std::vector<ChVector<>> init_pos;
+};
+
+TEST(ChCollisionSystemChrono, broadphase_tree_pairs) {
+    BroadphaseTest grid(ChBroadphase::Algorithm::GRID);
+    BroadphaseTest tree(ChBroadphase::Algorithm::AABB_TREE);
+
+    // Layer heights and sinking velocity chosen so that shape AABBs never touch exactly (the grid may or may not
+    // report such pairs, depending on the location of the bin boundaries)
+    grid.AddBodies(0.0531);
+    tree.AddBodies(0.0531);
+
+    for (int frame = 0; frame < 40; frame++) {
+        // Add new bodies during the simulation
+        if (frame == 10 || frame == 25) {
+            grid.AddBodies(0.2637);
+            tree.AddBodies(0.2637);
+        }
+
+        auto pairs_grid = grid.Step(frame);
+        auto pairs_tree = tree.Step(frame);
+        ASSERT_GT(pairs_grid.size(), 0);
+        ASSERT_TRUE(pairs_grid == pairs_tree) << "frame " << frame;
+    }
+}
+
+TEST(ChCollisionSystemChrono, broadphase_tree_ray) {
+    BroadphaseTest grid(ChBroadphase::Algorithm::GRID);
+    BroadphaseTest tree(ChBroadphase::Algorithm::AABB_TREE);
+
+    grid.AddBodies(0.05);
+    tree.AddBodies(0.05);
+    grid.Step(5);
+    tree.Step(5);
+
+    std::vector<ChVector<>> from;
+    std::vector<ChVector<>> to;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            from.push_back(ChVector<>(-1.3 + 0.13 * i, -1.3 + 0.135 * j, 1.0));
+            to.push_back(ChVector<>(-1.2 + 0.13 * i, -1.4 + 0.135 * j, -1.0));
+        }
+    }
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results_grid;
+    std::vector<ChCollisionSystem::ChRayhitResult> results_tree;
+    grid.collsys->RayHitBatch(from, to, results_grid, 1);
+    tree.collsys->RayHitBatch(from, to, results_tree, 1);
+
+    int num_hits = 0;
+    for (size_t i = 0; i < from.size(); i++) {
+        ASSERT_EQ(results_grid[i].hit, results_tree[i].hit);
+        if (!results_grid[i].hit)
+            continue;
+        num_hits++;
+        ASSERT_NEAR((results_grid[i].abs_hitPoint - results_tree[i].abs_hitPoint).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((results_grid[i].abs_hitNormal - results_tree[i].abs_hitNormal).Length(), 0.0, 1e-10);
+    }
+    ASSERT_EQ(num_hits, (int)from.size());
+
+    ChCollisionSystem::ChRayhitResult result;
+    ASSERT_TRUE(tree.collsys->RayHit(ChVector<>(0.1, 0.1, 1), ChVector<>(0.1, 0.1, -1), result));
+    ASSERT_TRUE(result.hit);
+}
@@ -0,0 +1,198 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Chrono unit test for static triangle meshes represented through a BVH in the
+// Chrono collision system. The contacts and ray intersections with a static
+// mesh must be the same as those obtained with individual triangle shapes.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+struct ContactData {
+    int idA;
+    int idB;
+    ChVector<> pA;
+    ChVector<> pB;
+    ChVector<> normal;
+    double distance;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& cforce,
+                                 const ChVector<>& ctorque,
+                                 ChContactable* modA,
+                                 ChContactable* modB) override {
+        auto bodyA = static_cast<ChBody*>(modA);
+        auto bodyB = static_cast<ChBody*>(modB);
+        contacts.push_back({bodyA->GetIdentifier(), bodyB->GetIdentifier(), pA, pB, plane_coord.Get_A_Xaxis(), distance});
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+// Create a fixed body with a (wavy) triangulated grid as static mesh.
+static std::shared_ptr<ChBody> CreateGround(std::shared_ptr<ChMaterialSurface> mat) {
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+    int n = 16;
+    double delta = 0.25;
+    auto height = [](double x, double y) { return 0.05 * std::sin(2 * x) * std::cos(3 * y); };
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double x0 = -2 + i * delta;
+            double y0 = -2 + j * delta;
+            double x1 = x0 + delta;
+            double y1 = y0 + delta;
+            ChVector<> v00(x0, y0, height(x0, y0));
+            ChVector<> v10(x1, y0, height(x1, y0));
+            ChVector<> v11(x1, y1, height(x1, y1));
+            ChVector<> v01(x0, y1, height(x0, y1));
+            trimesh->addTriangle(v00, v10, v11);
+            trimesh->addTriangle(v00, v11, v01);
+        }
+    }
+
+    auto ground = chrono_types::make_shared<ChBody>(ChCollisionSystemType::CHRONO);
+    ground->SetIdentifier(-1);
+    ground->SetPos(ChVector<>(0.1, 0.2, -0.05));
+    ground->SetRot(Q_from_AngZ(0.3));
+    ground->SetBodyFixed(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddTriangleMesh(mat, trimesh, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    ground->SetCollide(true);
+
+    return ground;
+}
+
+static std::vector<ContactData> Collide(bool use_bvh, ChBroadphase::Algorithm algorithm) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetBroadphaseAlgorithm(algorithm);
+    collsys->SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm::HYBRID);
+    collsys->EnableMeshBVH(use_bvh);
+    collsys->SetEnvelope(0.01);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    sys.AddBody(CreateGround(mat));
+
+    int id = 0;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            std::shared_ptr<ChBody> body;
+            if ((i + j) % 2 == 0)
+                body = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, mat, ChCollisionSystemType::CHRONO);
+            else
+                body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.18, 0.16, 1000, mat,
+                                                               ChCollisionSystemType::CHRONO);
+            body->SetIdentifier(id++);
+            body->SetPos(ChVector<>(-1.5 + 0.41 * i, -1.5 + 0.43 * j, 0.02 + 0.01 * ((i + 2 * j) % 5)));
+            body->SetRot(Q_from_AngAxis(0.2 * (i + 2 * j), ChVector<>(1, 1, 0).GetNormalized()));
+            sys.AddBody(body);
+        }
+    }
+
+    sys.ComputeCollisions();
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+
+    auto& contacts = collector->contacts;
+    std::sort(contacts.begin(), contacts.end(), [](const ContactData& a, const ContactData& b) {
+        if (a.idA != b.idA)
+            return a.idA < b.idA;
+        if (a.idB != b.idB)
+            return a.idB < b.idB;
+        if (a.pA.x() != b.pA.x())
+            return a.pA.x() < b.pA.x();
+        if (a.pA.y() != b.pA.y())
+            return a.pA.y() < b.pA.y();
+        return a.pA.z() < b.pA.z();
+    });
+    return contacts;
+}
+
+static void CompareContacts(ChBroadphase::Algorithm algorithm) {
+    auto contacts_ref = Collide(false, algorithm);
+    auto contacts = Collide(true, algorithm);
+
+    ASSERT_GT(contacts_ref.size(), 0);
+    ASSERT_EQ(contacts_ref.size(), contacts.size());
+    for (size_t i = 0; i < contacts.size(); i++) {
+        ASSERT_EQ(contacts_ref[i].idA, contacts[i].idA);
+        ASSERT_EQ(contacts_ref[i].idB, contacts[i].idB);
+        ASSERT_NEAR((contacts_ref[i].pA - contacts[i].pA).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((contacts_ref[i].pB - contacts[i].pB).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((contacts_ref[i].normal - contacts[i].normal).Length(), 0.0, 1e-10);
+        ASSERT_NEAR(contacts_ref[i].distance, contacts[i].distance, 1e-10);
+    }
+}
+
+TEST(ChCollisionSystemChrono, mesh_bvh_grid) {
+    CompareContacts(ChBroadphase::Algorithm::GRID);
+}
+
+TEST(ChCollisionSystemChrono, mesh_bvh_tree) {
+    CompareContacts(ChBroadphase::Algorithm::AABB_TREE);
+}
+
+TEST(ChCollisionSystemChrono, mesh_bvh_ray) {
+    std::vector<ChVector<>> from;
+    std::vector<ChVector<>> to;
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            from.push_back(ChVector<>(-1.2 + 0.27 * i, -1.2 + 0.26 * j, 1.0));
+            to.push_back(ChVector<>(-1.1 + 0.27 * i, -1.3 + 0.26 * j, -1.0));
+        }
+    }
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results[2];
+    for (int k = 0; k < 2; k++) {
+        ChSystemNSC sys;
+        sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+        auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+        collsys->EnableMeshBVH(k == 1);
+
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        sys.AddBody(CreateGround(mat));
+        sys.ComputeCollisions();
+
+        collsys->RayHitBatch(from, to, results[k], 1);
+    }
+
+    for (size_t i = 0; i < from.size(); i++) {
+        ASSERT_TRUE(results[0][i].hit);
+        ASSERT_TRUE(results[1][i].hit);
+        ASSERT_NEAR((results[0][i].abs_hitPoint - results[1][i].abs_hitPoint).Length(), 0.0, 1e-10);
+    }
+}
@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Chrono unit test for batched narrowphase collision detection.
+// The contacts generated for a lattice of spheres, boxes, and capsules must be
+// the same with and without batching of the candidate pairs.
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+struct ContactData {
+    int idA;
+    int idB;
+    ChVector<> pA;
+    ChVector<> pB;
+    ChVector<> normal;
+    double distance;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& cforce,
+                                 const ChVector<>& ctorque,
+                                 ChContactable* modA,
+                                 ChContactable* modB) override {
+        auto bodyA = static_cast<ChBody*>(modA);
+        auto bodyB = static_cast<ChBody*>(modB);
+        contacts.push_back({bodyA->GetIdentifier(), bodyB->GetIdentifier(), pA, pB, plane_coord.Get_A_Xaxis(), distance});
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+static std::vector<ContactData> Collide(bool batched) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm::HYBRID);
+    collsys->EnableNarrowphaseBatching(batched);
+    collsys->SetEnvelope(0.01);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    int id = 0;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            for (int k = 0; k < 6; k++) {
+                std::shared_ptr<ChBody> body;
+                switch ((i + 2 * j + k) % 3) {
+                    case 0:
+                        body = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, mat, ChCollisionSystemType::CHRONO);
+                        break;
+                    case 1:
+                        body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.18, 0.16, 1000, mat,
+                                                                       ChCollisionSystemType::CHRONO);
+                        break;
+                    default:
+                        body = chrono_types::make_shared<ChBody>(ChCollisionSystemType::CHRONO);
+                        body->GetCollisionModel()->ClearModel();
+                        body->GetCollisionModel()->AddCapsule(mat, 0.06, 0.04);
+                        body->GetCollisionModel()->BuildModel();
+                        body->SetCollide(true);
+                        break;
+                }
+                body->SetIdentifier(id++);
+                body->SetPos(ChVector<>(0.19 * i, 0.19 * j + 0.01 * (i % 3), 0.19 * k));
+                body->SetRot(Q_from_AngAxis(0.3 * (i + 2 * j + 3 * k), ChVector<>(1, 1, 0).GetNormalized()));
+                sys.AddBody(body);
+            }
+        }
+    }
+
+    sys.ComputeCollisions();
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+
+    auto& contacts = collector->contacts;
+    std::sort(contacts.begin(), contacts.end(), [](const ContactData& a, const ContactData& b) {
+        if (a.idA != b.idA)
+            return a.idA < b.idA;
+        if (a.idB != b.idB)
+            return a.idB < b.idB;
+        if (a.pA.x() != b.pA.x())
+            return a.pA.x() < b.pA.x();
+        if (a.pA.y() != b.pA.y())
+            return a.pA.y() < b.pA.y();
+        return a.pA.z() < b.pA.z();
+    });
+    return contacts;
+}
+
+TEST(ChNarrowphase, batched) {
+    auto contacts_ref = Collide(false);
+    auto contacts = Collide(true);
+
+    ASSERT_GT(contacts_ref.size(), 0);
+    ASSERT_EQ(contacts_ref.size(), contacts.size());
+    for (size_t i = 0; i < contacts.size(); i++) {
+        ASSERT_EQ(contacts_ref[i].idA, contacts[i].idA);
+        ASSERT_EQ(contacts_ref[i].idB, contacts[i].idB);
+        ASSERT_NEAR((contacts_ref[i].pA - contacts[i].pA).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((contacts_ref[i].pB - contacts[i].pB).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((contacts_ref[i].normal - contacts[i].normal).Length(), 0.0, 1e-10);
+        ASSERT_NEAR(contacts_ref[i].distance, contacts[i].distance, 1e-10);
+    }
+}
@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for ChFunction_Compiled.
+// Compiled functions must return the same values and derivatives as the
+// original function trees.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/motion_functions/ChFunction.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static void Compare(std::shared_ptr<ChFunction> fun, const ChFunction_Compiled& cfun, double xmin, double xmax) {
+    const int num = 997;
+    for (int i = 0; i <= num; i++) {
+        double x = xmin + (xmax - xmin) * i / num;
+        ASSERT_NEAR(cfun.Get_y(x), fun->Get_y(x), 1e-9);
+        ASSERT_NEAR(cfun.Get_y_dx(x), fun->Get_y_dx(x), 1e-5);
+    }
+}
+
+static std::shared_ptr<ChFunction_Recorder> DriveCycle(int num_points) {
+    auto recorder = chrono_types::make_shared<ChFunction_Recorder>();
+    for (int i = 0; i < num_points; i++) {
+        double t = 0.1 * i;
+        recorder->AddPoint(t, 10 * std::sin(0.05 * t) + std::sin(t));
+    }
+    return recorder;
+}
+
+TEST(ChFunction_Compiled, recorder) {
+    auto recorder = DriveCycle(1000);
+    ChFunction_Compiled cfun(recorder);
+    ASSERT_EQ(cfun.GetNumNodes(), 1);
+    ASSERT_EQ(cfun.GetNumLeaves(), 0);
+    Compare(recorder, cfun, -1, 101);
+
+    // Random access
+    for (double x : {73.4, 2.05, 99.9, 0.0, 50.0, 0.05, 100.0})
+        ASSERT_NEAR(cfun.Get_y(x), recorder->Get_y(x), 1e-9);
+}
+
+TEST(ChFunction_Compiled, operation) {
+    auto sine = chrono_types::make_shared<ChFunction_Sine>(0, 0.5, 2);
+    auto ramp = chrono_types::make_shared<ChFunction_Ramp>(1, 0.3);
+
+    auto mul = chrono_types::make_shared<ChFunction_Operation>();
+    mul->Set_optype(ChFunction_Operation::ChOP_MUL);
+    mul->Set_fa(sine);
+    mul->Set_fb(DriveCycle(200));
+
+    auto sum = chrono_types::make_shared<ChFunction_Operation>();
+    sum->Set_optype(ChFunction_Operation::ChOP_ADD);
+    sum->Set_fa(mul);
+    sum->Set_fb(ramp);
+
+    auto fun = chrono_types::make_shared<ChFunction_Operation>();
+    fun->Set_optype(ChFunction_Operation::ChOP_FUNCT);
+    fun->Set_fa(sum);
+    fun->Set_fb(chrono_types::make_shared<ChFunction_Const>(0.5));
+
+    ChFunction_Compiled cfun(sum);
+    ASSERT_EQ(cfun.GetNumLeaves(), 2);
+    Compare(sum, cfun, 0, 25);
+
+    ChFunction_Compiled cfun2(fun);
+    Compare(fun, cfun2, 0, 25);
+
+    // The compiled function is a frozen copy
+    double y = cfun.Get_y(1.0);
+    sine->Set_amp(10);
+    ASSERT_EQ(cfun.Get_y(1.0), y);
+}
+
+TEST(ChFunction_Compiled, sequence) {
+    auto seq = chrono_types::make_shared<ChFunction_Sequence>();
+    seq->InsertFunct(chrono_types::make_shared<ChFunction_Ramp>(0, 1), 1.0, 1, true);
+    seq->InsertFunct(chrono_types::make_shared<ChFunction_Const>(0), 0.5, 1, true);
+    seq->InsertFunct(DriveCycle(50), 4.0, 1, true);
+    seq->InsertFunct(chrono_types::make_shared<ChFunction_Sine>(0, 1, 0.2), 2.0, 1, true, true);
+    seq->Setup();
+
+    ChFunction_Compiled cfun(seq);
+    ASSERT_EQ(cfun.GetNumLeaves(), 2);
+    Compare(seq, cfun, -1, 9);
+
+    for (int i = 0; i <= 100; i++) {
+        double x = 0.08 * i;
+        ASSERT_NEAR(cfun.Get_y_dxdx(x), seq->Get_y_dxdx(x), 1e-3);
+    }
+}
+
+TEST(ChFunction_Compiled, batch) {
+    auto recorder = DriveCycle(500);
+    ChFunction_Compiled cfun(recorder);
+
+    ChVectorDynamic<> x(300);
+    for (int i = 0; i < x.size(); i++)
+        x(i) = 0.17 * i;
+
+    ChVectorDynamic<> y;
+    ChVectorDynamic<> y_dx;
+    cfun.Get_y(x, y);
+    cfun.Get_y_dx(x, y_dx);
+    ASSERT_EQ(y.size(), x.size());
+    ASSERT_EQ(y_dx.size(), x.size());
+    for (int i = 0; i < x.size(); i++) {
+        ASSERT_NEAR(y(i), recorder->Get_y(x(i)), 1e-9);
+        ASSERT_NEAR(y_dx(i), recorder->Get_y_dx(x(i)), 1e-5);
+    }
+}
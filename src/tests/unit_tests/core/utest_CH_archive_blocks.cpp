@@ -0,0 +1,187 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the serialization of arrays of plain data as memory blocks in
+// binary archives.
+// Archives written with and without blocks must be identical, and must be read
+// back correctly, also through a memory-mapped input stream.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChMatrix33.h"
+#include "chrono/core/ChQuaternion.h"
+#include "chrono/core/ChVector.h"
+#include "chrono/serialization/ChArchiveBinary.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class MeshData {
+  public:
+    MeshData() {}
+
+    MeshData(int n) {
+        for (int i = 0; i < n; i++) {
+            pos.push_back(ChVector<>(0.1 * i, 0.2 * i, -0.3 * i));
+            rot.push_back(Q_from_AngZ(0.01 * i));
+            ids.push_back(3 * i);
+            names.push_back(std::to_string(i));
+        }
+        state.resize(2 * n);
+        for (int i = 0; i < 2 * n; i++)
+            state(i) = 1.5 * i;
+        mat.resize(3, n);
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < n; j++)
+                mat(i, j) = i - 0.5 * j;
+        inertia = ChMatrix33<>(ChVector<>(1, 2, 3));
+        for (int i = 0; i < 4; i++)
+            fixed[i] = 0.25f * i;
+        single = ChVector<>(1, 2, 3);
+    }
+
+    void ArchiveOUT(ChArchiveOut& marchive) {
+        marchive << CHNVP(pos);
+        marchive << CHNVP(rot);
+        marchive << CHNVP(ids);
+        marchive << CHNVP(names);
+        marchive << CHNVP(state);
+        marchive << CHNVP(mat);
+        marchive << CHNVP(inertia);
+        marchive << CHNVP(fixed);
+        // a single vector, after the arrays of vectors
+        marchive << CHNVP(single);
+    }
+
+    void ArchiveIN(ChArchiveIn& marchive) {
+        marchive >> CHNVP(pos);
+        marchive >> CHNVP(rot);
+        marchive >> CHNVP(ids);
+        marchive >> CHNVP(names);
+        marchive >> CHNVP(state);
+        marchive >> CHNVP(mat);
+        marchive >> CHNVP(inertia);
+        marchive >> CHNVP(fixed);
+        marchive >> CHNVP(single);
+    }
+
+    void Check(const MeshData& other) const {
+        ASSERT_TRUE(pos == other.pos);
+        ASSERT_TRUE(rot == other.rot);
+        ASSERT_TRUE(ids == other.ids);
+        ASSERT_TRUE(names == other.names);
+        ASSERT_TRUE(state == other.state);
+        ASSERT_TRUE(mat == other.mat);
+        ASSERT_TRUE(inertia == other.inertia);
+        for (int i = 0; i < 4; i++)
+            ASSERT_EQ(fixed[i], other.fixed[i]);
+        ASSERT_TRUE(single == other.single);
+    }
+
+    std::vector<ChVector<>> pos;
+    std::vector<ChQuaternion<>> rot;
+    std::vector<int> ids;
+    std::vector<std::string> names;
+    ChVectorDynamic<> state;
+    ChMatrixDynamic<> mat;
+    ChMatrix33<> inertia;
+    float fixed[4];
+    ChVector<> single;
+};
+
+static std::vector<char> Write(MeshData& data, bool blocks, bool cluster_versions = true) {
+    std::vector<char> buffer;
+    ChStreamOutBinaryVector stream(&buffer);
+    ChArchiveOutBinary archive(stream);
+    archive.SetUseBlocks(blocks);
+    archive.SetClusterClassVersions(cluster_versions);
+    archive << CHNVP(data);
+    return buffer;
+}
+
+static void Read(std::vector<char>& buffer, MeshData& data, bool blocks, bool cluster_versions = true) {
+    ChStreamInBinaryVector stream(&buffer);
+    ChArchiveInBinary archive(stream);
+    archive.SetUseBlocks(blocks);
+    archive.SetClusterClassVersions(cluster_versions);
+    archive >> CHNVP(data);
+}
+
+TEST(ChArchiveBinary, blocks) {
+    MeshData data(100);
+
+    // The archive format does not depend on the use of blocks
+    auto buffer_blocks = Write(data, true);
+    auto buffer_elements = Write(data, false);
+    ASSERT_TRUE(buffer_blocks == buffer_elements);
+
+    for (bool blocks : {true, false}) {
+        MeshData data_in;
+        Read(buffer_blocks, data_in, blocks);
+        data.Check(data_in);
+    }
+
+    // Empty arrays
+    MeshData empty(0);
+    auto buffer_empty = Write(empty, true);
+    ASSERT_TRUE(buffer_empty == Write(empty, false));
+    MeshData empty_in;
+    Read(buffer_empty, empty_in, true);
+    ASSERT_EQ(empty_in.pos.size(), 0);
+    ASSERT_EQ(empty_in.state.size(), 0);
+}
+
+TEST(ChArchiveBinary, blocks_versions) {
+    // With one version per object, arrays of vectors are written element by element
+    MeshData data(20);
+    auto buffer_blocks = Write(data, true, false);
+    ASSERT_TRUE(buffer_blocks == Write(data, false, false));
+    MeshData data_in;
+    Read(buffer_blocks, data_in, true, false);
+    data.Check(data_in);
+}
+
+TEST(ChArchiveBinary, mapped_file) {
+    const std::string filename = "utest_archive_blocks.dat";
+    MeshData data(1000);
+    {
+        ChStreamOutBinaryFile stream(filename.c_str());
+        ChArchiveOutBinary archive(stream);
+        archive << CHNVP(data);
+    }
+
+    MeshData data_in;
+    {
+        ChStreamInBinaryMappedFile stream(filename.c_str());
+        ChArchiveInBinary archive(stream);
+        archive >> CHNVP(data_in);
+        ASSERT_TRUE(stream.End_of_stream());
+    }
+    data.Check(data_in);
+
+    // Reading past the end of the file
+    {
+        ChStreamInBinaryMappedFile stream(filename.c_str());
+        ChArchiveInBinary archive(stream);
+        archive >> CHNVP(data_in);
+        double extra;
+        ASSERT_THROW(archive >> CHNVP(extra), ChException);
+    }
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,215 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the binary cache of Wavefront OBJ meshes.
+// A mesh loaded from its cache must be identical to the mesh parsed from the
+// OBJ file, and a cache generated from a different version of the OBJ file
+// (or with corrupted contents) must be ignored. Cache files can be placed in a
+// separate directory, and failure to write them is not an error.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono_thirdparty/filesystem/path.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+static const std::string obj_file = "utest_mesh_cache.obj";
+static const std::string cache_file = obj_file + ".chmesh";
+
+// Write a unit cube (12 triangles) with per-face normals.
+static void WriteCube(double size) {
+    std::ofstream file(obj_file);
+    for (int i = 0; i < 8; i++)
+        file << "v " << size * (i & 1) << " " << size * ((i >> 1) & 1) << " " << size * ((i >> 2) & 1) << "\n";
+    file << "vn 1 0 0\nvn -1 0 0\nvn 0 1 0\nvn 0 -1 0\nvn 0 0 1\nvn 0 0 -1\n";
+    file << "f 1//6 3//6 4//6\nf 1//6 4//6 2//6\n";
+    file << "f 5//5 6//5 8//5\nf 5//5 8//5 7//5\n";
+    file << "f 1//4 2//4 6//4\nf 1//4 6//4 5//4\n";
+    file << "f 3//3 7//3 8//3\nf 3//3 8//3 4//3\n";
+    file << "f 1//2 5//2 7//2\nf 1//2 7//2 3//2\n";
+    file << "f 2//1 4//1 8//1\nf 2//1 8//1 6//1\n";
+}
+
+static void Compare(ChTriangleMeshConnected& m1, ChTriangleMeshConnected& m2) {
+    ASSERT_EQ(m1.getCoordsVertices().size(), m2.getCoordsVertices().size());
+    ASSERT_EQ(m1.getCoordsNormals().size(), m2.getCoordsNormals().size());
+    ASSERT_EQ(m1.getIndicesVertexes().size(), m2.getIndicesVertexes().size());
+    ASSERT_EQ(m1.getIndicesNormals().size(), m2.getIndicesNormals().size());
+    for (size_t i = 0; i < m1.getCoordsVertices().size(); i++)
+        ASSERT_TRUE(m1.getCoordsVertices()[i] == m2.getCoordsVertices()[i]);
+    for (size_t i = 0; i < m1.getCoordsNormals().size(); i++)
+        ASSERT_TRUE(m1.getCoordsNormals()[i] == m2.getCoordsNormals()[i]);
+    for (size_t i = 0; i < m1.getIndicesVertexes().size(); i++) {
+        ASSERT_TRUE(m1.getIndicesVertexes()[i] == m2.getIndicesVertexes()[i]);
+        ASSERT_TRUE(m1.getIndicesNormals()[i] == m2.getIndicesNormals()[i]);
+    }
+}
+
+TEST(ChTriangleMeshConnected, binary_cache) {
+    std::remove(cache_file.c_str());
+    WriteCube(1.0);
+
+    // Parse the OBJ file and generate the cache
+    ChTriangleMeshConnected parsed;
+    ASSERT_TRUE(parsed.LoadWavefrontMesh(obj_file));
+    ASSERT_EQ(parsed.getNumTriangles(), 12);
+    ASSERT_TRUE(std::ifstream(cache_file).good());
+
+    // Load from the cache
+    ChTriangleMeshConnected cached;
+    ASSERT_TRUE(cached.LoadWavefrontMesh(obj_file));
+    Compare(parsed, cached);
+
+    // Load without normals
+    ChTriangleMeshConnected no_normals;
+    ASSERT_TRUE(no_normals.LoadWavefrontMesh(obj_file, false));
+    ASSERT_EQ(no_normals.getCoordsNormals().size(), 0);
+    ASSERT_EQ(no_normals.getIndicesNormals().size(), 0);
+
+    // Check that the cache is actually used: overwrite it with a different mesh, tagged with the hash of the OBJ file
+    ChTriangleMeshConnected other(parsed);
+    other.Transform(ChVector<>(0), ChMatrix33<>(2.0));
+    ASSERT_TRUE(other.WriteBinaryMesh(cache_file, ChTriangleMeshConnected::ComputeFileHash(obj_file)));
+    ChTriangleMeshConnected tagged;
+    ASSERT_TRUE(tagged.LoadWavefrontMesh(obj_file));
+    Compare(other, tagged);
+
+    // A cache generated from a different OBJ file is regenerated
+    WriteCube(3.0);
+    ChTriangleMeshConnected modified;
+    ASSERT_TRUE(modified.LoadWavefrontMesh(obj_file));
+    ASSERT_DOUBLE_EQ(modified.getCoordsVertices()[7].x(), 3.0);
+    ChTriangleMeshConnected reloaded;
+    ASSERT_TRUE(reloaded.LoadBinaryMesh(cache_file, ChTriangleMeshConnected::ComputeFileHash(obj_file)));
+    Compare(modified, reloaded);
+    ASSERT_FALSE(reloaded.LoadBinaryMesh(cache_file, 12345));
+
+    // The cache can be disabled
+    ChTriangleMeshConnected::EnableBinaryCache(false);
+    std::remove(cache_file.c_str());
+    ChTriangleMeshConnected uncached;
+    ASSERT_TRUE(uncached.LoadWavefrontMesh(obj_file));
+    ASSERT_FALSE(std::ifstream(cache_file).good());
+    ChTriangleMeshConnected::EnableBinaryCache(true);
+
+    std::remove(obj_file.c_str());
+}
+
+TEST(ChTriangleMeshConnected, cached_neighbour_map) {
+    std::remove(cache_file.c_str());
+    WriteCube(1.0);
+
+    ChTriangleMeshConnected parsed;
+    ASSERT_TRUE(parsed.LoadWavefrontMesh(obj_file));
+    ChTriangleMeshConnected cached;
+    ASSERT_TRUE(cached.LoadWavefrontMesh(obj_file));
+
+    std::vector<std::array<int, 4>> map1;
+    std::vector<std::array<int, 4>> map2;
+    ASSERT_FALSE(parsed.ComputeNeighbouringTriangleMap(map1));
+    ASSERT_FALSE(cached.ComputeNeighbouringTriangleMap(map2));
+    ASSERT_EQ(map1.size(), 12);
+    ASSERT_TRUE(map1 == map2);
+
+    // The stored map is not used once the faces are modified
+    cached.getIndicesVertexes().resize(10);
+    cached.getIndicesNormals().resize(10);
+    ASSERT_FALSE(cached.ComputeNeighbouringTriangleMap(map2));
+    ASSERT_EQ(map2.size(), 10);
+
+    std::remove(cache_file.c_str());
+    std::remove(obj_file.c_str());
+}
+
+TEST(ChTriangleMeshConnected, corrupted_cache) {
+    std::remove(cache_file.c_str());
+    WriteCube(1.0);
+
+    ChTriangleMeshConnected parsed;
+    ASSERT_TRUE(parsed.LoadWavefrontMesh(obj_file));
+    uint64_t hash = ChTriangleMeshConnected::ComputeFileHash(obj_file);
+
+    // An existing cache file can be overwritten
+    ASSERT_TRUE(parsed.WriteBinaryMesh(cache_file, hash));
+    ASSERT_TRUE(parsed.WriteBinaryMesh(cache_file, hash));
+    ChTriangleMeshConnected cached;
+    ASSERT_TRUE(cached.LoadBinaryMesh(cache_file, hash));
+    Compare(parsed, cached);
+
+    // Flip one byte in the mesh data (the file size and header stay valid)
+    std::vector<char> bytes;
+    {
+        std::ifstream in(cache_file, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    size_t offset = bytes.size() / 2;
+    bytes[offset] ^= 0x5A;
+    {
+        std::ofstream out(cache_file, std::ios::binary);
+        out.write(bytes.data(), bytes.size());
+    }
+
+    // The corrupted cache is rejected, and regenerated by LoadWavefrontMesh
+    ChTriangleMeshConnected corrupted;
+    ASSERT_FALSE(corrupted.LoadBinaryMesh(cache_file, hash));
+    ChTriangleMeshConnected regenerated;
+    ASSERT_TRUE(regenerated.LoadWavefrontMesh(obj_file));
+    Compare(parsed, regenerated);
+    ChTriangleMeshConnected reloaded;
+    ASSERT_TRUE(reloaded.LoadBinaryMesh(cache_file, hash));
+    Compare(parsed, reloaded);
+
+    std::remove(cache_file.c_str());
+    std::remove(obj_file.c_str());
+}
+
+TEST(ChTriangleMeshConnected, cache_directory) {
+    const std::string cache_dir = "utest_mesh_cache_dir";
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(cache_dir)));
+    std::remove(cache_file.c_str());
+    WriteCube(1.0);
+
+    // Cache files are generated in the cache directory, not beside the OBJ file
+    ChTriangleMeshConnected::SetBinaryCacheDirectory(cache_dir);
+    std::string dir_cache_file = ChTriangleMeshConnected::GetBinaryCacheFilename(obj_file);
+    ASSERT_EQ(dir_cache_file.compare(0, cache_dir.size(), cache_dir), 0);
+    std::remove(dir_cache_file.c_str());
+
+    ChTriangleMeshConnected parsed;
+    ASSERT_TRUE(parsed.LoadWavefrontMesh(obj_file));
+    ASSERT_TRUE(std::ifstream(dir_cache_file).good());
+    ASSERT_FALSE(std::ifstream(cache_file).good());
+    ChTriangleMeshConnected cached;
+    ASSERT_TRUE(cached.LoadBinaryMesh(dir_cache_file, ChTriangleMeshConnected::ComputeFileHash(obj_file)));
+    Compare(parsed, cached);
+
+    // Cache files cannot be written in a missing directory, but the mesh is still loaded
+    ChTriangleMeshConnected::SetBinaryCacheDirectory(cache_dir + "/missing");
+    ChTriangleMeshConnected unwritable;
+    ASSERT_TRUE(unwritable.LoadWavefrontMesh(obj_file));
+    Compare(parsed, unwritable);
+    ASSERT_FALSE(std::ifstream(ChTriangleMeshConnected::GetBinaryCacheFilename(obj_file)).good());
+
+    ChTriangleMeshConnected::SetBinaryCacheDirectory("");
+    std::remove(dir_cache_file.c_str());
+    std::remove(cache_dir.c_str());
+    std::remove(obj_file.c_str());
+}
@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the tracing profiler (ChTracer).
+// Zones are recorded explicitly with ChTraceZone objects, so that the test does
+// not depend on whether or not CH_TRACE_ZONE is compiled in.
+//
+// =============================================================================
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/utils/ChTracer.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+TEST(ChTracer, disabled) {
+    ChTracer::Enable(false);
+    int num_threads = ChTracer::GetNumThreads();
+
+    std::thread worker([]() { ChTraceZone zone("disabled"); });
+    worker.join();
+
+    // No event recorded, hence no buffer created for the worker thread
+    ASSERT_EQ(ChTracer::GetNumThreads(), num_threads);
+}
+
+TEST(ChTracer, threads) {
+    ChTracer::Clear();
+    ChTracer::Enable(true);
+    int first = ChTracer::GetNumThreads();
+
+    // Each worker records an outer zone containing 'count' inner zones.
+    // Workers run one after the other, so that they register their buffers in a known order.
+    const int num_workers = 3;
+    for (int w = 0; w < num_workers; w++) {
+        std::thread worker([w]() {
+            ChTraceZone outer("outer");
+            for (int i = 0; i <= w; i++) {
+                ChTraceZone inner("inner");
+            }
+        });
+        worker.join();
+    }
+    ChTracer::Enable(false);
+
+    ASSERT_EQ(ChTracer::GetNumThreads(), first + num_workers);
+    for (int w = 0; w < num_workers; w++) {
+        auto events = ChTracer::GetEvents(first + w);
+        ASSERT_EQ((int)events.size(), w + 2);
+        // Zones are recorded when they end: all inner zones first, then the outer one
+        const auto& outer = events.back();
+        ASSERT_EQ(std::strcmp(outer.name, "outer"), 0);
+        for (int i = 0; i <= w; i++) {
+            ASSERT_EQ(std::strcmp(events[i].name, "inner"), 0);
+            ASSERT_LE(events[i].start, events[i].end);
+            ASSERT_GE(events[i].start, outer.start);
+            ASSERT_LE(events[i].end, outer.end);
+        }
+    }
+}
+
+TEST(ChTracer, ring_buffer) {
+    ChTracer::Clear();
+    ChTracer::SetBufferSize(8);
+    ChTracer::Enable(true);
+    int index = ChTracer::GetNumThreads();
+
+    // Only the last 8 events are kept
+    std::thread worker([]() {
+        for (int i = 0; i < 20; i++)
+            ChTracer::Record("event", i, i + 1);
+    });
+    worker.join();
+    ChTracer::Enable(false);
+    ChTracer::SetBufferSize(65536);
+
+    auto events = ChTracer::GetEvents(index);
+    ASSERT_EQ((int)events.size(), 8);
+    for (int i = 0; i < 8; i++)
+        ASSERT_EQ(events[i].start, 12 + i);
+
+    ChTracer::Clear();
+    ASSERT_EQ((int)ChTracer::GetEvents(index).size(), 0);
+}
+
+TEST(ChTracer, chrome_trace) {
+    ChTracer::Clear();
+    ChTracer::Enable(true);
+    std::thread worker([]() { ChTracer::Record("zone \"quoted\"", 1000, 3500); });
+    worker.join();
+    ChTracer::Enable(false);
+
+    const std::string filename = "utest_CH_tracer.json";
+    ASSERT_TRUE(ChTracer::WriteChromeTrace(filename));
+
+    std::ifstream file(filename);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string json = buffer.str();
+
+    ASSERT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0);
+    ASSERT_NE(json.find("\"name\":\"zone \\\"quoted\\\"\",\"cat\":\"chrono\",\"ph\":\"X\",\"ts\":1.000,\"dur\":2.500"),
+              std::string::npos);
+    ASSERT_NE(json.find("\"ph\":\"M\""), std::string::npos);
+}
@@ -0,0 +1,165 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for overlapping inter-rank communication with computation.
+// Spheres fall through the sub-domain boundaries into a narrow container and
+// settle in a pile spanning several sub-domains. The simulation is run with a blocking
+// exchange at the end of each step and with the overlapped exchange; the states
+// of the bodies owned by each rank must be identical.
+//
+// To be run on 2 or more MPI ranks.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <mpi.h>
+
+#include "chrono/physics/ChBody.h"
+#include "chrono_distributed/ChDistributedDataManager.h"
+#include "chrono_distributed/collision/ChBoundary.h"
+#include "chrono_distributed/collision/ChCollisionModelDistributed.h"
+#include "chrono_distributed/physics/ChSystemDistributed.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// State of an owned body: global ID, followed by position, orientation, and velocities
+typedef std::vector<double> BodyRecord;
+
+static const double step = 1e-3;
+static const int num_steps = 2000;
+static const int num_spheres = 80;
+static const double radius = 0.2;
+
+// Simulate the test model and return the states of the bodies owned by this rank, ordered by global ID.
+static std::vector<BodyRecord> Simulate(bool overlap) {
+    ChSystemDistributed sys(MPI_COMM_WORLD, 2 * radius, 1000);
+    sys.SetOverlapExchange(overlap);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.8));
+    sys.GetSettings()->solver.contact_force_model = ChSystemSMC::Hertz;
+    sys.GetSettings()->solver.tangential_displ_mode = ChSystemSMC::OneStep;
+    sys.GetSettings()->collision.bins_per_axis = vec3(4, 4, 10);
+    sys.GetDomain()->SetSplitAxis(2);
+    sys.GetDomain()->SetSimDomain(ChVector<>(0, 0, 0), ChVector<>(4, 4, 10));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetYoungModulus(1e6f);
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.1f);
+
+    // Container (floor and side walls), with an interior of 1 x 1, present on all ranks
+    auto bin = chrono_types::make_shared<ChBody>(chrono_types::make_shared<ChCollisionModelDistributed>());
+    bin->SetPos(ChVector<>(2, 2, 0));
+    bin->SetCollide(true);
+    bin->SetBodyFixed(true);
+    sys.AddBodyAllRanks(bin);
+
+    double hx = 0.5;
+    double hy = 0.5;
+    double height = 10;
+    auto cb = chrono_types::make_shared<ChBoundary>(bin, mat);
+    cb->AddPlane(ChFrame<>(ChVector<>(0, 0, 0), QUNIT), ChVector2<>(2.0 * hx, 2.0 * hy));
+    cb->AddPlane(ChFrame<>(ChVector<>(-hx, 0, height / 2.0), Q_from_AngY(CH_C_PI_2)), ChVector2<>(height, 2.0 * hy));
+    cb->AddPlane(ChFrame<>(ChVector<>(hx, 0, height / 2.0), Q_from_AngY(-CH_C_PI_2)), ChVector2<>(height, 2.0 * hy));
+    cb->AddPlane(ChFrame<>(ChVector<>(0, -hy, height / 2.0), Q_from_AngX(-CH_C_PI_2)), ChVector2<>(2.0 * hx, height));
+    cb->AddPlane(ChFrame<>(ChVector<>(0, hy, height / 2.0), Q_from_AngX(CH_C_PI_2)), ChVector2<>(2.0 * hx, height));
+
+    // Layers of 2 x 2 spheres, with random perturbations of the initial positions and velocities
+    // (identical on all ranks)
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> uniform(-1, 1);
+    for (int i = 0; i < num_spheres; i++) {
+        double x = 2 + ((i % 2) - 0.5) * 0.45 + 0.02 * uniform(gen);
+        double y = 2 + (((i / 2) % 2) - 0.5) * 0.45 + 0.02 * uniform(gen);
+        double z = 0.5 + (i / 4) * 0.45;
+        ChVector<> vel(0.1 * uniform(gen), 0.1 * uniform(gen), 0.1 * uniform(gen));
+        auto ball = chrono_types::make_shared<ChBody>(chrono_types::make_shared<ChCollisionModelDistributed>());
+        ball->SetMass(1);
+        ball->SetInertiaXX(ChVector<>(0.4 * radius * radius));
+        ball->SetPos(ChVector<>(x, y, z));
+        ball->SetPos_dt(vel);
+        ball->SetCollide(true);
+        ball->GetCollisionModel()->ClearModel();
+        ball->GetCollisionModel()->AddSphere(mat, radius);
+        ball->GetCollisionModel()->BuildModel();
+        sys.AddBody(ball);
+    }
+
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step);
+
+    std::vector<BodyRecord> records;
+    for (size_t i = 0; i < sys.Get_bodylist().size(); i++) {
+        auto status = sys.ddm->comm_status[i];
+        if (status != distributed::OWNED && status != distributed::SHARED_UP && status != distributed::SHARED_DOWN)
+            continue;
+        const auto& body = sys.Get_bodylist()[i];
+        const ChVector<>& p = body->GetPos();
+        const ChQuaternion<>& q = body->GetRot();
+        const ChVector<>& v = body->GetPos_dt();
+        const ChVector<>& w = body->GetWvel_loc();
+        records.push_back({(double)body->GetGid(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3(),  //
+                           v.x(), v.y(), v.z(), w.x(), w.y(), w.z()});
+    }
+    std::sort(records.begin(), records.end());
+    return records;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int my_rank;
+    int num_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    auto blocking = Simulate(false);
+    auto overlapped = Simulate(true);
+
+    int local_errors = 0;
+    if (blocking.size() != overlapped.size()) {
+        printf("Rank %d: %d bodies owned with blocking exchange, %d with overlapped exchange\n", my_rank,
+               (int)blocking.size(), (int)overlapped.size());
+        local_errors++;
+    } else {
+        for (size_t i = 0; i < blocking.size(); i++) {
+            if (blocking[i] != overlapped[i]) {
+                printf("Rank %d: different state for body %d\n", my_rank, (int)blocking[i][0]);
+                local_errors++;
+            }
+        }
+    }
+
+    // All spheres remain in the simulation, each owned by exactly one rank
+    int local_owned = (int)overlapped.size();
+    int num_owned = 0;
+    int num_errors = 0;
+    MPI_Allreduce(&local_owned, &num_owned, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&local_errors, &num_errors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (num_owned != num_spheres) {
+        if (my_rank == 0)
+            printf("%d spheres owned, expected %d\n", num_owned, num_spheres);
+        num_errors++;
+    }
+
+    if (my_rank == 0)
+        printf("%d ranks, %d errors\n", num_ranks, num_errors);
+
+    MPI_Finalize();
+    return num_errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test of the cached matrix assembly in sparse direct solvers.
+// A cantilever ANCF shell strip, attached to a rigid body, is simulated with and
+// without cached assembly. Results must be identical.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChLinkPointFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+class Model {
+  public:
+    Model(bool cached, int num_elements);
+    void Simulate(int num_steps) {
+        for (int i = 0; i < num_steps; i++)
+            m_system.DoStepDynamics(1e-3);
+    }
+
+    ChSystemSMC m_system;
+    std::shared_ptr<ChSolverSparseLU> m_solver;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> m_nodes;
+};
+
+Model::Model(bool cached, int num_elements) {
+    m_system.Set_G_acc(ChVector<>(0, -9.8, 0));
+
+    double length = 1;
+    double width = 0.1;
+    double thickness = 0.01;
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, ChVector<>(2.1e7), ChVector<>(0.3),
+                                                              ChVector<>(8.0769231e6));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    m_system.AddBody(ground);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    m_system.Add(mesh);
+
+    double dx = length / num_elements;
+    ChVector<> dir(0, 1, 0);
+
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(0, 0, -width / 2), dir);
+    auto nodeB = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(0, 0, +width / 2), dir);
+    mesh->AddNode(nodeA);
+    mesh->AddNode(nodeB);
+
+    auto linkA = chrono_types::make_shared<ChLinkPointFrame>();
+    linkA->Initialize(nodeA, ground);
+    m_system.Add(linkA);
+    auto linkB = chrono_types::make_shared<ChLinkPointFrame>();
+    linkB->Initialize(nodeB, ground);
+    m_system.Add(linkB);
+
+    for (int i = 1; i <= num_elements; i++) {
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, 0, -width / 2), dir);
+        auto nodeD = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, 0, +width / 2), dir);
+        mesh->AddNode(nodeC);
+        mesh->AddNode(nodeD);
+        m_nodes.push_back(nodeC);
+        m_nodes.push_back(nodeD);
+
+        auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+        element->SetNodes(nodeA, nodeB, nodeD, nodeC);
+        element->SetDimensions(dx, width);
+        element->AddLayer(thickness, 0, mat);
+        element->SetAlphaDamp(0.01);
+        mesh->AddElement(element);
+
+        nodeA = nodeC;
+        nodeB = nodeD;
+    }
+
+    m_solver = chrono_types::make_shared<ChSolverSparseLU>();
+    m_solver->LockSparsityPattern(true);
+    m_solver->UseCachedAssembly(cached);
+    m_system.SetSolver(m_solver);
+}
+
+TEST(ChDirectSolverLS, cached_assembly) {
+    Model ref(false, 20);
+    Model test(true, 20);
+
+    ref.Simulate(50);
+    test.Simulate(50);
+
+    // All but the first matrix assemblies must use the cache
+    ASSERT_EQ(ref.m_solver->GetNumCachedAssemblyCalls(), 0);
+    ASSERT_EQ(test.m_solver->GetNumCachedAssemblyCalls(), test.m_solver->GetNumSetupCalls() - 1);
+
+    for (size_t i = 0; i < ref.m_nodes.size(); i++) {
+        ASSERT_EQ(ref.m_nodes[i]->GetPos(), test.m_nodes[i]->GetPos());
+        ASSERT_EQ(ref.m_nodes[i]->GetD(), test.m_nodes[i]->GetD());
+    }
+}
@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for binary checkpoints of FEA models with implicit integrators.
+// An ANCF cable pinned at one end is simulated with HHT (fixed step size) and
+// Euler implicit, with a checkpoint taken halfway. A second system, restored
+// from the checkpoint, must continue exactly as the original one.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChLinkPointFrame.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static const double step = 1e-3;
+
+// Construct the test model in the given system.
+static void CreateModel(ChSystemSMC& sys, ChTimestepper::Type type) {
+    sys.Set_G_acc(ChVector<>(0, -9.8, 0));
+
+    int num_elements = 10;
+    double length = 1;
+    auto section = chrono_types::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+    section->SetBeamRaleyghDamping(0.01);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double dx = length / num_elements;
+    ChVector<> dir(1, 0, 0);
+
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(0, 0, 0), dir);
+    mesh->AddNode(nodeA);
+
+    auto link = chrono_types::make_shared<ChLinkPointFrame>();
+    link->Initialize(nodeA, ground);
+    sys.Add(link);
+
+    for (int i = 1; i <= num_elements; i++) {
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, 0, 0), dir);
+        mesh->AddNode(nodeB);
+
+        auto element = chrono_types::make_shared<ChElementCableANCF>();
+        element->SetNodes(nodeA, nodeB);
+        element->SetSection(section);
+        mesh->AddElement(element);
+
+        nodeA = nodeB;
+    }
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(type);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys.GetTimestepper());
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-8);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper()))
+        hht->SetStepControl(false);
+}
+
+// Return the state (including accelerations and reactions) of the given system.
+static void GetState(ChSystemSMC& sys, std::vector<double>& state) {
+    sys.Setup();
+    ChState x(sys.GetNcoords_x(), &sys);
+    ChStateDelta v(sys.GetNcoords_v(), &sys);
+    ChStateDelta a(sys.GetNcoords_v(), &sys);
+    ChVectorDynamic<> L(sys.GetNconstr());
+    double t;
+    sys.StateGather(x, v, t);
+    sys.StateGatherAcceleration(a);
+    sys.StateGatherReactions(L);
+
+    state.assign(x.data(), x.data() + x.size());
+    state.insert(state.end(), v.data(), v.data() + v.size());
+    state.insert(state.end(), a.data(), a.data() + a.size());
+    state.insert(state.end(), L.data(), L.data() + L.size());
+    state.push_back(t);
+}
+
+static void CheckRestart(ChTimestepper::Type type) {
+    std::vector<char> checkpoint;
+    std::vector<double> state_ref;
+
+    {
+        ChSystemSMC sys;
+        CreateModel(sys, type);
+        for (int i = 0; i < 50; i++)
+            sys.DoStepDynamics(step);
+
+        utils::WriteBinaryCheckpoint(&sys, checkpoint);
+
+        for (int i = 0; i < 50; i++)
+            sys.DoStepDynamics(step);
+        GetState(sys, state_ref);
+    }
+
+    ChSystemSMC sys;
+    CreateModel(sys, type);
+    ASSERT_TRUE(utils::ReadBinaryCheckpoint(&sys, checkpoint.data(), checkpoint.size()));
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(step);
+
+    std::vector<double> state;
+    GetState(sys, state);
+    ASSERT_EQ(state.size(), state_ref.size());
+    for (size_t i = 0; i < state.size(); i++)
+        ASSERT_EQ(state[i], state_ref[i]) << "state component " << i;
+}
+
+TEST(ChSystem, binary_checkpoint_HHT) {
+    CheckRestart(ChTimestepper::Type::HHT);
+}
+
+TEST(ChSystem, binary_checkpoint_Euler) {
+    CheckRestart(ChTimestepper::Type::EULER_IMPLICIT);
+}
@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test of the reuse of the Newton matrix across steps in implicit integrators.
+// A cantilever ANCF shell strip is simulated with HHT, Newmark, and Euler
+// implicit, with and without Newton matrix reuse. Reuse must save solver Setup
+// calls (matrix factorizations) without changing the results beyond the Newton
+// tolerance.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChLinkPointFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+class Model {
+  public:
+    Model(ChTimestepper::Type type, bool reuse);
+    void Simulate(int num_steps) {
+        for (int i = 0; i < num_steps; i++)
+            m_system.DoStepDynamics(1e-3);
+    }
+
+    ChSystemSMC m_system;
+    std::shared_ptr<ChSolverSparseLU> m_solver;
+    std::shared_ptr<ChImplicitIterativeTimestepper> m_integrator;
+    std::shared_ptr<ChNodeFEAxyzD> m_tip;
+};
+
+Model::Model(ChTimestepper::Type type, bool reuse) {
+    m_system.Set_G_acc(ChVector<>(0, -9.8, 0));
+
+    int num_elements = 10;
+    double length = 1;
+    double width = 0.1;
+    double thickness = 0.01;
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, ChVector<>(2.1e7), ChVector<>(0.3),
+                                                              ChVector<>(8.0769231e6));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    m_system.AddBody(ground);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    m_system.Add(mesh);
+
+    double dx = length / num_elements;
+    ChVector<> dir(0, 1, 0);
+
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(0, 0, -width / 2), dir);
+    auto nodeB = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(0, 0, +width / 2), dir);
+    mesh->AddNode(nodeA);
+    mesh->AddNode(nodeB);
+
+    auto linkA = chrono_types::make_shared<ChLinkPointFrame>();
+    linkA->Initialize(nodeA, ground);
+    m_system.Add(linkA);
+    auto linkB = chrono_types::make_shared<ChLinkPointFrame>();
+    linkB->Initialize(nodeB, ground);
+    m_system.Add(linkB);
+
+    for (int i = 1; i <= num_elements; i++) {
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, 0, -width / 2), dir);
+        auto nodeD = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, 0, +width / 2), dir);
+        mesh->AddNode(nodeC);
+        mesh->AddNode(nodeD);
+
+        auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+        element->SetNodes(nodeA, nodeB, nodeD, nodeC);
+        element->SetDimensions(dx, width);
+        element->AddLayer(thickness, 0, mat);
+        element->SetAlphaDamp(0.01);
+        mesh->AddElement(element);
+
+        nodeA = nodeC;
+        nodeB = nodeD;
+    }
+    m_tip = nodeA;
+
+    m_solver = chrono_types::make_shared<ChSolverSparseLU>();
+    m_solver->LockSparsityPattern(true);
+    m_system.SetSolver(m_solver);
+
+    m_system.SetTimestepperType(type);
+    m_integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(m_system.GetTimestepper());
+    m_integrator->SetMaxiters(20);
+    m_integrator->SetAbsTolerances(1e-8);
+    m_integrator->SetJacobianReuse(reuse, 10, 0.5);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(m_system.GetTimestepper()))
+        hht->SetStepControl(false);
+}
+
+static void Compare(ChTimestepper::Type type) {
+    Model ref(type, false);
+    Model test(type, true);
+
+    ref.Simulate(100);
+    test.Simulate(100);
+
+    std::cout << "Setup calls  without reuse: " << ref.m_integrator->GetNumSetupCallsTotal()
+              << "  with reuse: " << test.m_integrator->GetNumSetupCallsTotal()
+              << "  (saved: " << test.m_integrator->GetNumSetupCallsSaved() << ")" << std::endl;
+
+    ASSERT_EQ(ref.m_integrator->GetNumSetupCallsSaved(), 0);
+    ASSERT_GT(test.m_integrator->GetNumSetupCallsSaved(), 0);
+    ASSERT_LT(test.m_integrator->GetNumSetupCallsTotal(), ref.m_integrator->GetNumSetupCallsTotal());
+
+    ASSERT_NEAR((ref.m_tip->GetPos() - test.m_tip->GetPos()).Length(), 0.0, 1e-5);
+}
+
+TEST(ChImplicitIterativeTimestepper, jacobian_reuse_HHT) {
+    Compare(ChTimestepper::Type::HHT);
+}
+
+TEST(ChImplicitIterativeTimestepper, jacobian_reuse_Newmark) {
+    Compare(ChTimestepper::Type::NEWMARK);
+}
+
+TEST(ChImplicitIterativeTimestepper, jacobian_reuse_Euler) {
+    Compare(ChTimestepper::Type::EULER_IMPLICIT);
+}
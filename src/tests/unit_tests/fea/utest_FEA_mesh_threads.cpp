@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test of the parallel (colored) loading of mesh residual terms.
+// A plate of ANCF shell elements, clamped along one edge, is simulated using
+// different numbers of threads. Results must be identical.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static const int num_div = 8;
+
+static std::vector<ChVector<>> Simulate(int num_threads, int& num_colors) {
+    ChSystemSMC sys;
+    sys.SetNumThreads(num_threads);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.8));
+
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, ChVector<>(2.1e7), ChVector<>(0.3),
+                                                              ChVector<>(8.0769231e6));
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double dx = 1.0 / num_div;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int j = 0; j <= num_div; j++) {
+        for (int i = 0; i <= num_div; i++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dx, 0), ChVector<>(0, 0, 1));
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+
+    for (int j = 0; j < num_div; j++) {
+        for (int i = 0; i < num_div; i++) {
+            int n0 = j * (num_div + 1) + i;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+            element->SetNodes(nodes[n0], nodes[n0 + 1], nodes[n0 + num_div + 2], nodes[n0 + num_div + 1]);
+            element->SetDimensions(dx, dx);
+            element->AddLayer(0.01, 0, mat);
+            element->SetAlphaDamp(0.01);
+            mesh->AddElement(element);
+        }
+    }
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    sys.SetSolver(solver);
+
+    for (int i = 0; i < 20; i++)
+        sys.DoStepDynamics(1e-3);
+
+    num_colors = mesh->GetNumElementColors();
+
+    std::vector<ChVector<>> pos;
+    for (auto& node : nodes)
+        pos.push_back(node->GetPos());
+    return pos;
+}
+
+TEST(ChMesh, colored_residual) {
+    int num_colors1;
+    int num_colors4;
+    auto pos1 = Simulate(1, num_colors1);
+    auto pos4 = Simulate(4, num_colors4);
+
+    // Elements on a structured quad grid require 4 colors
+    ASSERT_EQ(num_colors1, 4);
+    ASSERT_EQ(num_colors4, 4);
+
+    for (size_t i = 0; i < pos1.size(); i++) {
+        ASSERT_EQ(pos1[i], pos4[i]);
+    }
+}
@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the contact history of the multi-step tangential displacement
+// model (SMC). A plate rests on a grid of fixed spheres, so that the plate is
+// involved in many simultaneous persistent contacts. The test checks that the
+// history of all active contacts is kept and that it persists across steps.
+// A second test checks that the history is discarded when a step has no
+// contacts, so that a contact which forms again starts with a new history.
+//
+// =============================================================================
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+TEST(ChronoMulticore, contact_history) {
+    const int grid = 6;  // number of supporting spheres in each direction
+    const double radius = 0.1;
+    const double spacing = 0.25;
+    const double time_step = 1e-3;
+
+    ChSystemMulticoreSMC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.GetSettings()->solver.contact_force_model = ChSystemSMC::Hooke;
+    system.GetSettings()->solver.tangential_displ_mode = ChSystemSMC::MultiStep;
+    system.GetSettings()->solver.use_material_properties = false;
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.4f);
+    mat->SetKn(1e5f);
+    mat->SetGn(40);
+    mat->SetKt(1e5f);
+    mat->SetGt(40);
+
+    // Grid of fixed supporting spheres
+    for (int i = 0; i < grid; i++) {
+        for (int j = 0; j < grid; j++) {
+            auto sphere = std::shared_ptr<ChBody>(system.NewBody());
+            sphere->SetMass(1000);
+            sphere->SetPos(ChVector<>((i - 0.5 * (grid - 1)) * spacing, 0, (j - 0.5 * (grid - 1)) * spacing));
+            sphere->SetBodyFixed(true);
+            sphere->SetCollide(true);
+            sphere->GetCollisionModel()->ClearModel();
+            sphere->GetCollisionModel()->AddSphere(mat, radius);
+            sphere->GetCollisionModel()->BuildModel();
+            system.AddBody(sphere);
+        }
+    }
+
+    // Plate resting on all spheres (added last, so that it stores the history of all its contacts)
+    double hdim = 0.5 * grid * spacing;
+    auto plate = std::shared_ptr<ChBody>(system.NewBody());
+    plate->SetMass(10);
+    plate->SetInertiaXX(ChVector<>(10 * hdim * hdim / 3, 20 * hdim * hdim / 3, 10 * hdim * hdim / 3));
+    plate->SetPos(ChVector<>(0, radius + 0.05, 0));
+    plate->SetCollide(true);
+    plate->GetCollisionModel()->ClearModel();
+    plate->GetCollisionModel()->AddBox(mat, hdim, 0.05, hdim);
+    plate->GetCollisionModel()->BuildModel();
+    system.AddBody(plate);
+
+    // Let the plate settle
+    while (system.GetChTime() < 0.2)
+        system.DoStepDynamics(time_step);
+
+    for (int k = 0; k < 100; k++) {
+        system.DoStepDynamics(time_step);
+
+        // Number of contacts with actual penetration
+        const auto& cd_data = system.data_manager->cd_data;
+        int num_active = 0;
+        for (uint i = 0; i < cd_data->num_rigid_contacts; i++) {
+            if (cd_data->dpth_rigid_rigid[i] < 0)
+                num_active++;
+        }
+        ASSERT_EQ(num_active, grid * grid);
+
+        // All active contacts have a history, which persisted since the contact started
+        const auto& host_data = system.data_manager->host_data;
+        int num_history = 0;
+        for (size_t h = 0; h < host_data.shear_keys.size(); h++) {
+            if (host_data.shear_keys[h].x == -1)
+                continue;
+            num_history++;
+            ASSERT_GT(host_data.contact_duration[h], 0.1);
+        }
+        ASSERT_EQ(num_history, num_active);
+    }
+}
+
+TEST(ChronoMulticore, contact_history_reset) {
+    const double radius = 0.1;
+    const double time_step = 1e-3;
+
+    ChSystemMulticoreSMC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.GetSettings()->solver.contact_force_model = ChSystemSMC::Hooke;
+    system.GetSettings()->solver.tangential_displ_mode = ChSystemSMC::MultiStep;
+    system.GetSettings()->solver.use_material_properties = false;
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.4f);
+    mat->SetKn(1e5f);
+    mat->SetGn(40);
+
+    auto ground = std::shared_ptr<ChBody>(system.NewBody());
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(mat, 1, 0.5, 1);
+    ground->GetCollisionModel()->BuildModel();
+    system.AddBody(ground);
+
+    auto ball = std::shared_ptr<ChBody>(system.NewBody());
+    ball->SetMass(1);
+    ball->SetPos(ChVector<>(0, radius, 0));
+    ball->SetCollide(true);
+    ball->GetCollisionModel()->ClearModel();
+    ball->GetCollisionModel()->AddSphere(mat, radius);
+    ball->GetCollisionModel()->BuildModel();
+    system.AddBody(ball);
+
+    // Let the ball settle and accumulate contact history
+    while (system.GetChTime() < 0.1)
+        system.DoStepDynamics(time_step);
+
+    const auto& host_data = system.data_manager->host_data;
+    auto history_duration = [&]() {
+        double duration = -1;
+        for (size_t h = 0; h < host_data.shear_keys.size(); h++) {
+            if (host_data.shear_keys[h].x != -1)
+                duration = host_data.contact_duration[h];
+        }
+        return duration;
+    };
+    ASSERT_GT(history_duration(), 0.05);
+
+    // Lift the ball for one step (no contacts in the system), then put it back
+    ChVector<> pos = ball->GetPos();
+    ball->SetPos(pos + ChVector<>(0, 0.5, 0));
+    ball->SetPos_dt(VNULL);
+    system.DoStepDynamics(time_step);
+    ASSERT_EQ(system.data_manager->cd_data->num_rigid_contacts, 0);
+    ASSERT_LT(history_duration(), 0);
+
+    ball->SetPos(pos);
+    ball->SetPos_dt(VNULL);
+    system.DoStepDynamics(time_step);
+
+    // The new contact does not inherit the history of the old one
+    ASSERT_GE(history_duration(), 0);
+    ASSERT_LT(history_duration(), time_step);
+}
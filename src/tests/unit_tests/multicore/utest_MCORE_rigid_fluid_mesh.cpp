@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the collision of 3-DOF particles with a static triangle mesh.
+// A layer of particles rests on a fixed mesh. The rigid-fluid contacts must be
+// the same whether or not the mesh is represented through a BVH (in which case
+// the mesh triangles are not present in the broadphase).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+#include "chrono_multicore/physics/Ch3DOFContainer.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+static const double radius = 0.02;
+
+// Return the number of rigid-fluid contacts and the lowest particle height after the given number of steps.
+static void Simulate(bool use_bvh, int num_steps, uint& num_contacts, double& min_height) {
+    ChSystemMulticoreNSC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    sys.GetSettings()->solver.max_iteration_normal = 0;
+    sys.GetSettings()->solver.max_iteration_sliding = 40;
+    sys.GetSettings()->solver.max_iteration_spinning = 0;
+    sys.GetSettings()->solver.max_iteration_bilateral = 0;
+    sys.GetSettings()->collision.collision_envelope = 0.05 * radius;
+    sys.GetSettings()->collision.bins_per_axis = vec3(4, 4, 2);
+    sys.ChangeSolverType(SolverType::BB);
+    std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem())->EnableMeshBVH(use_bvh);
+
+    // Fixed ground with a triangulated grid as static mesh
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+    int n = 8;
+    double delta = 0.05;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ChVector<> v00(-0.2 + i * delta, -0.2 + j * delta, 0);
+            ChVector<> v10 = v00 + ChVector<>(delta, 0, 0);
+            ChVector<> v11 = v00 + ChVector<>(delta, delta, 0);
+            ChVector<> v01 = v00 + ChVector<>(0, delta, 0);
+            trimesh->addTriangle(v00, v10, v11);
+            trimesh->addTriangle(v00, v11, v01);
+        }
+    }
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    auto ground = std::shared_ptr<ChBody>(sys.NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddTriangleMesh(mat, trimesh, true, false);
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    // Layer of particles, just above the mesh
+    auto particles = chrono_types::make_shared<ChParticleContainer>();
+    sys.Add3DOFContainer(particles);
+    particles->kernel_radius = 2 * radius;  // particle contact radius is half the kernel radius
+    particles->mass = 0.01;
+    particles->contact_mu = 0;
+    particles->mu = 0;
+    particles->compliance = 1e-6;
+    particles->collision_envelope = 0.05 * radius;
+
+    std::vector<real3> pos;
+    std::vector<real3> vel;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            pos.push_back(real3(-0.17 + 0.06 * i, -0.17 + 0.06 * j, radius));
+            vel.push_back(real3(0, 0, 0));
+        }
+    }
+    particles->UpdatePosition(0);
+    particles->AddBodies(pos, vel);
+
+    num_contacts = 0;
+    for (int k = 0; k < num_steps; k++) {
+        sys.DoStepDynamics(1e-3);
+        if (k == 0)
+            num_contacts = sys.data_manager->cd_data->num_rigid_fluid_contacts;
+    }
+
+    min_height = 1;
+    for (int i = 0; i < (int)pos.size(); i++)
+        min_height = std::min(min_height, (double)particles->GetPos(i).z);
+}
+
+TEST(ChronoMulticore, rigid_fluid_mesh) {
+    uint num_contacts_ref;
+    uint num_contacts;
+    double min_height_ref;
+    double min_height;
+    Simulate(false, 200, num_contacts_ref, min_height_ref);
+    Simulate(true, 200, num_contacts, min_height);
+
+    // Each particle touches the mesh
+    ASSERT_GE(num_contacts_ref, 36);
+    ASSERT_EQ(num_contacts, num_contacts_ref);
+
+    // Particles do not fall through the mesh
+    ASSERT_GT(min_height_ref, 0);
+    ASSERT_GT(min_height, 0);
+}
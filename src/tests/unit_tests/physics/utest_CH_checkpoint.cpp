@@ -0,0 +1,217 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for binary checkpoints (utils::WriteBinaryCheckpoint and
+// utils::ReadBinaryCheckpoint). A system with a pendulum and a column of
+// spheres resting on the ground (with contacts generated by a custom collision
+// callback) is simulated, with a checkpoint taken halfway. A second system,
+// restored from the checkpoint, must continue exactly as the original one.
+//
+// =============================================================================
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// ====================================================================================
+
+static const int num_spheres = 4;
+static const double radius = 0.5;
+static const double step = 1e-3;
+
+// Custom collision detection: contacts between consecutive spheres in the column and between the ground and the
+// first sphere.
+class ColumnCollision : public ChSystem::CustomCollisionCallback {
+  public:
+    ColumnCollision(std::shared_ptr<ChBody> ground,
+                    const std::vector<std::shared_ptr<ChBody>>& spheres,
+                    std::shared_ptr<ChMaterialSurface> mat)
+        : m_ground(ground), m_spheres(spheres), m_mat(mat) {}
+
+    virtual void OnCustomCollision(ChSystem* sys) override {
+        for (int i = 0; i < num_spheres; i++) {
+            auto b_pos = m_spheres[i]->GetPos();
+            ChVector<> a_pos = (i == 0) ? ChVector<>(b_pos.x(), -radius, b_pos.z()) : m_spheres[i - 1]->GetPos();
+            double dist = b_pos.y() - a_pos.y() - 2 * radius;
+            if (dist > 0.01)
+                continue;
+
+            ChCollisionInfo contact;
+            contact.modelA = (i == 0) ? m_ground->GetCollisionModel().get() : m_spheres[i - 1]->GetCollisionModel().get();
+            contact.modelB = m_spheres[i]->GetCollisionModel().get();
+            contact.shapeA = nullptr;
+            contact.shapeB = nullptr;
+            contact.vN = ChVector<>(0, 1, 0);
+            contact.vpA = a_pos + ChVector<>(0, radius, 0);
+            contact.vpB = b_pos - ChVector<>(0, radius, 0);
+            contact.distance = dist;
+            sys->GetContactContainer()->AddContact(contact, m_mat, m_mat);
+        }
+    }
+
+  private:
+    std::shared_ptr<ChBody> m_ground;
+    std::vector<std::shared_ptr<ChBody>> m_spheres;
+    std::shared_ptr<ChMaterialSurface> m_mat;
+};
+
+// Construct the test model in the given system.
+static void CreateModel(ChSystemNSC& sys, bool add_pendulum = true) {
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(50);
+    solver->SetTolerance(1e-10);
+    solver->EnableWarmStart(true);
+    sys.SetSolver(solver);
+
+    std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer())->SetUseReactionCache(true);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int i = 0; i < num_spheres; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, false);
+        sphere->SetPos(ChVector<>(0.01 * i, radius + 2 * radius * i + 0.005 * i, 0));
+        sys.AddBody(sphere);
+        spheres.push_back(sphere);
+    }
+
+    sys.RegisterCustomCollisionCallback(chrono_types::make_shared<ColumnCollision>(ground, spheres, mat));
+
+    if (add_pendulum) {
+        auto pend = chrono_types::make_shared<ChBodyEasyBox>(1.0, 0.1, 0.1, 1000, false, false);
+        pend->SetPos(ChVector<>(5.5, 2, 0));
+        sys.AddBody(pend);
+
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(ground, pend, ChCoordsys<>(ChVector<>(5, 2, 0), QUNIT));
+        sys.AddLink(rev);
+    }
+}
+
+// Return the state of the given system.
+static void GetState(ChSystemNSC& sys, std::vector<double>& state) {
+    sys.Setup();
+    ChState x(sys.GetNcoords_x(), &sys);
+    ChStateDelta v(sys.GetNcoords_v(), &sys);
+    ChVectorDynamic<> L(sys.GetNconstr());
+    double t;
+    sys.StateGather(x, v, t);
+    sys.StateGatherReactions(L);
+
+    state.assign(x.data(), x.data() + x.size());
+    state.insert(state.end(), v.data(), v.data() + v.size());
+    state.insert(state.end(), L.data(), L.data() + L.size());
+    state.push_back(t);
+}
+
+TEST(ChSystem, binary_checkpoint) {
+    std::vector<char> checkpoint;
+    std::vector<double> state_ref;
+    size_t steps_ref;
+
+    {
+        ChSystemNSC sys;
+        CreateModel(sys);
+        for (int i = 0; i < 300; i++)
+            sys.DoStepDynamics(step);
+        ASSERT_EQ(sys.GetNcontacts(), num_spheres);
+
+        utils::WriteBinaryCheckpoint(&sys, checkpoint);
+        ASSERT_TRUE(utils::WriteBinaryCheckpoint(&sys, "checkpoint.dat"));
+
+        for (int i = 0; i < 200; i++)
+            sys.DoStepDynamics(step);
+        GetState(sys, state_ref);
+        steps_ref = sys.GetStepcount();
+    }
+
+    // Restore from the memory buffer and from the file (read or memory-mapped)
+    for (int k = 0; k < 3; k++) {
+        ChSystemNSC sys;
+        CreateModel(sys);
+        if (k == 0)
+            ASSERT_TRUE(utils::ReadBinaryCheckpoint(&sys, checkpoint.data(), checkpoint.size()));
+        else if (k == 1)
+            ASSERT_TRUE(utils::ReadBinaryCheckpoint(&sys, "checkpoint.dat"));
+        else
+            ASSERT_TRUE(utils::ReadBinaryCheckpointMapped(&sys, "checkpoint.dat"));
+
+        for (int i = 0; i < 200; i++)
+            sys.DoStepDynamics(step);
+
+        std::vector<double> state;
+        GetState(sys, state);
+        ASSERT_EQ(sys.GetStepcount(), steps_ref);
+        ASSERT_EQ(state.size(), state_ref.size());
+        for (size_t i = 0; i < state.size(); i++)
+            ASSERT_EQ(state[i], state_ref[i]);
+    }
+
+    std::remove("checkpoint.dat");
+}
+
+TEST(ChSystem, binary_checkpoint_mismatch) {
+    std::vector<char> checkpoint;
+    {
+        ChSystemNSC sys;
+        CreateModel(sys);
+        sys.DoStepDynamics(step);
+        utils::WriteBinaryCheckpoint(&sys, checkpoint);
+    }
+
+    // A system with different physics items must be rejected
+    ChSystemNSC sys;
+    CreateModel(sys, false);
+    ASSERT_FALSE(utils::ReadBinaryCheckpoint(&sys, checkpoint.data(), checkpoint.size()));
+
+    // Truncated data must be rejected
+    ChSystemNSC sys2;
+    CreateModel(sys2);
+    ASSERT_FALSE(utils::ReadBinaryCheckpoint(&sys2, checkpoint.data(), checkpoint.size() / 2));
+
+    // Corrupted counts (huge number of items, negative number of coordinates) must be rejected before allocating
+    // memory or modifying the system
+    auto pos = sys2.Get_bodylist()[1]->GetPos();
+    std::vector<char> corrupted(checkpoint);
+    int32_t count = 0x7FFFFFFF;
+    std::memcpy(corrupted.data() + 20, &count, sizeof(count));  // number of items
+    ASSERT_FALSE(utils::ReadBinaryCheckpoint(&sys2, corrupted.data(), corrupted.size()));
+    corrupted = checkpoint;
+    count = -1;
+    std::memcpy(corrupted.data() + 24, &count, sizeof(count));  // number of position-level coordinates
+    ASSERT_FALSE(utils::ReadBinaryCheckpoint(&sys2, corrupted.data(), corrupted.size()));
+    ASSERT_EQ(sys2.GetChTime(), 0.0);
+    ASSERT_TRUE(sys2.Get_bodylist()[1]->GetPos() == pos);
+
+    // The valid checkpoint is still accepted
+    ASSERT_TRUE(utils::ReadBinaryCheckpoint(&sys2, checkpoint.data(), checkpoint.size()));
+    ASSERT_EQ(sys2.GetChTime(), step);
+}
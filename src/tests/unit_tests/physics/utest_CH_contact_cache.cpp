@@ -0,0 +1,127 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the reaction cache of the NSC contact container.
+// A column of spheres resting on the ground is simulated, with contacts
+// generated by a custom collision callback (these contacts do not carry a
+// persistent reaction cache). The PSOR solver is warm started and performs a
+// fixed number of sweeps per step. Carrying over the contact reactions from the
+// previous step must then give a more accurate solution (spheres at rest at
+// their initial positions) than starting from zero reactions.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// ====================================================================================
+
+static const int num_spheres = 5;
+static const double radius = 0.5;
+
+// Custom collision detection: contacts between consecutive spheres in the column and between the ground and the
+// first sphere.
+class ColumnCollision : public ChSystem::CustomCollisionCallback {
+  public:
+    ColumnCollision(std::shared_ptr<ChBody> ground,
+                    const std::vector<std::shared_ptr<ChBody>>& spheres,
+                    std::shared_ptr<ChMaterialSurface> mat)
+        : m_ground(ground), m_spheres(spheres), m_mat(mat) {}
+
+    virtual void OnCustomCollision(ChSystem* sys) override {
+        for (int i = 0; i < num_spheres; i++) {
+            auto b_pos = m_spheres[i]->GetPos();
+            ChVector<> a_pos = (i == 0) ? ChVector<>(b_pos.x(), -radius, b_pos.z()) : m_spheres[i - 1]->GetPos();
+            double dist = b_pos.y() - a_pos.y() - 2 * radius;
+            if (dist > 0.01)
+                continue;
+
+            ChCollisionInfo contact;
+            contact.modelA = (i == 0) ? m_ground->GetCollisionModel().get() : m_spheres[i - 1]->GetCollisionModel().get();
+            contact.modelB = m_spheres[i]->GetCollisionModel().get();
+            contact.shapeA = nullptr;
+            contact.shapeB = nullptr;
+            contact.vN = ChVector<>(0, 1, 0);
+            contact.vpA = a_pos + ChVector<>(0, radius, 0);
+            contact.vpB = b_pos - ChVector<>(0, radius, 0);
+            contact.distance = dist;
+            sys->GetContactContainer()->AddContact(contact, m_mat, m_mat);
+        }
+    }
+
+  private:
+    std::shared_ptr<ChBody> m_ground;
+    std::vector<std::shared_ptr<ChBody>> m_spheres;
+    std::shared_ptr<ChMaterialSurface> m_mat;
+};
+
+// Simulate the column of spheres and return the largest deviation of a sphere from its resting position.
+static double Simulate(bool use_cache) {
+    ChSystemNSC sys;
+
+    // Zero tolerance: a fixed number of sweeps, so that both runs perform the same amount of work
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(50);
+    solver->SetTolerance(0);
+    solver->EnableWarmStart(true);
+    sys.SetSolver(solver);
+
+    std::static_pointer_cast<ChContactContainerNSC>(sys.GetContactContainer())->SetUseReactionCache(use_cache);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int i = 0; i < num_spheres; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, false);
+        sphere->SetPos(ChVector<>(0, radius + 2 * radius * i, 0));
+        sys.AddBody(sphere);
+        spheres.push_back(sphere);
+    }
+
+    sys.RegisterCustomCollisionCallback(chrono_types::make_shared<ColumnCollision>(ground, spheres, mat));
+
+    for (int i = 0; i < 400; i++)
+        sys.DoStepDynamics(1e-3);
+
+    EXPECT_EQ(sys.GetNcontacts(), num_spheres);
+
+    double error = 0;
+    for (int i = 0; i < num_spheres; i++)
+        error = std::max(error, (spheres[i]->GetPos() - ChVector<>(0, radius + 2 * radius * i, 0)).Length());
+
+    return error;
+}
+
+TEST(ChContactContainerNSC, reaction_cache) {
+    double error_cache = Simulate(true);
+    double error_nocache = Simulate(false);
+
+    std::cout << "Position error  with cache: " << error_cache << "  without cache: " << error_nocache << std::endl;
+    ASSERT_LT(error_cache, error_nocache);
+    ASSERT_LT(error_cache, 1e-10);
+}
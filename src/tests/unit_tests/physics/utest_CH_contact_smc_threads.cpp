@@ -0,0 +1,76 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the parallel evaluation of SMC contact forces.
+// A pile of spheres in a box is simulated with different numbers of threads.
+// Results must be identical (bitwise) regardless of the number of threads.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+static void CreateModel(ChSystemSMC& sys, int num_threads) {
+    sys.SetNumThreads(num_threads);
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.4f);
+    mat->SetYoungModulus(1e7f);
+    mat->SetRestitution(0.1f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 1, 4, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            for (int k = 0; k < 5; k++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, true, true, mat);
+                ball->SetPos(ChVector<>(-0.8 + 0.39 * i + 0.01 * k, 0.19 + 0.39 * k, -0.8 + 0.39 * j));
+                sys.AddBody(ball);
+            }
+        }
+    }
+}
+
+TEST(ChContactContainerSMC, threads) {
+    ChSystemSMC sys1;
+    ChSystemSMC sys4;
+    CreateModel(sys1, 1);
+    CreateModel(sys4, 4);
+
+    double step = 1e-4;
+    for (int i = 0; i < 1000; i++) {
+        sys1.DoStepDynamics(step);
+        sys4.DoStepDynamics(step);
+    }
+
+    ASSERT_GT(sys1.GetNcontacts(), 64);
+    ASSERT_EQ(sys1.GetNcontacts(), sys4.GetNcontacts());
+
+    auto& bodies1 = sys1.Get_bodylist();
+    auto& bodies4 = sys4.Get_bodylist();
+    for (size_t i = 0; i < bodies1.size(); i++) {
+        ASSERT_EQ(bodies1[i]->GetPos(), bodies4[i]->GetPos());
+        ASSERT_EQ(bodies1[i]->GetPos_dt(), bodies4[i]->GetPos_dt());
+        ASSERT_EQ(bodies1[i]->GetRot(), bodies4[i]->GetRot());
+    }
+}
@@ -0,0 +1,200 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for solving simulation islands separately (ChSystem::SetUseIslands).
+// The model consists of several columns of spheres resting on a common fixed
+// ground (with contacts generated by a custom collision callback) and several
+// double pendulums attached to the same ground. Each column and each pendulum
+// is an independent island. The results obtained by solving the islands
+// separately must match those of the monolithic solve. Constraints acting only
+// on fixed bodies belong to no island and must report zero reactions.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// ====================================================================================
+
+static const int num_columns = 3;
+static const int num_spheres = 3;
+static const int num_pendulums = 2;
+static const double radius = 0.5;
+static const double step = 1e-3;
+
+// Custom collision detection: contacts between consecutive spheres in each column and between the ground and the
+// first sphere of each column.
+class ColumnsCollision : public ChSystem::CustomCollisionCallback {
+  public:
+    ColumnsCollision(std::shared_ptr<ChBody> ground,
+                     const std::vector<std::shared_ptr<ChBody>>& spheres,
+                     std::shared_ptr<ChMaterialSurface> mat)
+        : m_ground(ground), m_spheres(spheres), m_mat(mat) {}
+
+    virtual void OnCustomCollision(ChSystem* sys) override {
+        for (int j = 0; j < num_columns; j++) {
+            for (int i = 0; i < num_spheres; i++) {
+                auto b = m_spheres[j * num_spheres + i];
+                auto a = (i == 0) ? m_ground : m_spheres[j * num_spheres + i - 1];
+                auto b_pos = b->GetPos();
+                ChVector<> a_pos = (i == 0) ? ChVector<>(b_pos.x(), -radius, b_pos.z()) : a->GetPos();
+                double dist = b_pos.y() - a_pos.y() - 2 * radius;
+                if (dist > 0.01)
+                    continue;
+
+                ChCollisionInfo contact;
+                contact.modelA = a->GetCollisionModel().get();
+                contact.modelB = b->GetCollisionModel().get();
+                contact.shapeA = nullptr;
+                contact.shapeB = nullptr;
+                contact.vN = ChVector<>(0, 1, 0);
+                contact.vpA = a_pos + ChVector<>(0, radius, 0);
+                contact.vpB = b_pos - ChVector<>(0, radius, 0);
+                contact.distance = dist;
+                sys->GetContactContainer()->AddContact(contact, m_mat, m_mat);
+            }
+        }
+    }
+
+  private:
+    std::shared_ptr<ChBody> m_ground;
+    std::vector<std::shared_ptr<ChBody>> m_spheres;
+    std::shared_ptr<ChMaterialSurface> m_mat;
+};
+
+// Construct the test model in the given system.
+static void CreateModel(ChSystemNSC& sys) {
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    // Zero tolerance: a fixed number of sweeps, so that the stopping test does not depend on the island partition
+    solver->SetMaxIterations(200);
+    solver->SetTolerance(0);
+    solver->EnableWarmStart(true);
+    sys.SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    // Columns of spheres, with slightly different initial offsets
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int j = 0; j < num_columns; j++) {
+        for (int i = 0; i < num_spheres; i++) {
+            auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, false);
+            sphere->SetPos(ChVector<>(3.0 * j + 0.01 * i * (j + 1), radius + 2 * radius * i + 0.002 * i, 0));
+            sys.AddBody(sphere);
+            spheres.push_back(sphere);
+        }
+    }
+    sys.RegisterCustomCollisionCallback(chrono_types::make_shared<ColumnsCollision>(ground, spheres, mat));
+
+    // Double pendulums of different lengths
+    for (int j = 0; j < num_pendulums; j++) {
+        double length = 1.0 + 0.5 * j;
+        ChVector<> anchor(-5.0 - 4.0 * j, 4, 0);
+
+        auto link1 = chrono_types::make_shared<ChBodyEasyBox>(length, 0.1, 0.1, 1000, false, false);
+        link1->SetPos(anchor + ChVector<>(length / 2, 0, 0));
+        sys.AddBody(link1);
+
+        auto link2 = chrono_types::make_shared<ChBodyEasyBox>(length, 0.1, 0.1, 1000, false, false);
+        link2->SetPos(anchor + ChVector<>(length, -length / 2, 0));
+        link2->SetRot(Q_from_AngZ(CH_C_PI_2));
+        sys.AddBody(link2);
+
+        auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev1->Initialize(ground, link1, ChCoordsys<>(anchor, QUNIT));
+        sys.AddLink(rev1);
+
+        auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev2->Initialize(link1, link2, ChCoordsys<>(anchor + ChVector<>(length, 0, 0), QUNIT));
+        sys.AddLink(rev2);
+    }
+}
+
+TEST(ChSystem, islands_count) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+    sys.SetUseIslands(true);
+
+    sys.DoStepDynamics(step);
+    ASSERT_EQ(sys.GetNcontacts(), num_columns * num_spheres);
+    ASSERT_EQ(sys.GetNumIslands(), num_columns + num_pendulums);
+
+    // Without islands, the problem is solved as a whole
+    sys.SetUseIslands(false);
+    sys.DoStepDynamics(step);
+    ASSERT_EQ(sys.GetNumIslands(), 0);
+}
+
+TEST(ChSystem, islands_match_monolithic) {
+    ChSystemNSC sys_ref;
+    CreateModel(sys_ref);
+
+    ChSystemNSC sys;
+    CreateModel(sys);
+    sys.SetUseIslands(true);
+    sys.SetNumThreads(2);
+
+    for (int i = 0; i < 500; i++) {
+        sys_ref.DoStepDynamics(step);
+        sys.DoStepDynamics(step);
+    }
+    ASSERT_EQ(sys.GetNumIslands(), num_columns + num_pendulums);
+
+    const auto& bodies_ref = sys_ref.Get_bodylist();
+    const auto& bodies = sys.Get_bodylist();
+    ASSERT_EQ(bodies.size(), bodies_ref.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        ASSERT_NEAR((bodies[i]->GetPos() - bodies_ref[i]->GetPos()).Length(), 0.0, 1e-6);
+        ASSERT_NEAR((bodies[i]->GetPos_dt() - bodies_ref[i]->GetPos_dt()).Length(), 0.0, 1e-5);
+    }
+}
+
+TEST(ChSystem, islands_unassigned_constraints) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+    sys.SetUseIslands(true);
+
+    // Joint between two fixed bodies: its constraints act on inactive variables only
+    auto fixed1 = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, false);
+    fixed1->SetPos(ChVector<>(0, 10, 0));
+    fixed1->SetBodyFixed(true);
+    sys.AddBody(fixed1);
+    auto fixed2 = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, false);
+    fixed2->SetPos(ChVector<>(1, 10, 0));
+    fixed2->SetBodyFixed(true);
+    sys.AddBody(fixed2);
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(fixed1, fixed2, ChCoordsys<>(ChVector<>(0.5, 10, 0), QUNIT));
+    sys.AddLink(joint);
+
+    for (int i = 0; i < 10; i++) {
+        sys.DoStepDynamics(step);
+        ASSERT_EQ(sys.GetNumIslands(), num_columns + num_pendulums);
+        ASSERT_EQ(joint->Get_react_force().Length(), 0.0);
+        ASSERT_EQ(joint->Get_react_torque().Length(), 0.0);
+    }
+}
@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the cache of composite materials used during contact creation.
+// Cached composites must match composites computed directly, independently of
+// the order of the two materials, and must be recomputed whenever one of the
+// materials or the composition strategy changes.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "chrono/core/ChTypes.h"
+#include "chrono/physics/ChMaterialCompositeTable.h"
+#include "chrono/physics/ChMaterialSurfaceNSC.h"
+#include "chrono/physics/ChMaterialSurfaceSMC.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Composition strategy using the maximum friction coefficient.
+class MaxFrictionStrategy : public ChMaterialCompositionStrategy {
+  public:
+    virtual float CombineFriction(float a1, float a2) const override { return std::max<float>(a1, a2); }
+};
+
+static void Check(const ChMaterialCompositeNSC& cached, const ChMaterialCompositeNSC& direct) {
+    ASSERT_FLOAT_EQ(cached.static_friction, direct.static_friction);
+    ASSERT_FLOAT_EQ(cached.sliding_friction, direct.sliding_friction);
+    ASSERT_FLOAT_EQ(cached.restitution, direct.restitution);
+    ASSERT_FLOAT_EQ(cached.cohesion, direct.cohesion);
+    ASSERT_FLOAT_EQ(cached.compliance, direct.compliance);
+    ASSERT_FLOAT_EQ(cached.complianceT, direct.complianceT);
+}
+
+TEST(ChMaterialCompositeTable, identifiers) {
+    std::set<int> ids;
+    int max_id;
+    {
+        std::vector<std::shared_ptr<ChMaterialSurfaceNSC>> mats;
+        for (int i = 0; i < 10; i++) {
+            mats.push_back(chrono_types::make_shared<ChMaterialSurfaceNSC>());
+            ids.insert(mats.back()->GetIdentifier());
+        }
+        // A copy gets its own identifier
+        ChMaterialSurfaceNSC copy(*mats[0]);
+        ASSERT_NE(copy.GetIdentifier(), mats[0]->GetIdentifier());
+        max_id = *ids.rbegin();
+    }
+    ASSERT_EQ((int)ids.size(), 10);
+
+    // Identifiers of deleted materials are reused
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    ASSERT_LE(mat->GetIdentifier(), max_id + 1);
+}
+
+TEST(ChMaterialCompositeTable, NSC) {
+    ChMaterialCompositionStrategy strategy;
+    ChMaterialCompositeTable<ChMaterialSurfaceNSC, ChMaterialCompositeNSC> table;
+
+    std::vector<std::shared_ptr<ChMaterialSurfaceNSC>> mats;
+    for (int i = 0; i < 20; i++) {
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        mat->SetFriction(0.1f + 0.04f * i);
+        mat->SetRestitution(0.01f * i);
+        mat->SetCohesion(1.0f * i);
+        mat->SetCompliance(1e-5f * i);
+        mats.push_back(mat);
+    }
+
+    // All pairs, in both orders
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < 20; i++) {
+            for (int j = 0; j < 20; j++) {
+                ChMaterialCompositeNSC direct(&strategy, mats[i], mats[j]);
+                Check(table.GetComposite(&strategy, mats[i], mats[j]), direct);
+            }
+        }
+    }
+    ASSERT_EQ((int)table.GetNumPairs(), 20 * 21 / 2);
+
+    // Changing a material property invalidates the cached composites
+    mats[3]->SetFriction(0.05f);
+    ASSERT_FLOAT_EQ(table.GetComposite(&strategy, mats[5], mats[3]).static_friction, 0.05f);
+
+    mats[3]->SetCompliance(1e-3f);
+    ASSERT_FLOAT_EQ(table.GetComposite(&strategy, mats[3], mats[0]).compliance, 1e-3f);
+
+    // Changing the composition strategy invalidates the cached composites
+    MaxFrictionStrategy max_strategy;
+    ASSERT_FLOAT_EQ(table.GetComposite(&max_strategy, mats[0], mats[19]).static_friction, mats[19]->GetSfriction());
+    ASSERT_FLOAT_EQ(table.GetComposite(&strategy, mats[0], mats[19]).static_friction, mats[0]->GetSfriction());
+    ASSERT_EQ((int)table.GetNumPairs(), 20 * 21 / 2);
+}
+
+TEST(ChMaterialCompositeTable, SMC) {
+    ChMaterialCompositionStrategy strategy;
+    ChMaterialCompositeTable<ChMaterialSurfaceSMC, ChMaterialCompositeSMC> table;
+
+    auto mat1 = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    auto mat2 = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat1->SetYoungModulus(1e7f);
+    mat2->SetYoungModulus(2e8f);
+    mat2->SetPoissonRatio(0.4f);
+    mat1->SetKn(1e5f);
+    mat2->SetKn(3e5f);
+
+    ChMaterialCompositeSMC direct(&strategy, mat1, mat2);
+    const auto& cached = table.GetComposite(&strategy, mat2, mat1);
+    ASSERT_FLOAT_EQ(cached.E_eff, direct.E_eff);
+    ASSERT_FLOAT_EQ(cached.G_eff, direct.G_eff);
+    ASSERT_FLOAT_EQ(cached.kn, direct.kn);
+
+    // A material replaced by a new one with a recycled identifier is not confused with the old one
+    mat2.reset();
+    auto mat3 = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat3->SetKn(5e5f);
+    ChMaterialCompositeSMC direct3(&strategy, mat1, mat3);
+    ASSERT_FLOAT_EQ(table.GetComposite(&strategy, mat1, mat3).kn, direct3.kn);
+}
@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the parallel processing of bodies, shafts, and links in the
+// per-item passes over the assembly.
+// A set of pendulums and shafts is simulated with serial and parallel updates.
+// Results must be identical (bitwise).
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChShaft.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// Number of bodies, links, and shafts (larger than the minimum size of a list processed in parallel)
+static const int num_items = 200;
+
+static void CreateModel(ChSystemNSC& sys, bool parallel) {
+    sys.SetNumThreads(4);
+    sys.SetUseParallelUpdate(parallel);
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < num_items; i++) {
+        auto bob = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, false);
+        bob->SetPos(ChVector<>(1.0 + 0.001 * i, 0, 0.5 * i));
+        bob->SetPos_dt(ChVector<>(0, 0, 0.01 * i));
+        sys.AddBody(bob);
+
+        auto joint = chrono_types::make_shared<ChLinkLockSpherical>();
+        joint->Initialize(ground, bob, ChCoordsys<>(ChVector<>(0, 0, 0.5 * i)));
+        sys.AddLink(joint);
+
+        auto shaft = chrono_types::make_shared<ChShaft>();
+        shaft->SetInertia(1 + 0.01 * i);
+        shaft->SetAppliedTorque(0.1 * i);
+        sys.AddShaft(shaft);
+    }
+}
+
+TEST(ChAssembly, parallel_update) {
+    ChSystemNSC sys_serial;
+    ChSystemNSC sys_parallel;
+    ASSERT_FALSE(sys_serial.GetUseParallelUpdate());
+
+    CreateModel(sys_serial, false);
+    CreateModel(sys_parallel, true);
+
+    double step = 1e-3;
+    for (int i = 0; i < 200; i++) {
+        sys_serial.DoStepDynamics(step);
+        sys_parallel.DoStepDynamics(step);
+    }
+
+    auto& bodies1 = sys_serial.Get_bodylist();
+    auto& bodies2 = sys_parallel.Get_bodylist();
+    ASSERT_EQ(bodies1.size(), bodies2.size());
+    for (size_t i = 0; i < bodies1.size(); i++) {
+        ASSERT_EQ(bodies1[i]->GetPos(), bodies2[i]->GetPos());
+        ASSERT_EQ(bodies1[i]->GetPos_dt(), bodies2[i]->GetPos_dt());
+        ASSERT_EQ(bodies1[i]->GetRot(), bodies2[i]->GetRot());
+    }
+
+    auto& shafts1 = sys_serial.Get_shaftlist();
+    auto& shafts2 = sys_parallel.Get_shaftlist();
+    ASSERT_EQ(shafts1.size(), shafts2.size());
+    for (size_t i = 0; i < shafts1.size(); i++) {
+        ASSERT_EQ(shafts1[i]->GetPos(), shafts2[i]->GetPos());
+        ASSERT_EQ(shafts1[i]->GetPos_dt(), shafts2[i]->GetPos_dt());
+    }
+
+    auto& links1 = sys_serial.Get_linklist();
+    auto& links2 = sys_parallel.Get_linklist();
+    for (size_t i = 0; i < links1.size(); i++) {
+        ASSERT_EQ(links1[i]->Get_react_force(), links2[i]->Get_react_force());
+    }
+}
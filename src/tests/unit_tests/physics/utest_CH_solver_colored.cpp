@@ -0,0 +1,113 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the graph-colored parallel PSOR solver (ChSolverPSORColored).
+// A pile of spheres in a box (plus a pendulum) is simulated with different
+// numbers of threads. Results must not depend on the number of threads and
+// must be close to those obtained with the sequential PSOR solver.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORColored.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+// Create the test model. If num_threads = 0, use the sequential PSOR solver.
+static void CreateModel(ChSystemNSC& sys, int num_threads) {
+    if (num_threads == 0) {
+        sys.SetSolver(chrono_types::make_shared<ChSolverPSOR>());
+        sys.SetNumThreads(1);
+    } else {
+        sys.SetSolver(chrono_types::make_shared<ChSolverPSORColored>());
+        sys.SetNumThreads(num_threads);
+    }
+    sys.SetSolverMaxIterations(100);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 1, 4, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            for (int k = 0; k < 4; k++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, true, true, mat);
+                ball->SetPos(ChVector<>(-0.6 + 0.41 * i + 0.01 * k, 0.2 + 0.41 * k, -0.6 + 0.41 * j));
+                sys.AddBody(ball);
+            }
+        }
+    }
+
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+    pend->SetPos(ChVector<>(3.5, 2, 0));
+    sys.AddBody(pend);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChCoordsys<>(ChVector<>(3, 2, 0)));
+    sys.AddLink(rev);
+}
+
+TEST(ChSolverPSORColored, threads) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys4;
+    CreateModel(sys1, 1);
+    CreateModel(sys4, 4);
+
+    double step = 1e-3;
+    for (int i = 0; i < 500; i++) {
+        sys1.DoStepDynamics(step);
+        sys4.DoStepDynamics(step);
+    }
+
+    auto solver = std::static_pointer_cast<ChSolverPSORColored>(sys4.GetSolver());
+    ASSERT_GT(solver->GetNumColors(), 1);
+
+    auto& bodies1 = sys1.Get_bodylist();
+    auto& bodies4 = sys4.Get_bodylist();
+    for (size_t i = 0; i < bodies1.size(); i++) {
+        ASSERT_EQ(bodies1[i]->GetPos(), bodies4[i]->GetPos());
+        ASSERT_EQ(bodies1[i]->GetPos_dt(), bodies4[i]->GetPos_dt());
+    }
+}
+
+TEST(ChSolverPSORColored, compare_PSOR) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_colored;
+    CreateModel(sys_ref, 0);
+    CreateModel(sys_colored, 2);
+
+    double step = 1e-3;
+    for (int i = 0; i < 500; i++) {
+        sys_ref.DoStepDynamics(step);
+        sys_colored.DoStepDynamics(step);
+    }
+
+    ASSERT_GT(sys_colored.GetNcontacts(), 0);
+
+    auto& bodies_ref = sys_ref.Get_bodylist();
+    auto& bodies_colored = sys_colored.Get_bodylist();
+    for (size_t i = 0; i < bodies_ref.size(); i++) {
+        ASSERT_NEAR((bodies_ref[i]->GetPos() - bodies_colored[i]->GetPos()).Length(), 0.0, 1e-2);
+    }
+}
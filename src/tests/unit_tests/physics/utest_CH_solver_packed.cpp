@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for PSOR-like solvers working on packed constraint data.
+// Two identical NSC systems (a pendulum and a few spheres falling on a box) are
+// simulated, one with the default solver path and one with packed constraints
+// (see ChSystemDescriptor::SetUsePackedConstraints). The body states and the
+// solver iterations must match.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSSOR.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// ====================================================================================
+
+static void CreateModel(ChSystemNSC& sys, ChSolver::Type solver_type, bool packed) {
+    switch (solver_type) {
+        case ChSolver::Type::PSOR:
+            sys.SetSolver(chrono_types::make_shared<ChSolverPSOR>());
+            break;
+        case ChSolver::Type::PSSOR:
+            sys.SetSolver(chrono_types::make_shared<ChSolverPSSOR>());
+            break;
+        case ChSolver::Type::PJACOBI:
+            sys.SetSolver(chrono_types::make_shared<ChSolverPJacobi>());
+            break;
+        default:
+            break;
+    }
+    sys.SetSolverMaxIterations(50);
+    sys.GetSystemDescriptor()->SetUsePackedConstraints(packed);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 5; i++) {
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, true, true, mat);
+        ball->SetPos(ChVector<>(0.1 * i, 0.3 + 0.45 * i, 0.05 * i));
+        sys.AddBody(ball);
+    }
+
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+    pend->SetPos(ChVector<>(3.5, 2, 0));
+    sys.AddBody(pend);
+
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(ground, pend, ChCoordsys<>(ChVector<>(3, 2, 0)));
+    sys.AddLink(rev);
+}
+
+class PackedSolverTest : public ::testing::TestWithParam<ChSolver::Type> {};
+
+TEST_P(PackedSolverTest, compare) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_packed;
+    CreateModel(sys_ref, GetParam(), false);
+    CreateModel(sys_packed, GetParam(), true);
+
+    double step = 1e-3;
+    for (int i = 0; i < 500; i++) {
+        sys_ref.DoStepDynamics(step);
+        sys_packed.DoStepDynamics(step);
+
+        auto solver_ref = std::static_pointer_cast<ChIterativeSolverVI>(sys_ref.GetSolver());
+        auto solver_packed = std::static_pointer_cast<ChIterativeSolverVI>(sys_packed.GetSolver());
+        ASSERT_EQ(solver_ref->GetIterations(), solver_packed->GetIterations());
+    }
+
+    auto& bodies_ref = sys_ref.Get_bodylist();
+    auto& bodies_packed = sys_packed.Get_bodylist();
+    ASSERT_EQ(bodies_ref.size(), bodies_packed.size());
+    ASSERT_GT(sys_packed.GetNcontacts(), 0);
+
+    for (size_t i = 0; i < bodies_ref.size(); i++) {
+        ASSERT_NEAR((bodies_ref[i]->GetPos() - bodies_packed[i]->GetPos()).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((bodies_ref[i]->GetPos_dt() - bodies_packed[i]->GetPos_dt()).Length(), 0.0, 1e-10);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSolver,
+                         PackedSolverTest,
+                         ::testing::Values(ChSolver::Type::PSOR, ChSolver::Type::PSSOR, ChSolver::Type::PJACOBI));
@@ -23,6 +23,8 @@
 #include "chrono_thirdparty/cxxopts/ChCLI.h"
 #include "chrono_synchrono/SynChronoManager.h"
 #include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
+#include "chrono_synchrono/communication/mpi/SynMPIStateEncoding.h"
+#include "chrono_synchrono/flatbuffer/message/SynWheeledVehicleMessage.h"
 
 #include "chrono_synchrono/utils/SynDataLoader.h"
 
@@ -34,6 +36,7 @@ using namespace synchrono;
 
 int rank;
 int num_ranks;
+std::shared_ptr<SynMPICommunicator> communicator;
 
 // Define our own main here to handle the MPI setup
 int main(int argc, char* argv[]) {
@@ -41,7 +44,7 @@ int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
 
     // Create the MPI communicator and the manager
-    auto communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
+    communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
     rank = communicator->GetRank();
     num_ranks = communicator->GetNumRanks();
     SynChronoManager syn_manager(rank, num_ranks, communicator);
@@ -102,4 +105,120 @@ TEST(SynChrono, SynChronoInit) {
 
     delete[] msg_lengths;
     delete[] msg_displs;
-}
\ No newline at end of file
+}
+
+// Create a wheeled vehicle state message for a vehicle at the given location, at the given time
+std::shared_ptr<SynWheeledVehicleStateMessage> CreateStateMessage(int agent, const ChVector<>& loc, double time) {
+    auto message = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(rank, agent), AgentKey());
+    message->SetMessageType(SynFlatBuffers::Type_Agent_State);
+
+    ChVector<> vel(10, 0.5, 0);
+    ChFrameMoving<> chassis_frame(loc + time * vel, Q_from_AngZ(0.1 * time));
+    chassis_frame.SetPos_dt(vel);
+    SynPose chassis(chassis_frame);
+
+    std::vector<SynPose> wheels;
+    for (int i = 0; i < 4; i++) {
+        ChFrameMoving<> wheel_frame(chassis_frame.GetPos() + ChVector<>(i < 2 ? 1.5 : -1.5, i % 2 ? 1 : -1, -0.3),
+                                    Q_from_AngY(3.0 * time));
+        wheel_frame.SetPos_dt(vel);
+        wheels.push_back(SynPose(wheel_frame));
+    }
+
+    message->SetState(time, chassis, wheels);
+    return message;
+}
+
+// Check that two wheeled vehicle state messages hold the same state
+void CheckSameState(std::shared_ptr<SynMessage> a, std::shared_ptr<SynMessage> b) {
+    auto sa = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(a);
+    auto sb = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(b);
+    ASSERT_TRUE(sa && sb);
+    ASSERT_EQ(sa->GetSourceKey().GetNodeID(), sb->GetSourceKey().GetNodeID());
+    ASSERT_EQ(sa->GetSourceKey().GetAgentID(), sb->GetSourceKey().GetAgentID());
+    ASSERT_EQ(sa->time, sb->time);
+    ASSERT_EQ(sa->wheels.size(), sb->wheels.size());
+    ASSERT_EQ(sa->chassis.GetFrame().GetPos(), sb->chassis.GetFrame().GetPos());
+    ASSERT_EQ(sa->chassis.GetFrame().GetRot(), sb->chassis.GetFrame().GetRot());
+    ASSERT_EQ(sa->chassis.GetFrame().GetPos_dt(), sb->chassis.GetFrame().GetPos_dt());
+    for (size_t i = 0; i < sa->wheels.size(); i++) {
+        ASSERT_EQ(sa->wheels[i].GetFrame().GetPos(), sb->wheels[i].GetFrame().GetPos());
+        ASSERT_EQ(sa->wheels[i].GetFrame().GetRot(), sb->wheels[i].GetFrame().GetRot());
+    }
+}
+
+TEST(SynChrono, StateEncoding) {
+    SynMPIStateEncoder encoder;
+    SynMPIStateDecoder decoder;
+
+    // First message is encoded in full
+    auto msg1 = CreateStateMessage(1, ChVector<>(100, 20, 0), 1.0);
+    std::vector<uint8_t> full;
+    encoder.Encode(msg1, full);
+    encoder.Commit();
+
+    SynMessageList received;
+    ASSERT_TRUE(decoder.Decode(full.data(), full.size(), received));
+    ASSERT_EQ(received.size(), 1);
+    CheckSameState(msg1, received[0]);
+
+    // Next message is delta-encoded with respect to the first one
+    auto msg2 = CreateStateMessage(1, ChVector<>(100, 20, 0), 1.01);
+    std::vector<uint8_t> delta;
+    encoder.Encode(msg2, delta);
+    encoder.Commit();
+    ASSERT_LT(delta.size(), full.size());
+
+    received.clear();
+    ASSERT_TRUE(decoder.Decode(delta.data(), delta.size(), received));
+    ASSERT_EQ(received.size(), 1);
+    CheckSameState(msg2, received[0]);
+
+    // A delta-encoded message cannot be decoded without its base
+    SynMPIStateDecoder decoder2;
+    received.clear();
+    ASSERT_FALSE(decoder2.Decode(delta.data(), delta.size(), received));
+
+    // Malformed buffers are rejected: truncated data, and a pose count larger than the buffer
+    ASSERT_FALSE(decoder2.Decode(full.data(), full.size() - 1, received));
+    std::vector<uint8_t> bad(full.begin(), full.begin() + 18);
+    bad.insert(bad.end(), {0xFF, 0xFF, 0xFF, 0x7F});
+    ASSERT_FALSE(decoder2.Decode(bad.data(), bad.size(), received));
+    ASSERT_EQ(received.size(), 0);
+}
+
+TEST(SynChrono, InterestManagement) {
+    const int num_steps = 5;
+
+    // Ranks far apart: no vehicle states are exchanged
+    communicator->SetInterestRadius(50);
+    for (int step = 0; step < num_steps; step++) {
+        SynMessageList messages;
+        messages.push_back(CreateStateMessage(1, ChVector<>(1000.0 * rank, 0, 0), 0.01 * step));
+        communicator->AddOutgoingMessages(messages);
+        communicator->Synchronize();
+        ASSERT_EQ(communicator->GetMessages().size(), 0);
+        ASSERT_EQ(communicator->GetNumNeighbors(), 0);
+        communicator->Reset();
+    }
+
+    // Ranks close together: all vehicle states are received, exactly, including the delta-encoded ones
+    for (int step = 0; step < num_steps; step++) {
+        SynMessageList messages;
+        messages.push_back(CreateStateMessage(1, ChVector<>(10.0 * rank, 0, 0), 0.01 * step));
+        communicator->AddOutgoingMessages(messages);
+        communicator->Synchronize();
+
+        auto& received = communicator->GetMessages();
+        ASSERT_EQ(received.size(), num_ranks - 1);
+        ASSERT_EQ(communicator->GetNumNeighbors(), num_ranks - 1);
+        for (auto& message : received) {
+            int source = message->GetSourceKey().GetNodeID();
+            CheckSameState(message, CreateStateMessage(1, ChVector<>(10.0 * source, 0, 0), 0.01 * step));
+        }
+        communicator->Reset();
+    }
+
+    communicator->SetInterestRadius(0);
+    MPI_Barrier(MPI_COMM_WORLD);
+}
@@ -0,0 +1,91 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the storage of SCM grid nodes.
+// A sphere settles on SCM deformable terrain, once above the origin and once
+// shifted by a number of grid nodes which is not a multiple of the node tile
+// size. The SCM grid nodes then fall in different tiles (with the footprint
+// straddling negative and positive node indices), but the deformation, the
+// contact force and the sphere motion must be the same.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const double delta = 0.05;
+static const int shift = 3;
+
+struct SCMResults {
+    ChVector<> pos;
+    ChVector<> force;
+    std::vector<SCMDeformableTerrain::NodeLevel> nodes;
+};
+
+static SCMResults Simulate(int offset) {
+    ChSystemNSC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    SCMDeformableTerrain terrain(&sys, false);
+    terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 2e8, 3e4);
+    terrain.Initialize(4, 4, delta);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.3, 500, true, true, mat);
+    sphere->SetPos(ChVector<>(0.0123 + offset * delta, -0.0071, 0.31));
+    sys.AddBody(sphere);
+
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+
+    SCMResults res;
+    res.pos = sphere->GetPos() - ChVector<>(offset * delta, 0, 0);
+    res.force = terrain.GetContactForce(sphere).force;
+    res.nodes = terrain.GetModifiedNodes(true);
+    for (auto& n : res.nodes)
+        n.first.x() -= offset;
+    std::sort(res.nodes.begin(), res.nodes.end(),
+              [](const SCMDeformableTerrain::NodeLevel& a, const SCMDeformableTerrain::NodeLevel& b) {
+                  return a.first.x() < b.first.x() || (a.first.x() == b.first.x() && a.first.y() < b.first.y());
+              });
+    return res;
+}
+
+TEST(SCMDeformableTerrain, grid_storage) {
+    SCMResults ref = Simulate(0);
+    SCMResults res = Simulate(shift);
+
+    // The sphere sinks into the terrain
+    ASSERT_GT(ref.nodes.size(), 0);
+    ASSERT_LT(ref.pos.z(), 0.3);
+    ASSERT_GT(ref.force.z(), 0);
+
+    ASSERT_NEAR((res.pos - ref.pos).Length(), 0.0, 1e-8);
+    ASSERT_NEAR((res.force - ref.force).Length(), 0.0, 1e-6 * ref.force.Length());
+    ASSERT_EQ(res.nodes.size(), ref.nodes.size());
+    for (size_t i = 0; i < ref.nodes.size(); i++) {
+        ASSERT_EQ(res.nodes[i].first.x(), ref.nodes[i].first.x());
+        ASSERT_EQ(res.nodes[i].first.y(), ref.nodes[i].first.y());
+        ASSERT_NEAR(res.nodes[i].second, ref.nodes[i].second, 1e-8);
+    }
+}
@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for terrain queries on RigidTerrain mesh patches.
+// The terrain heights and normals obtained with the height-field grid (see
+// RigidTerrain::UseHeightFieldGrid) must match those obtained by ray casting
+// into the collision system, for single-point and batched queries.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const std::string mesh_file = "utest_rigid_terrain.obj";
+
+// Write a bumpy surface over [-5,5] x [-5,5], with upward oriented faces.
+static void WriteMesh() {
+    const int n = 20;
+    const double delta = 10.0 / n;
+    std::ofstream file(mesh_file);
+    for (int j = 0; j <= n; j++) {
+        for (int i = 0; i <= n; i++) {
+            double x = -5 + i * delta;
+            double y = -5 + j * delta;
+            file << "v " << x << " " << y << " " << 0.3 * std::sin(x) * std::cos(0.7 * y) << "\n";
+        }
+    }
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int v00 = j * (n + 1) + i + 1;
+            int v10 = v00 + 1;
+            int v01 = v00 + n + 1;
+            int v11 = v01 + 1;
+            file << "f " << v00 << " " << v10 << " " << v11 << "\n";
+            file << "f " << v00 << " " << v11 << " " << v01 << "\n";
+        }
+    }
+}
+
+TEST(RigidTerrain, mesh_grid) {
+    WriteMesh();
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    ChCoordsys<> position(ChVector<>(0.5, -0.25, 1.0), Q_from_AngZ(0.3));
+
+    ChSystemNSC sys_ray;
+    RigidTerrain terrain_ray(&sys_ray);
+    terrain_ray.AddPatch(mat, position, mesh_file, true, 0, false);
+    terrain_ray.Initialize();
+
+    ChSystemNSC sys_grid;
+    RigidTerrain terrain_grid(&sys_grid);
+    terrain_grid.UseHeightFieldGrid(true);
+    terrain_grid.AddPatch(mat, position, mesh_file, true, 0, false);
+    terrain_grid.Initialize();
+
+    // Query locations, inside and outside the patch
+    std::vector<ChVector<>> loc;
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++)
+            loc.push_back(ChVector<>(-7.1 + 0.47 * i, -6.9 + 0.461 * j, 3.0));
+    }
+
+    std::vector<double> height_grid;
+    std::vector<ChVector<>> normal_grid;
+    terrain_grid.GetProperties(loc, height_grid, &normal_grid);
+    ASSERT_EQ(height_grid.size(), loc.size());
+    ASSERT_EQ(normal_grid.size(), loc.size());
+
+    int num_hits = 0;
+    for (size_t k = 0; k < loc.size(); k++) {
+        double height_ray;
+        ChVector<> normal_ray;
+        float friction_ray;
+        bool hit_ray = terrain_ray.FindPoint(loc[k], height_ray, normal_ray, friction_ray);
+
+        double height;
+        ChVector<> normal;
+        float friction;
+        bool hit = terrain_grid.FindPoint(loc[k], height, normal, friction);
+        ASSERT_EQ(hit, hit_ray) << "location " << k;
+        if (!hit)
+            continue;
+        num_hits++;
+        ASSERT_NEAR(height, height_ray, 1e-6);
+        ASSERT_NEAR((normal - normal_ray).Length(), 0.0, 1e-6);
+
+        // Batched and single-point queries return the same properties
+        double height1;
+        ChVector<> normal1;
+        terrain_grid.GetProperties(loc[k], height1, &normal1);
+        ASSERT_EQ(height_grid[k], height);
+        ASSERT_TRUE(normal_grid[k] == normal);
+        ASSERT_EQ(height1, height);
+        ASSERT_TRUE(normal1 == normal);
+    }
+    ASSERT_GT(num_hits, (int)loc.size() / 3);
+    ASSERT_LT(num_hits, (int)loc.size());
+
+    std::remove(mesh_file.c_str());
+    std::remove((mesh_file + ".chmesh").c_str());
+}